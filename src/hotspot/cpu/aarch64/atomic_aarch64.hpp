@@ -41,6 +41,8 @@ extern aarch64_atomic_stub_t aarch64_atomic_fetch_add_4_relaxed_impl;
 extern aarch64_atomic_stub_t aarch64_atomic_fetch_add_8_relaxed_impl;
 extern aarch64_atomic_stub_t aarch64_atomic_xchg_4_impl;
 extern aarch64_atomic_stub_t aarch64_atomic_xchg_8_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_xchg_4_relaxed_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_xchg_8_relaxed_impl;
 extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_1_impl;
 extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_4_impl;
 extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_8_impl;
@@ -6525,10 +6525,14 @@ class StubGenerator: public StubCodeGenerator {
     __ ret(lr);
   }
 
-  void gen_swpal_entry(Assembler::operand_size size) {
+  void gen_swpal_entry(Assembler::operand_size size, atomic_memory_order order) {
     Register prev = r2, addr = c_rarg0, incr = c_rarg1;
-    __ swpal(size, incr, prev, addr);
-    __ membar(Assembler::StoreStore|Assembler::StoreLoad);
+    if (order == memory_order_relaxed) {
+      __ swp(size, incr, prev, addr);
+    } else {
+      __ swpal(size, incr, prev, addr);
+      __ membar(Assembler::StoreStore|Assembler::StoreLoad);
+    }
     if (size == Assembler::xword) {
       __ mov(r0, prev);
     } else {
@@ -6562,9 +6566,17 @@ class StubGenerator: public StubCodeGenerator {
 
     // XCHG, memory_order_conservative
     AtomicStubMark mark_xchg_4(_masm, &aarch64_atomic_xchg_4_impl);
-    gen_swpal_entry(Assembler::word);
+    gen_swpal_entry(Assembler::word, memory_order_conservative);
     AtomicStubMark mark_xchg_8_impl(_masm, &aarch64_atomic_xchg_8_impl);
-    gen_swpal_entry(Assembler::xword);
+    gen_swpal_entry(Assembler::xword, memory_order_conservative);
+
+    // XCHG, memory_order_relaxed
+    AtomicStubMark mark_xchg_4_relaxed
+      (_masm, &aarch64_atomic_xchg_4_relaxed_impl);
+    gen_swpal_entry(MacroAssembler::word, memory_order_relaxed);
+    AtomicStubMark mark_xchg_8_relaxed
+      (_masm, &aarch64_atomic_xchg_8_relaxed_impl);
+    gen_swpal_entry(MacroAssembler::xword, memory_order_relaxed);
 
     // CAS, memory_order_conservative
     AtomicStubMark mark_cmpxchg_1(_masm, &aarch64_atomic_cmpxchg_1_impl);
@@ -7770,6 +7782,8 @@ DEFAULT_ATOMIC_OP(fetch_add, 4, _relaxed)
 DEFAULT_ATOMIC_OP(fetch_add, 8, _relaxed)
 DEFAULT_ATOMIC_OP(xchg, 4, )
 DEFAULT_ATOMIC_OP(xchg, 8, )
+DEFAULT_ATOMIC_OP(xchg, 4, _relaxed)
+DEFAULT_ATOMIC_OP(xchg, 8, _relaxed)
 DEFAULT_ATOMIC_OP(cmpxchg, 1, )
 DEFAULT_ATOMIC_OP(cmpxchg, 4, )
 DEFAULT_ATOMIC_OP(cmpxchg, 8, )
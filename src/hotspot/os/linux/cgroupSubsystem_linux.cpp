@@ -525,6 +525,12 @@ int CgroupSubsystem::active_processor_count() {
   result = MIN2(cpu_count, limit_count);
   log_trace(os, container)("OSContainer::active_processor_count: %d", result);
 
+  // Make quota changes while the VM is running visible.
+  int prev_result = (int)cpu_limit->value();
+  if (prev_result != -1 && prev_result != result) {
+    log_info(os, container)("Active processor count changed from %d to %d", prev_result, result);
+  }
+
   // Update cached metric to avoid re-reading container settings too often
   cpu_limit->set_value(result, OSCONTAINER_CACHE_TIMEOUT);
 
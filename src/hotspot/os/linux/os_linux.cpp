@@ -2752,6 +2752,38 @@ void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   }
 }
 
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23
+#endif
+
+// Set once the kernel has rejected MADV_POPULATE_WRITE (before Linux 5.14).
+static volatile bool _madv_populate_write_unsupported = false;
+
+bool os::pd_pretouch_memory(void* start, void* end, size_t page_size) {
+  if (!UseMadvPopulateWrite || _madv_populate_write_unsupported) {
+    return false;
+  }
+  // Let the kernel populate the whole range with one call instead of
+  // faulting each page in from user space. With THP this also lets the
+  // range be backed by huge pages right away.
+  char* first = align_down((char*)start, (size_t)vm_page_size());
+  char* last = align_up((char*)end, (size_t)vm_page_size());
+  if (first >= last) {
+    return true;
+  }
+  if (::madvise(first, pointer_delta(last, first, 1), MADV_POPULATE_WRITE) == 0) {
+    return true;
+  }
+  int err = errno;
+  if (err == EINVAL) {
+    _madv_populate_write_unsupported = true;
+  } else {
+    log_info(os)("madvise(MADV_POPULATE_WRITE) failed for " PTR_FORMAT " - " PTR_FORMAT
+                 "; error='%s' (errno=%d)", p2i(first), p2i(last), os::strerror(err), err);
+  }
+  return false;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   // This method works by doing an mmap over an existing mmaping and effectively discarding
   // the existing pages. However it won't work for SHM-based large pages that cannot be
@@ -3445,6 +3477,29 @@ bool os::unguard_memory(char* addr, size_t size) {
   return linux_mprotect(addr, size, PROT_READ|PROT_WRITE);
 }
 
+// Returns the system-wide THP mode selected in
+// /sys/kernel/mm/transparent_hugepage/enabled ("always", "madvise" or
+// "never"), or NULL if it cannot be determined.
+static const char* transparent_huge_pages_mode() {
+  FILE* f = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+  if (f == NULL) {
+    return NULL;
+  }
+  const char* mode = NULL;
+  char buf[64];
+  if (fgets(buf, sizeof(buf), f) != NULL) {
+    if (strstr(buf, "[always]") != NULL) {
+      mode = "always";
+    } else if (strstr(buf, "[madvise]") != NULL) {
+      mode = "madvise";
+    } else if (strstr(buf, "[never]") != NULL) {
+      mode = "never";
+    }
+  }
+  fclose(f);
+  return mode;
+}
+
 bool os::Linux::transparent_huge_pages_sanity_check(bool warn,
                                                     size_t page_size) {
   bool result = false;
@@ -3459,6 +3514,14 @@ bool os::Linux::transparent_huge_pages_sanity_check(bool warn,
     munmap(p, page_size * 2);
   }
 
+  // madvise(MADV_HUGEPAGE) succeeds even if THP has been disabled
+  // system-wide, in which case it has no effect.
+  const char* mode = transparent_huge_pages_mode();
+  log_info(pagesize)("Transparent huge pages mode: %s", mode != NULL ? mode : "unknown");
+  if (result && mode != NULL && strcmp(mode, "never") == 0) {
+    result = false;
+  }
+
   if (warn && !result) {
     warning("TransparentHugePages is not supported by the operating system.");
   }
@@ -5021,6 +5084,64 @@ static jlong fast_cpu_time(Thread *thread) {
     }
 }
 
+// The clockid returned by pthread_getcpuclockid() encodes the thread and
+// the kind of clock. This encoding is not documented by glibc, but it is
+// the kernel ABI that glibc itself relies on (MAKE_THREAD_CPUCLOCK in
+// include/linux/posix-timers.h, unchanged since Linux 2.6.12):
+//   bits 0-1: the kind, CPUCLOCK_PROF (0), CPUCLOCK_VIRT (1) or
+//             CPUCLOCK_SCHED (2, what glibc returns)
+//   bit 2:    CPUCLOCK_PERTHREAD_MASK, set for a thread clock
+//   bits 3-:  the bitwise complement of the tid, where tid 0 denotes
+//             the calling thread
+// Replacing the kind with CPUCLOCK_VIRT yields a clock that reports user
+// time only, which avoids reading and parsing /proc/self/task/<tid>/stat
+// for user-only queries.
+static const clockid_t CPUCLOCK_KIND_MASK       = 3;
+static const clockid_t CPUCLOCK_VIRT            = 1;
+static const clockid_t CPUCLOCK_SCHED           = 2;
+static const clockid_t CPUCLOCK_PERTHREAD_MASK  = 4;
+
+// CPUCLOCK_VIRT reports the raw, tick-sampled utime, which can run ahead
+// of the precise user+sys time of the CPUCLOCK_SCHED clock. /proc scales
+// utime so that it never does, and so callers expect user time not to
+// exceed the total CPU time. Clamping keeps that, and since both clocks
+// are monotonic the result is monotonic too.
+static jlong read_cpu_clock(clockid_t clockid) {
+  struct timespec tp;
+  if (clock_gettime(clockid, &tp) != 0) {
+    return -1;
+  }
+  return (tp.tv_sec * NANOSECS_PER_SEC) + tp.tv_nsec;
+}
+
+static jlong user_cpu_time_from_clockid(clockid_t clockid) {
+  jlong user_time = read_cpu_clock((clockid & ~CPUCLOCK_KIND_MASK) | CPUCLOCK_VIRT);
+  jlong cpu_time = read_cpu_clock((clockid & ~CPUCLOCK_KIND_MASK) | CPUCLOCK_SCHED);
+  if (user_time == -1 || cpu_time == -1) {
+    return -1;
+  }
+  return MIN2(user_time, cpu_time);
+}
+
+static jlong fast_user_cpu_time(Thread *thread) {
+  clockid_t clockid;
+  if (thread == Thread::current()) {
+    // The CPUCLOCK_SCHED clock of tid 0, i.e. the calling thread.
+    clockid = (clockid_t)(~0u << 3) | CPUCLOCK_PERTHREAD_MASK | CPUCLOCK_SCHED;
+  } else {
+    int rc = os::Linux::pthread_getcpuclockid(thread->osthread()->pthread_id(),
+                                              &clockid);
+    if (rc != 0) {
+      return slow_thread_cpu_time(thread, false /* user only */);
+    }
+  }
+  jlong result = user_cpu_time_from_clockid(clockid);
+  if (result == -1) {
+    result = slow_thread_cpu_time(thread, false /* user only */);
+  }
+  return result;
+}
+
 // current_thread_cpu_time(bool) and thread_cpu_time(Thread*, bool)
 // are used by JVM M&M and JVMTI to get user+sys or user CPU time
 // of a thread.
@@ -5049,6 +5170,8 @@ jlong os::thread_cpu_time(Thread* thread) {
 jlong os::current_thread_cpu_time(bool user_sys_cpu_time) {
   if (user_sys_cpu_time && os::Linux::supports_fast_thread_cpu_time()) {
     return os::Linux::fast_thread_cpu_time(CLOCK_THREAD_CPUTIME_ID);
+  } else if (os::Linux::supports_fast_thread_cpu_time()) {
+    return fast_user_cpu_time(Thread::current());
   } else {
     return slow_thread_cpu_time(Thread::current(), user_sys_cpu_time);
   }
@@ -5057,6 +5180,8 @@ jlong os::current_thread_cpu_time(bool user_sys_cpu_time) {
 jlong os::thread_cpu_time(Thread *thread, bool user_sys_cpu_time) {
   if (user_sys_cpu_time && os::Linux::supports_fast_thread_cpu_time()) {
     return fast_cpu_time(thread);
+  } else if (os::Linux::supports_fast_thread_cpu_time()) {
+    return fast_user_cpu_time(thread);
   } else {
     return slow_thread_cpu_time(thread, user_sys_cpu_time);
   }
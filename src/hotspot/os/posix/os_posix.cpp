@@ -1776,6 +1776,15 @@ void Parker::park(bool isAbsolute, jlong time) {
 }
 
 void Parker::unpark() {
+  // Fast path: a permit is already available, so this unpark cannot
+  // change anything. The fence orders the caller's prior stores before
+  // the load of _counter; it pairs with the full barrier of the xchg in
+  // park(), so the thread consuming this permit also sees those stores.
+  OrderAccess::fence();
+  if (Atomic::load(&_counter) > 0) {
+    return;
+  }
+
   int status = pthread_mutex_lock(_mutex);
   assert_status(status == 0, status, "invariant");
   const int s = _counter;
@@ -119,7 +119,14 @@ inline T Atomic::PlatformXchg<4>::operator()(T volatile* dest,
                                              T exchange_value,
                                              atomic_memory_order order) const {
   STATIC_ASSERT(4 == sizeof(T));
-  T old_value = atomic_fastcall(aarch64_atomic_xchg_4_impl, dest, exchange_value);
+  aarch64_atomic_stub_t stub;
+  switch (order) {
+  case memory_order_relaxed:
+    stub = aarch64_atomic_xchg_4_relaxed_impl; break;
+  default:
+    stub = aarch64_atomic_xchg_4_impl; break;
+  }
+  T old_value = atomic_fastcall(stub, dest, exchange_value);
   return old_value;
 }
 
@@ -128,7 +135,14 @@ template<typename T>
 inline T Atomic::PlatformXchg<8>::operator()(T volatile* dest, T exchange_value,
                                              atomic_memory_order order) const {
   STATIC_ASSERT(8 == sizeof(T));
-  T old_value = atomic_fastcall(aarch64_atomic_xchg_8_impl, dest, exchange_value);
+  aarch64_atomic_stub_t stub;
+  switch (order) {
+  case memory_order_relaxed:
+    stub = aarch64_atomic_xchg_8_relaxed_impl; break;
+  default:
+    stub = aarch64_atomic_xchg_8_impl; break;
+  }
+  T old_value = atomic_fastcall(stub, dest, exchange_value);
   return old_value;
 }
 
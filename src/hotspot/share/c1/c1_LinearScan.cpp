@@ -32,6 +32,7 @@
 #include "c1/c1_LinearScan.hpp"
 #include "c1/c1_ValueStack.hpp"
 #include "code/vmreg.inline.hpp"
+#include "compiler/compileLog.hpp"
 #include "runtime/timerTrace.hpp"
 #include "utilities/bitMap.inline.hpp"
 
@@ -61,6 +62,29 @@
   #define TRACE_LINEAR_SCAN(level, code)
 #endif
 
+// Reports one step of the allocator as a nested phase in the
+// CompileLog, so that slow steps also show up in product builds.
+class LinearScanPhase : public StackObj {
+ private:
+  CompileLog* _log;
+  const char* _name;
+
+ public:
+  LinearScanPhase(const char* name) : _log(Compilation::current()->log()), _name(name) {
+    if (_log != NULL) {
+      _log->begin_head("phase name='%s'", _name);
+      _log->stamp();
+      _log->end_head();
+    }
+  }
+
+  ~LinearScanPhase() {
+    if (_log != NULL) {
+      _log->done("phase name='%s'", _name);
+    }
+  }
+};
+
 // Map BasicType to spill size in 32-bit words, matching VMReg's notion of words
 #ifdef _LP64
 static int type2spill_size[T_CONFLICT+1]={ -1, 0, 0, 0, 1, 1, 1, 2, 1, 1, 1, 2, 2, 2, 0, 2,  1, 2, 1, -1};
@@ -3087,23 +3111,31 @@ void LinearScan::do_linear_scan() {
 
   NOT_PRODUCT(print_lir(1, "Before Register Allocation"));
 
-  compute_local_live_sets();
-  compute_global_live_sets();
+  { LinearScanPhase phase("lsLiveSets");
+    compute_local_live_sets();
+    compute_global_live_sets();
+  }
   CHECK_BAILOUT();
 
-  build_intervals();
+  { LinearScanPhase phase("lsBuildIntervals");
+    build_intervals();
+  }
   CHECK_BAILOUT();
   sort_intervals_before_allocation();
 
   NOT_PRODUCT(print_intervals("Before Register Allocation"));
   NOT_PRODUCT(LinearScanStatistic::compute(this, _stat_before_alloc));
 
-  allocate_registers();
+  { LinearScanPhase phase("lsAllocateRegisters");
+    allocate_registers();
+  }
   CHECK_BAILOUT();
 
-  resolve_data_flow();
-  if (compilation()->has_exception_handlers()) {
-    resolve_exception_handlers();
+  { LinearScanPhase phase("lsResolveDataFlow");
+    resolve_data_flow();
+    if (compilation()->has_exception_handlers()) {
+      resolve_exception_handlers();
+    }
   }
   // fill in number of spill slots into frame_map
   propagate_spill_slots();
@@ -3116,8 +3148,10 @@ void LinearScan::do_linear_scan() {
 
   DEBUG_ONLY(verify());
 
-  eliminate_spill_moves();
-  assign_reg_num();
+  { LinearScanPhase phase("lsAssignRegNum");
+    eliminate_spill_moves();
+    assign_reg_num();
+  }
   CHECK_BAILOUT();
 
   NOT_PRODUCT(print_lir(2, "LIR after assignment of register numbers:"));
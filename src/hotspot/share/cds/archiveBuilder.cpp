@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "cds/archiveBuilder.hpp"
 #include "cds/archiveUtils.hpp"
+#include "cds/archivedMethodProfiles.hpp"
 #include "cds/cppVtables.hpp"
 #include "cds/dumpAllocStats.hpp"
 #include "cds/metaspaceShared.hpp"
@@ -302,8 +303,10 @@ void ArchiveBuilder::sort_klasses() {
 
 size_t ArchiveBuilder::estimate_archive_size() {
   // size of the symbol table and two dictionaries, plus the RunTimeClassInfo's
+  // and the method profiles
   size_t symbol_table_est = SymbolTable::estimate_size_for_archive();
-  size_t dictionary_est = SystemDictionaryShared::estimate_size_for_archive();
+  size_t dictionary_est = SystemDictionaryShared::estimate_size_for_archive() +
+                          ArchivedMethodProfiles::estimate_size_for_archive(klasses());
   _estimated_hashtable_bytes = symbol_table_est + dictionary_est;
 
   size_t total = 0;
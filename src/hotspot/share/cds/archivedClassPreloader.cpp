@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "cds/archivedClassPreloader.hpp"
+#include "classfile/javaClasses.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "classfile/systemDictionaryShared.hpp"
+#include "logging/log.hpp"
+#include "memory/iterator.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "prims/jvmtiExport.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/java.hpp"
+#include "runtime/os.hpp"
+
+GrowableArrayCHeap<InstanceKlass*, mtClassShared>* ArchivedClassPreloader::_classes = nullptr;
+volatile int ArchivedClassPreloader::_next = 0;
+volatile int ArchivedClassPreloader::_active_threads = 0;
+volatile int ArchivedClassPreloader::_loaded = 0;
+jlong ArchivedClassPreloader::_start_time = 0;
+
+// Number of classes a preload thread claims at a time.
+static const int PreloadChunkSize = 32;
+
+void ArchivedClassPreloader::initialize(TRAPS) {
+  if (!UseSharedSpaces || ArchivedClassPreloadThreads == 0) {
+    return;
+  }
+  // Class load and prepare events would be posted from the hidden preload threads.
+  if (should_stop()) {
+    log_info(cds)("Archived class preloading disabled by JVMTI");
+    return;
+  }
+
+  _start_time = os::javaTimeNanos();
+  collect_classes();
+  if (_classes->is_empty()) {
+    return;
+  }
+
+  // Count this thread as active until all preload threads have been started, so
+  // the last one to finish can't be mistaken about being the last.
+  _active_threads = 1;
+  uint started = 0;
+  for (uint i = 0; i < ArchivedClassPreloadThreads; i++) {
+    char name[64];
+    jio_snprintf(name, sizeof(name), "CDS Preload Thread#%u", i);
+    Handle thread_oop = JavaThread::create_system_thread_object(name, false /* not visible */, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      // Leave the exception pending for the caller, but let the threads
+      // already started finish and release _classes.
+      break;
+    }
+
+    ArchivedClassPreloadThread* thread = new ArchivedClassPreloadThread(&thread_entry);
+    if (thread->osthread() == nullptr) {
+      // The new thread is not known to Thread-SMR yet so we can just delete.
+      delete thread;
+      break;
+    }
+    Atomic::inc(&_active_threads);
+    JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NormPriority);
+    started++;
+  }
+  log_info(cds)("Preloading %d archived boot classes with %u threads", _classes->length(), started);
+  thread_done();
+}
+
+class CollectBootClasses : public KlassClosure {
+  GrowableArrayCHeap<InstanceKlass*, mtClassShared>* _classes;
+ public:
+  CollectBootClasses(GrowableArrayCHeap<InstanceKlass*, mtClassShared>* classes) : _classes(classes) {}
+
+  void do_klass(Klass* k) {
+    InstanceKlass* ik = InstanceKlass::cast(k);
+    if (ik->is_shared_boot_class() && !ik->is_hidden()) {
+      _classes->append(ik);
+    }
+  }
+};
+
+void ArchivedClassPreloader::collect_classes() {
+  _classes = new GrowableArrayCHeap<InstanceKlass*, mtClassShared>(1024);
+  CollectBootClasses collector(_classes);
+  SystemDictionaryShared::archived_builtin_classes_do(&collector);
+}
+
+// Stop preloading if class loading is observed through JVMTI after the threads
+// have been started, e.g. by an agent enabling ClassLoad events in VMInit.
+// link_class() posts ClassPrepare, so that event counts as well.
+bool ArchivedClassPreloader::should_stop() {
+  return JvmtiExport::should_post_class_load() ||
+         JvmtiExport::should_post_class_file_load_hook() ||
+         JvmtiExport::should_post_class_prepare();
+}
+
+void ArchivedClassPreloader::preload_classes(JavaThread* current) {
+  JavaThread* THREAD = current;
+  int length = _classes->length();
+
+  while (!should_stop()) {
+    int start = Atomic::fetch_and_add(&_next, PreloadChunkSize);
+    if (start >= length) {
+      break;
+    }
+    int end = MIN2(start + PreloadChunkSize, length);
+    for (int i = start; i < end; i++) {
+      HandleMark hm(THREAD);
+      InstanceKlass* ik = _classes->at(i);
+      // Loads the class and its supertypes through the boot loader, which supports
+      // parallel loading. Nothing is done if the class has been loaded already.
+      Klass* k = SystemDictionary::resolve_or_null(ik->name(), Handle(), Handle(), THREAD);
+      if (HAS_PENDING_EXCEPTION) {
+        // Leave it to the regular class loading to report the error.
+        CLEAR_PENDING_EXCEPTION;
+        continue;
+      }
+      if (k != ik) {
+        // Not the archived class, e.g. because of a module patch.
+        continue;
+      }
+      ik->link_class(THREAD);
+      if (HAS_PENDING_EXCEPTION) {
+        CLEAR_PENDING_EXCEPTION;
+        continue;
+      }
+      Atomic::inc(&_loaded);
+    }
+  }
+}
+
+void ArchivedClassPreloader::thread_done() {
+  if (Atomic::sub(&_active_threads, 1) == 0) {
+    log_info(cds)("Preloaded %d of %d archived boot classes in " JLONG_FORMAT " ms",
+                  Atomic::load(&_loaded), _classes->length(),
+                  (os::javaTimeNanos() - _start_time) / NANOSECS_PER_MILLISEC);
+    delete _classes;
+    _classes = nullptr;
+  }
+}
+
+void ArchivedClassPreloader::thread_entry(JavaThread* thread, TRAPS) {
+  preload_classes(thread);
+  thread_done();
+}
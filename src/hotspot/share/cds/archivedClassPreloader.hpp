@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#ifndef SHARE_CDS_ARCHIVEDCLASSPRELOADER_HPP
+#define SHARE_CDS_ARCHIVEDCLASSPRELOADER_HPP
+
+#include "memory/allStatic.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/exceptions.hpp"
+#include "utilities/growableArray.hpp"
+
+class InstanceKlass;
+
+// Loads and links the boot classes of the CDS archives on ArchivedClassPreloadThreads
+// background threads during startup, so the main thread finds most of the classes it
+// needs already loaded. Only loading and linking are done ahead of time; classes are
+// still initialized on first active use, in the order the application uses them.
+//
+// Classes of the platform and app loaders are not preloaded: loading them goes through
+// the Java code of the loaders, which must not run before the application asks for it.
+class ArchivedClassPreloader : AllStatic {
+  friend class ArchivedClassPreloadThread;
+
+  static GrowableArrayCHeap<InstanceKlass*, mtClassShared>* _classes;
+  static volatile int _next;          // index of the next unclaimed class in _classes
+  static volatile int _active_threads;
+  static volatile int _loaded;
+  static jlong _start_time;
+
+  static void collect_classes();
+  static bool should_stop();
+  static void preload_classes(JavaThread* current);
+  static void thread_done();
+  static void thread_entry(JavaThread* thread, TRAPS);
+
+ public:
+  // Starts the preload threads. Called after the module system has been initialized.
+  static void initialize(TRAPS) NOT_CDS_RETURN;
+};
+
+// A hidden from external view JavaThread loading archived classes.
+class ArchivedClassPreloadThread : public JavaThread {
+  friend class ArchivedClassPreloader;
+  ArchivedClassPreloadThread(ThreadFunction entry_point) : JavaThread(entry_point) {};
+
+ public:
+  // Hide this thread from external view.
+  bool is_hidden_from_external_view() const { return true; }
+};
+
+#endif // SHARE_CDS_ARCHIVEDCLASSPRELOADER_HPP
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "cds/archiveBuilder.hpp"
+#include "cds/archiveUtils.hpp"
+#include "cds/archivedMethodProfiles.hpp"
+#include "interpreter/invocationCounter.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
+#include "oops/methodCounters.hpp"
+#include "runtime/globals.hpp"
+#include "utilities/growableArray.hpp"
+
+Array<ArchivedMethodProfile>* ArchivedMethodProfiles::_profiles = NULL;
+
+static bool has_profile(Method* m) {
+  return m->method_counters() != NULL &&
+         (m->invocation_count() > 0 || m->backedge_count() > 0);
+}
+
+size_t ArchivedMethodProfiles::estimate_size_for_archive(GrowableArray<Klass*>* klasses) {
+  if (!ArchiveMethodProfiles || !DynamicDumpSharedSpaces) {
+    return 0;
+  }
+  int count = 0;
+  for (int i = 0; i < klasses->length(); i++) {
+    Klass* k = klasses->at(i);
+    if (k->is_instance_klass()) {
+      count += InstanceKlass::cast(k)->methods()->length();
+    }
+  }
+  return align_up(sizeof(Array<ArchivedMethodProfile>) + count * sizeof(ArchivedMethodProfile),
+                  SharedSpaceObjectAlignment);
+}
+
+int ArchivedMethodProfiles::compare_by_address(ArchivedMethodProfile* a, ArchivedMethodProfile* b) {
+  if (a->_method < b->_method) {
+    return -1;
+  } else if (a->_method > b->_method) {
+    return 1;
+  }
+  return 0;
+}
+
+void ArchivedMethodProfiles::write_to_archive(GrowableArray<Klass*>* klasses) {
+  assert(DynamicDumpSharedSpaces, "profiles are only archived in the dynamic archive");
+  _profiles = NULL;
+  if (!ArchiveMethodProfiles) {
+    return;
+  }
+
+  ResourceMark rm;
+  ArchiveBuilder* builder = ArchiveBuilder::current();
+  GrowableArray<ArchivedMethodProfile> profiles;
+  for (int i = 0; i < klasses->length(); i++) {
+    Klass* k = klasses->at(i);
+    if (!k->is_instance_klass()) {
+      continue;
+    }
+    Array<Method*>* methods = InstanceKlass::cast(k)->methods();
+    for (int j = 0; j < methods->length(); j++) {
+      Method* m = methods->at(j);
+      if (has_profile(m)) {
+        ArchivedMethodProfile p;
+        p._method = (Method*)builder->get_dumped_addr((address)m);
+        p._invocation_count = (u4)m->invocation_count();
+        p._backedge_count = (u4)m->backedge_count();
+        profiles.append(p);
+      }
+    }
+  }
+  if (profiles.is_empty()) {
+    return;
+  }
+
+  // Sort by the buffered address. All buffered objects are moved to the
+  // requested address, and then to the mapped address, by the same delta.
+  profiles.sort(compare_by_address);
+
+  _profiles = ArchiveBuilder::new_ro_array<ArchivedMethodProfile>(profiles.length());
+  for (int i = 0; i < profiles.length(); i++) {
+    ArchivedMethodProfile* p = _profiles->adr_at(i);
+    *p = profiles.at(i);
+    ArchivePtrMarker::mark_pointer(&p->_method);
+  }
+  log_info(cds, dynamic)("Archived the profiles of %d methods", profiles.length());
+}
+
+void ArchivedMethodProfiles::serialize(SerializeClosure* soc) {
+  soc->do_ptr((void**)&_profiles);
+}
+
+const ArchivedMethodProfile* ArchivedMethodProfiles::find(const Method* m) {
+  int low = 0;
+  int high = _profiles->length() - 1;
+  while (low <= high) {
+    int mid = low + (high - low) / 2;
+    const ArchivedMethodProfile* p = _profiles->adr_at(mid);
+    if (p->method() < m) {
+      low = mid + 1;
+    } else if (p->method() > m) {
+      high = mid - 1;
+    } else {
+      return p;
+    }
+  }
+  return NULL;
+}
+
+void ArchivedMethodProfiles::initialize_counters(const Method* m, MethodCounters* mcs) {
+  if (!ArchiveMethodProfiles || _profiles == NULL) {
+    return;
+  }
+  const ArchivedMethodProfile* p = find(m);
+  if (p != NULL) {
+    // Stay below the limit so the counters don't start out with the carry set.
+    const uint limit = InvocationCounter::count_limit - 1;
+    mcs->invocation_counter()->set(MIN2((uint)p->invocation_count(), limit));
+    mcs->backedge_counter()->set(MIN2((uint)p->backedge_count(), limit));
+    if (log_is_enabled(Debug, cds)) {
+      ResourceMark rm;
+      log_debug(cds)("Seeded the counters of %s: invocations %u, backedges %u",
+                     m->name_and_sig_as_C_string(), p->invocation_count(), p->backedge_count());
+    }
+  }
+}
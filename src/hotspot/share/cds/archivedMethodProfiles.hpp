@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CDS_ARCHIVEDMETHODPROFILES_HPP
+#define SHARE_CDS_ARCHIVEDMETHODPROFILES_HPP
+
+#include "memory/allStatic.hpp"
+#include "oops/array.hpp"
+#include "utilities/macros.hpp"
+
+class Klass;
+class Method;
+class MethodCounters;
+class SerializeClosure;
+template <class E> class GrowableArray;
+
+// The invocation and backedge counts that a method had reached when the
+// dynamic archive was dumped with -XX:+ArchiveMethodProfiles.
+class ArchivedMethodProfile {
+  friend class ArchivedMethodProfiles;
+  Method* _method;            // the archived method; relocated with the archive
+  u4      _invocation_count;
+  u4      _backedge_count;
+ public:
+  Method* method()           const { return _method; }
+  u4      invocation_count() const { return _invocation_count; }
+  u4      backedge_count()   const { return _backedge_count; }
+};
+
+// Carries the warm-up state of the methods of a dynamic archive over to the
+// next run. Only the counters are archived: MethodData holds Klass* and
+// Method* references into the type profiles that cannot be validated before
+// the classes they name are loaded again. Seeding the counters lets the
+// tiered policy pick the methods that were hot in the training run as soon
+// as they are first invoked, instead of waiting for them to warm up again.
+//
+// The profiles are sorted by the address of their Method*. The archive is
+// relocated by a constant delta, so the order holds at runtime as well and
+// lookups can use a binary search.
+class ArchivedMethodProfiles : AllStatic {
+  static Array<ArchivedMethodProfile>* _profiles;
+
+  static int compare_by_address(ArchivedMethodProfile* a, ArchivedMethodProfile* b);
+  static const ArchivedMethodProfile* find(const Method* m);
+
+ public:
+  // Dump time
+  static size_t estimate_size_for_archive(GrowableArray<Klass*>* klasses) NOT_CDS_RETURN_(0);
+  static void write_to_archive(GrowableArray<Klass*>* klasses) NOT_CDS_RETURN;
+
+  // Dump time and runtime
+  static void serialize(SerializeClosure* soc) NOT_CDS_RETURN;
+
+  // Runtime: seeds the counters of a newly created MethodCounters of a shared method.
+  static void initialize_counters(const Method* m, MethodCounters* mcs) NOT_CDS_RETURN;
+};
+
+#endif // SHARE_CDS_ARCHIVEDMETHODPROFILES_HPP
@@ -26,6 +26,7 @@
 #include "jvm.h"
 #include "cds/archiveBuilder.hpp"
 #include "cds/archiveUtils.inline.hpp"
+#include "cds/archivedMethodProfiles.hpp"
 #include "cds/dynamicArchive.hpp"
 #include "cds/lambdaFormInvokers.hpp"
 #include "cds/metaspaceShared.hpp"
@@ -41,6 +42,7 @@
 #include "memory/resourceArea.hpp"
 #include "oops/klass.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/globals_extension.hpp"
 #include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/vmThread.hpp"
@@ -148,11 +150,13 @@ public:
 
       ArchiveBuilder::OtherROAllocMark mark;
       SystemDictionaryShared::write_to_archive(false);
+      ArchivedMethodProfiles::write_to_archive(klasses());
 
       serialized_data = ro_region()->top();
       WriteClosure wc(ro_region());
       SymbolTable::serialize_shared_table_header(&wc, false);
       SystemDictionaryShared::serialize_dictionary_headers(&wc, false);
+      ArchivedMethodProfiles::serialize(&wc);
     }
 
     verify_estimate_size(_estimated_hashtable_bytes, "Hashtables");
@@ -370,6 +374,15 @@ void DynamicArchive::check_for_dynamic_dump() {
     // - SharedArchiveFile points to an archive that has failed CRC check
     // - SharedArchiveFile is not specified and the VM doesn't have a compatible default archive
 
+    if (AutoCreateSharedArchive) {
+      // The archive is only an optimization here, so just run without it.
+      log_warning(cds)("-XX:+AutoCreateSharedArchive is ignored because the base CDS archive is not loaded");
+      FLAG_SET_ERGO(AutoCreateSharedArchive, false);
+      FLAG_SET_ERGO(ArchiveClassesAtExit, (ccstr)NULL);
+      DynamicDumpSharedSpaces = false;
+      return;
+    }
+
 #define __THEMSG " is unsupported when base CDS archive is not loaded. Run with -Xlog:cds for more info."
     if (RecordDynamicDumpInfo) {
       vm_exit_during_initialization("-XX:+RecordDynamicDumpInfo" __THEMSG, NULL);
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "jvm_io.h"
 #include "cds/archiveBuilder.hpp"
+#include "cds/archivedMethodProfiles.hpp"
 #include "cds/cdsProtectionDomain.hpp"
 #include "cds/classListWriter.hpp"
 #include "cds/classListParser.hpp"
@@ -65,6 +66,7 @@
 #include "oops/oopHandle.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/globals_extension.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/os.hpp"
 #include "runtime/safepointVerifiers.hpp"
@@ -948,6 +950,20 @@ void MetaspaceShared::initialize_runtime_shared_and_meta_spaces() {
       FileMapInfo::set_shared_path_table(dynamic_mapinfo);
     } else {
       FileMapInfo::set_shared_path_table(static_mapinfo);
+      if (AutoCreateSharedArchive && Arguments::GetSharedDynamicArchivePath() != NULL &&
+          static_mapinfo->app_class_paths_start_index() <= 1 &&
+          static_mapinfo->num_module_paths() == 0) {
+        // The dynamic archive exists but cannot be used, e.g. it was created
+        // by a different JVM, on top of a different base archive or with a
+        // different class path. Recreate it on top of the mapped base archive
+        // at exit. As in FileMapInfo::validate_shared_path_table(), this needs
+        // a base archive without appended boot class path or module path.
+        log_info(cds)("Dynamic archive %s will be recreated at exit", Arguments::GetSharedDynamicArchivePath());
+        FLAG_SET_ERGO(ArchiveClassesAtExit, Arguments::GetSharedDynamicArchivePath());
+        DynamicDumpSharedSpaces = true;
+        // Always verify non-system classes during CDS dump
+        BytecodeVerificationRemote = true;
+      }
     }
   } else {
     set_shared_metaspace_range(NULL, NULL, NULL);
@@ -1446,6 +1462,7 @@ void MetaspaceShared::initialize_shared_spaces() {
     ReadClosure rc(&buffer);
     SymbolTable::serialize_shared_table_header(&rc, false);
     SystemDictionaryShared::serialize_dictionary_headers(&rc, false);
+    ArchivedMethodProfiles::serialize(&rc);
     dynamic_mapinfo->close();
     dynamic_mapinfo->unmap_region(MetaspaceShared::bm);
   }
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "cds/filemap.hpp"
+#include "cds/precompileList.hpp"
+#include "classfile/classLoader.hpp"
+#include "classfile/classLoaderData.inline.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "code/codeCache.hpp"
+#include "compiler/compilationPolicy.hpp"
+#include "compiler/compileBroker.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+
+static const char* PRECOMPILE_LIST_TAG = "# PrecompileList v2";
+
+class PrecompileEntry {
+ public:
+  Symbol* _name;
+  Symbol* _signature;
+  int     _level;
+  int     _loader_type;
+};
+
+typedef GrowableArrayCHeap<PrecompileEntry, mtCompiler> PrecompileEntries;
+
+// Keyed by class name; the entries also record the loader of the class. The
+// Symbols are kept alive for the lifetime of the VM.
+typedef ResourceHashtable<Symbol*, PrecompileEntries*, 1009,
+                          ResourceObj::C_HEAP, mtCompiler> PrecompileTable;
+
+static PrecompileTable* _table = NULL;
+bool PrecompileList::_is_loaded = false;
+
+static int archive_crc(FileMapInfo* info) {
+  return info != NULL ? info->crc() : 0;
+}
+
+// Only methods of classes defined by the built-in loaders are listed. A class
+// with the same name defined by another loader is a different class.
+static int builtin_loader_type(InstanceKlass* ik) {
+  ClassLoaderData* cld = ik->class_loader_data();
+  if (cld->is_boot_class_loader_data()) {
+    return ClassLoader::BOOT_LOADER;
+  } else if (cld->is_platform_class_loader_data()) {
+    return ClassLoader::PLATFORM_LOADER;
+  } else if (cld->is_system_class_loader_data()) {
+    return ClassLoader::APP_LOADER;
+  }
+  return 0;
+}
+
+class CompiledMethodRecord {
+ public:
+  Method* _method;
+  int     _level;
+  int     _loader_type;
+};
+
+void PrecompileList::dump_at_exit() {
+  const char* path = ArchiveCompiledMethodsAtExit;
+  if (!UseSharedSpaces) {
+    log_warning(cds)("ArchiveCompiledMethodsAtExit is ignored: the CDS archive is not in use");
+    return;
+  }
+  fileStream fs(path, "w");
+  if (!fs.is_open()) {
+    log_warning(cds)("Failed to create %s for the compiled methods", path);
+    return;
+  }
+  fs.print_cr("%s %d %d", PRECOMPILE_LIST_TAG,
+              archive_crc(FileMapInfo::current_info()), archive_crc(FileMapInfo::dynamic_info()));
+
+  // Collect the methods under the CodeCache_lock and write them afterwards.
+  // The classes of the built-in loaders are never unloaded, so the Methods
+  // stay valid.
+  ResourceMark rm;
+  GrowableArray<CompiledMethodRecord> records;
+  {
+    MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    NMethodIterator iter(NMethodIterator::only_alive_and_not_unloading);
+    while (iter.next()) {
+      nmethod* nm = iter.method();
+      Method* m = nm->method();
+      if (!nm->is_in_use() || nm->is_osr_method() || m->is_native() ||
+          !m->method_holder()->is_shared()) {
+        continue;
+      }
+      int loader_type = builtin_loader_type(m->method_holder());
+      if (loader_type == 0) {
+        continue;
+      }
+      CompiledMethodRecord r;
+      r._method = m;
+      r._level = nm->comp_level();
+      r._loader_type = loader_type;
+      records.append(r);
+    }
+  }
+
+  for (int i = 0; i < records.length(); i++) {
+    const CompiledMethodRecord& r = records.at(i);
+    fs.print_cr("%d %d %s %s %s", r._level, r._loader_type, r._method->klass_name()->as_C_string(),
+                r._method->name()->as_C_string(), r._method->signature()->as_C_string());
+  }
+  log_info(cds)("Wrote %d compiled methods to %s", records.length(), path);
+}
+
+bool PrecompileList::parse(const char* path) {
+  FILE* file = os::fopen(path, "r");
+  if (file == NULL) {
+    log_warning(cds)("Failed to open the compiled method list %s", path);
+    return false;
+  }
+
+  char line[4096];
+  int static_crc = 0;
+  int dynamic_crc = 0;
+  if (fgets(line, sizeof(line), file) == NULL ||
+      strncmp(line, PRECOMPILE_LIST_TAG, strlen(PRECOMPILE_LIST_TAG)) != 0 ||
+      sscanf(line + strlen(PRECOMPILE_LIST_TAG), "%d %d", &static_crc, &dynamic_crc) != 2) {
+    log_warning(cds)("%s is not a compiled method list", path);
+    fclose(file);
+    return false;
+  }
+  if (static_crc != archive_crc(FileMapInfo::current_info()) ||
+      dynamic_crc != archive_crc(FileMapInfo::dynamic_info())) {
+    log_warning(cds)("The compiled method list %s was written with different CDS archives", path);
+    fclose(file);
+    return false;
+  }
+
+  _table = new (ResourceObj::C_HEAP, mtCompiler) PrecompileTable();
+  int count = 0;
+  char klass_name[sizeof(line)];
+  char name[sizeof(line)];
+  char signature[sizeof(line)];
+  while (fgets(line, sizeof(line), file) != NULL) {
+    int level;
+    int loader_type;
+    if (sscanf(line, "%d %d %s %s %s", &level, &loader_type, klass_name, name, signature) != 5 ||
+        !is_compile(level) || loader_type < ClassLoader::BOOT_LOADER || loader_type > ClassLoader::APP_LOADER) {
+      continue;
+    }
+    bool created;
+    Symbol* klass_sym = SymbolTable::new_symbol(klass_name);
+    PrecompileEntries** entries = _table->put_if_absent(klass_sym, NULL, &created);
+    if (created) {
+      *entries = new PrecompileEntries(4);
+    } else {
+      klass_sym->decrement_refcount();
+    }
+    PrecompileEntry e;
+    e._name = SymbolTable::new_symbol(name);
+    e._signature = SymbolTable::new_symbol(signature);
+    e._level = level;
+    e._loader_type = loader_type;
+    (*entries)->append(e);
+    count++;
+  }
+  fclose(file);
+  log_info(cds)("Read %d compiled methods from %s", count, path);
+  return true;
+}
+
+class InitializedClassCollector : StackObj {
+  GrowableArray<InstanceKlass*> _classes;
+ public:
+  GrowableArray<InstanceKlass*>* classes() { return &_classes; }
+
+  bool do_entry(Symbol* const& klass_name, PrecompileEntries* const& entries) {
+    InstanceKlass* ik = SystemDictionary::find_instance_klass(klass_name, Handle(), Handle());
+    if (ik != NULL && ik->is_shared() && ik->is_initialized()) {
+      _classes.append(ik);
+    }
+    return true; // continue iteration
+  }
+};
+
+void PrecompileList::initialize(JavaThread* current) {
+  if (SharedCompiledMethodsFile == NULL || !UseCompiler) {
+    return;
+  }
+  if (!UseSharedSpaces) {
+    log_warning(cds)("SharedCompiledMethodsFile is ignored: the CDS archive is not in use");
+    return;
+  }
+  if (!parse(SharedCompiledMethodsFile)) {
+    return;
+  }
+  _is_loaded = true;
+
+  ResourceMark rm(current);
+  // Boot classes initialized before the compilers were up won't go through
+  // class_initialized(), so catch up with them here.
+  InitializedClassCollector collector;
+  _table->iterate(&collector);
+  for (int i = 0; i < collector.classes()->length(); i++) {
+    compile_methods_of(collector.classes()->at(i), current);
+  }
+}
+
+void PrecompileList::class_initialized(InstanceKlass* ik, JavaThread* current) {
+  if (_is_loaded) {
+    compile_methods_of(ik, current);
+  }
+}
+
+void PrecompileList::compile_methods_of(InstanceKlass* ik, JavaThread* current) {
+  if (!ik->is_shared()) {
+    return;
+  }
+  PrecompileEntries** entries = _table->get(ik->name());
+  if (entries == NULL) {
+    return;
+  }
+  int loader_type = builtin_loader_type(ik);
+  for (int i = 0; i < (*entries)->length(); i++) {
+    const PrecompileEntry& e = (*entries)->at(i);
+    if (e._loader_type != loader_type) {
+      continue;
+    }
+    Method* m = ik->find_method(e._name, e._signature);
+    if (m == NULL) {
+      continue;
+    }
+    methodHandle mh(current, m);
+    int level = MIN2(e._level, (int)CompilationPolicy::highest_compile_level());
+    if (mh->code() != NULL || !CompilationPolicy::can_be_compiled(mh, level)) {
+      continue;
+    }
+    if (log_is_enabled(Debug, cds)) {
+      ResourceMark rm(current);
+      log_debug(cds)("Precompiling %s at level %d", mh->name_and_sig_as_C_string(), level);
+    }
+    CompileBroker::compile_method(mh, InvocationEntryBci, level, methodHandle(), 0,
+                                  CompileTask::Reason_Precompile, current);
+    if (current->has_pending_exception()) {
+      // The method stays interpreted; the regular policy may still compile it later.
+      current->clear_pending_exception();
+    }
+  }
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CDS_PRECOMPILELIST_HPP
+#define SHARE_CDS_PRECOMPILELIST_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/exceptions.hpp"
+#include "utilities/macros.hpp"
+
+class InstanceKlass;
+
+// A list of the archived methods that had been compiled when a previous run
+// exited, used to compile them again as soon as their classes are initialized.
+//
+// -XX:ArchiveCompiledMethodsAtExit=<file> writes the list, and
+// -XX:SharedCompiledMethodsFile=<file> reads it back. Each line holds the
+// compilation level, the loader type (see ClassLoader::BOOT_LOADER), the class
+// name, the method name and the signature of a method of a class from the CDS
+// archives. Only classes of the built-in loaders are listed. The first line
+// identifies the archives the run was using, and the list is ignored if the
+// current run maps different ones.
+//
+// The methods are compiled again rather than loaded as code: the compilers
+// record fresh dependencies against the classes of this run, so nothing from
+// the previous run needs to be revalidated before it is installed.
+class PrecompileList : AllStatic {
+  static bool _is_loaded;
+
+  static bool parse(const char* path);
+  static void compile_methods_of(InstanceKlass* ik, JavaThread* current);
+
+ public:
+  // Reads SharedCompiledMethodsFile. Called once the compilers are initialized.
+  static void initialize(JavaThread* current) NOT_CDS_RETURN;
+
+  // Writes the list to ArchiveCompiledMethodsAtExit.
+  static void dump_at_exit() NOT_CDS_RETURN;
+
+  // Submits the listed methods of a class that has just been initialized.
+  static void class_initialized(InstanceKlass* ik, JavaThread* current) NOT_CDS_RETURN;
+};
+
+#endif // SHARE_CDS_PRECOMPILELIST_HPP
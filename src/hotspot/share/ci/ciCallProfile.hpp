@@ -39,11 +39,12 @@ private:
   friend class ciMethodHandle;
 
   enum { MorphismLimit = 2 }; // Max call site's morphism we care about
+  enum { ReceiverLimit = 8 }; // Max receivers kept, see TypeProfileWidth
   int  _limit;                // number of receivers have been determined
   int  _morphism;             // determined call site's morphism
   int  _count;                // # times has this call been executed
-  int  _receiver_count[MorphismLimit + 1]; // # times receivers have been seen
-  ciKlass*  _receiver[MorphismLimit + 1];  // receivers (exact)
+  int  _receiver_count[ReceiverLimit + 1]; // # times receivers have been seen
+  ciKlass*  _receiver[ReceiverLimit + 1];  // receivers (exact)
 
   ciCallProfile() {
     _limit = 0;
@@ -62,15 +63,15 @@ public:
 
   int       count() const             { return _count; }
   int       receiver_count(int i)  {
-    assert(i < _limit, "out of Call Profile MorphismLimit");
+    assert(i < _limit, "out of Call Profile ReceiverLimit");
     return _receiver_count[i];
   }
   float     receiver_prob(int i)  {
-    assert(i < _limit, "out of Call Profile MorphismLimit");
+    assert(i < _limit, "out of Call Profile ReceiverLimit");
     return (float)_receiver_count[i]/(float)_count;
   }
   ciKlass*  receiver(int i)        {
-    assert(i < _limit, "out of Call Profile MorphismLimit");
+    assert(i < _limit, "out of Call Profile ReceiverLimit");
     return _receiver[i];
   }
 };
@@ -205,22 +205,34 @@ class java_lang_String : AllStatic {
   // hash P(31) from Kernighan & Ritchie
   //
   // For this reason, THIS ALGORITHM MUST MATCH String.hashCode().
-  static unsigned int hash_code(const jchar* s, int len) {
+  //
+  // The loop is unrolled by four using precomputed powers of 31, so the
+  // multiply-adds of one step no longer depend on each other.
+  template <typename T>
+  static unsigned int polynomial_hash(const T* s, int len) {
     unsigned int h = 0;
-    while (len-- > 0) {
-      h = 31*h + (unsigned int) *s;
-      s++;
+    for (; len >= 4; len -= 4, s += 4) {
+      h = 923521 * h +
+          29791  * hash_char(s[0]) +
+          961    * hash_char(s[1]) +
+          31     * hash_char(s[2]) +
+                   hash_char(s[3]);
+    }
+    for (; len > 0; len--, s++) {
+      h = 31*h + hash_char(*s);
     }
     return h;
   }
 
+  static unsigned int hash_char(jchar c) { return (unsigned int) c; }
+  static unsigned int hash_char(jbyte c) { return ((unsigned int) c) & 0xFF; }
+
+  static unsigned int hash_code(const jchar* s, int len) {
+    return polynomial_hash(s, len);
+  }
+
   static unsigned int hash_code(const jbyte* s, int len) {
-    unsigned int h = 0;
-    while (len-- > 0) {
-      h = 31*h + (((unsigned int) *s) & 0xFF);
-      s++;
-    }
-    return h;
+    return polynomial_hash(s, len);
   }
 
   static unsigned int hash_code(oop java_string);
@@ -1478,6 +1478,25 @@ public:
   }
 };
 
+class ArchivedBuiltinClassesDo : StackObj {
+  KlassClosure* _closure;
+public:
+  ArchivedBuiltinClassesDo(KlassClosure* closure) : _closure(closure) {}
+
+  void do_value(const RunTimeClassInfo* record) {
+    _closure->do_klass(record->_klass);
+  }
+};
+
+void SystemDictionaryShared::archived_builtin_classes_do(KlassClosure* closure) {
+  assert(UseSharedSpaces, "must be");
+  ArchivedBuiltinClassesDo iter(closure);
+  _builtin_dictionary.iterate(&iter);
+  if (DynamicArchive::is_mapped()) {
+    _dynamic_builtin_dictionary.iterate(&iter);
+  }
+}
+
 void SystemDictionaryShared::print_on(const char* prefix,
                                       RunTimeSharedDictionary* builtin_dictionary,
                                       RunTimeSharedDictionary* unregistered_dictionary,
@@ -1161,15 +1161,17 @@ int CodeCache::mark_for_deoptimization(Method* dependee) {
   return number_of_marked_CodeBlobs;
 }
 
-void CodeCache::make_marked_nmethods_not_entrant() {
+int CodeCache::make_marked_nmethods_not_entrant() {
   assert_locked_or_safepoint(CodeCache_lock);
+  int made_not_entrant = 0;
   CompiledMethodIterator iter(CompiledMethodIterator::only_alive_and_not_unloading);
   while(iter.next()) {
     CompiledMethod* nm = iter.method();
-    if (nm->is_marked_for_deoptimization()) {
-      nm->make_not_entrant();
+    if (nm->is_marked_for_deoptimization() && nm->make_not_entrant()) {
+      made_not_entrant++;
     }
   }
+  return made_not_entrant;
 }
 
 // Flushes compiled methods dependent on dependee.
@@ -1259,6 +1261,10 @@ void CodeCache::report_codemem_full(int code_blob_type, bool print) {
     {
       MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
       print_summary(&s);
+      size_t largest = heap->largest_free_block();
+      s.print_cr("%s: largest_free_block=" SIZE_FORMAT "Kb", heap->name(), largest/K);
+      log_info(codecache)("%s: largest free block " SIZE_FORMAT "Kb of " SIZE_FORMAT "Kb free",
+                          heap->name(), largest/K, heap->unallocated_capacity()/K);
     }
     {
       ttyLocker ttyl;
@@ -264,7 +264,8 @@ class CodeCache : AllStatic {
  public:
   static void mark_all_nmethods_for_deoptimization();
   static int  mark_for_deoptimization(Method* dependee);
-  static void make_marked_nmethods_not_entrant();
+  // Returns the number of nmethods this call made not entrant.
+  static int  make_marked_nmethods_not_entrant();
 
   // Flushing and deoptimization
   static void flush_dependents_on(InstanceKlass* dependee);
@@ -117,7 +117,7 @@ class DependencyContext : public StackObj {
 
   static void init();
 
-  int  mark_dependent_nmethods(DepChange& changes);
+  int  mark_dependent_nmethods(DepChange& changes, Klass* context = NULL);
   void add_dependent_nmethod(nmethod* nm);
   void remove_dependent_nmethod(nmethod* nm);
   int  remove_all_dependents();
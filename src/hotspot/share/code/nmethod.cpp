@@ -2271,12 +2271,17 @@ void nmethod::check_all_dependencies(DepChange& changes) {
   }
 }
 
-bool nmethod::check_dependency_on(DepChange& changes) {
+bool nmethod::check_dependency_on(DepChange& changes, Klass* context) {
   // What has happened:
   // 1) a new class dependee has been added
   // 2) dependee and all its super classes have been marked
   bool found_check = false;  // set true if we are upset
   for (Dependencies::DepStream deps(this); deps.next(); ) {
+    // Dependencies with another context type are recorded in that type's
+    // dependency context and are checked when that context is visited.
+    if (context != NULL && deps.context_type() != context) {
+      continue;
+    }
     // Evaluate only relevant dependencies.
     if (deps.spot_check_dependency_at(changes) != NULL) {
       found_check = true;
@@ -721,8 +721,9 @@ public:
   static void check_all_dependencies(DepChange& changes);
 
   // tells if this compiled method is dependent on the given changes,
-  // and the changes have invalidated it
-  bool check_dependency_on(DepChange& changes);
+  // and the changes have invalidated it. If context is not NULL, only
+  // the dependencies recorded under that context type are evaluated.
+  bool check_dependency_on(DepChange& changes, Klass* context = NULL);
 
   // Fast breakpoint support. Tells if this compiled method is
   // dependent on the given method. Returns true if this nmethod
@@ -610,54 +610,58 @@ void CompilationPolicy::handle_counter_overflow(Method* method) {
 }
 
 // Called with the queue locked and with at least one element
-CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
-  CompileTask *max_blocking_task = NULL;
-  CompileTask *max_task = NULL;
-  Method* max_method = NULL;
+void CompilationPolicy::update_priority(CompileTask* task) {
+  Method* method = task->method();
+  task->set_priority(method->highest_comp_level(), weight(method));
+}
 
-  jlong t = nanos_to_millis(os::javaTimeNanos());
-  // Iterate through the queue and find a method with a maximum rate.
-  for (CompileTask* task = compile_queue->first(); task != NULL;) {
-    CompileTask* next_task = task->next();
-    Method* method = task->method();
-    // If a method was unloaded or has been stale for some time, remove it from the queue.
-    // Blocking tasks and tasks submitted from whitebox API don't become stale
-    if (task->is_unloaded() || (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, method) && !is_old(method))) {
-      if (!task->is_unloaded()) {
-        if (PrintTieredEvents) {
-          print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
-        }
-        method->clear_queued_for_compilation();
+// If a method was unloaded or has been stale for some time, remove it from the queue.
+// Blocking tasks and tasks submitted from whitebox API don't become stale
+bool CompilationPolicy::remove_if_stale(CompileQueue* compile_queue, CompileTask* task, jlong t) {
+  Method* method = task->method();
+  if (task->is_unloaded() || (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, method) && !is_old(method))) {
+    if (!task->is_unloaded()) {
+      if (PrintTieredEvents) {
+        print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
       }
-      compile_queue->remove_and_mark_stale(task);
-      task = next_task;
-      continue;
-    }
-    update_rate(t, method);
-    if (max_task == NULL || compare_methods(method, max_method)) {
-      // Select a method with the highest rate
-      max_task = task;
-      max_method = method;
+      method->clear_queued_for_compilation();
     }
+    compile_queue->remove_and_mark_stale(task);
+    return true;
+  }
+  return false;
+}
+
+CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
+  jlong t = nanos_to_millis(os::javaTimeNanos());
 
-    if (task->is_blocking()) {
-      if (max_blocking_task == NULL || compare_methods(method, max_blocking_task->method())) {
-        max_blocking_task = task;
+  // The queue keeps its tasks in a heap ordered by the priorities computed by
+  // update_priority(). Walking the queue to purge stale tasks and to update the
+  // rates and priorities is linear in its size, so it is done on every selection
+  // only for short queues. Long queues are walked once per rate sampling interval.
+  if (compile_queue->size() <= TieredCompileQueueScanThreshold ||
+      t - compile_queue->last_priority_update() >= TieredRateUpdateMaxTime) {
+    for (CompileTask* task = compile_queue->first(); task != NULL;) {
+      CompileTask* next_task = task->next();
+      if (!remove_if_stale(compile_queue, task, t)) {
+        update_rate(t, task->method());
+        update_priority(task);
       }
+      task = next_task;
     }
-
-    task = next_task;
+    compile_queue->priorities_updated(t);
   }
 
-  if (max_blocking_task != NULL) {
-    // In blocking compilation mode, the CompileBroker will make
-    // compilations submitted by a JVMCI compiler thread non-blocking. These
-    // compilations should be scheduled after all blocking compilations
-    // to service non-compiler related compilations sooner and reduce the
-    // chance of such compilations timing out.
-    max_task = max_blocking_task;
-    max_method = max_task->method();
+  // Blocking tasks have the highest priority. In blocking compilation mode, the
+  // CompileBroker will make compilations submitted by a JVMCI compiler thread
+  // non-blocking. These compilations should be scheduled after all blocking
+  // compilations to service non-compiler related compilations sooner and reduce
+  // the chance of such compilations timing out.
+  CompileTask* max_task = compile_queue->highest_priority();
+  while (max_task != NULL && remove_if_stale(compile_queue, max_task, t)) {
+    max_task = compile_queue->highest_priority();
   }
+  Method* max_method = (max_task != NULL) ? max_task->method() : NULL;
 
   methodHandle max_method_h(Thread::current(), max_method);
 
@@ -199,6 +199,8 @@ class CompilationPolicy : AllStatic {
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline static void update_rate(jlong t, Method* m);
+  // Remove the task from the queue if its method was unloaded or has been inactive for too long.
+  static bool remove_if_stale(CompileQueue* compile_queue, CompileTask* task, jlong t);
   // Compute threshold scaling coefficient
   inline static double threshold_scale(CompLevel level, int feedback_k);
   // If a method is old enough and is still in the interpreter we would want to
@@ -260,6 +262,8 @@ public:
                  int branch_bci, int bci, CompLevel comp_level, CompiledMethod* nm, TRAPS);
   // Select task is called by CompileBroker. We should return a task or NULL.
   static CompileTask* select_task(CompileQueue* compile_queue);
+  // Set the priority of a task in the compile queue from the current state of its method.
+  static void update_priority(CompileTask* task);
   // Tell the runtime if we think a given method is adequately profiled.
   static bool is_mature(Method* method);
   // Initialize: set compiler thread count
@@ -373,6 +373,11 @@ void CompileQueue::add(CompileTask* task) {
   }
   ++_size;
 
+  CompilationPolicy::update_priority(task);
+  _heap.append(task);
+  task->set_queue_index(_heap.length() - 1);
+  heap_sift_up(_heap.length() - 1);
+
   // Mark the method as being in the compile queue.
   task->method()->set_queued_for_compilation();
 
@@ -412,6 +417,7 @@ void CompileQueue::free_all() {
   }
   _first = NULL;
   _last = NULL;
+  _heap.clear();
 
   // Wake up all threads that block on the queue.
   MethodCompileQueue_lock->notify_all();
@@ -522,6 +528,65 @@ void CompileQueue::remove(CompileTask* task) {
     _last = task->prev();
   }
   --_size;
+  heap_remove(task);
+}
+
+void CompileQueue::heap_set(int index, CompileTask* task) {
+  _heap.at_put(index, task);
+  task->set_queue_index(index);
+}
+
+void CompileQueue::heap_sift_up(int index) {
+  CompileTask* task = _heap.at(index);
+  while (index > 0) {
+    int parent = (index - 1) / 2;
+    if (!task->has_higher_priority(_heap.at(parent))) {
+      break;
+    }
+    heap_set(index, _heap.at(parent));
+    index = parent;
+  }
+  heap_set(index, task);
+}
+
+void CompileQueue::heap_sift_down(int index) {
+  CompileTask* task = _heap.at(index);
+  int length = _heap.length();
+  while (true) {
+    int child = 2 * index + 1;
+    if (child >= length) {
+      break;
+    }
+    if (child + 1 < length && _heap.at(child + 1)->has_higher_priority(_heap.at(child))) {
+      child++;
+    }
+    if (!_heap.at(child)->has_higher_priority(task)) {
+      break;
+    }
+    heap_set(index, _heap.at(child));
+    index = child;
+  }
+  heap_set(index, task);
+}
+
+void CompileQueue::heap_remove(CompileTask* task) {
+  int index = task->queue_index();
+  assert(index >= 0 && index < _heap.length() && _heap.at(index) == task, "task not in heap");
+  CompileTask* last = _heap.pop();
+  task->set_queue_index(-1);
+  if (last != task) {
+    heap_set(index, last);
+    heap_sift_up(index);
+    heap_sift_down(last->queue_index());
+  }
+}
+
+void CompileQueue::priorities_updated(jlong t) {
+  assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  for (int i = _heap.length() / 2 - 1; i >= 0; i--) {
+    heap_sift_down(i);
+  }
+  _last_priority_update = t;
 }
 
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
@@ -1044,6 +1109,9 @@ void CompileBroker::init_compiler_sweeper_threads() {
 void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   julong available_memory = os::available_memory();
+  // Never run more threads of one compiler than there are CPUs currently
+  // available to the process, e.g. after a container's CPU quota shrank.
+  int available_cpus = os::active_processor_count();
   // If SegmentedCodeCache is off, both values refer to the single heap (with type CodeBlobType::All).
   size_t available_cc_np  = CodeCache::unallocated_capacity(CodeBlobType::MethodNonProfiled),
          available_cc_p   = CodeCache::unallocated_capacity(CodeBlobType::MethodProfiled);
@@ -1057,6 +1125,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c2_compile_queue->size() / 2,
         (int)(available_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    new_c2_count = MIN2(new_c2_count, available_cpus);
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1111,6 +1180,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c1_compile_queue->size() / 4,
         (int)(available_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    new_c1_count = MIN2(new_c1_count, available_cpus);
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -32,6 +32,7 @@
 #include "compiler/compilerThread.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/perfDataTypes.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/stack.hpp"
 #if INCLUDE_JVMCI
 #include "jvmci/jvmciCompiler.hpp"
@@ -90,14 +91,26 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   int _size;
 
+  // Binary max-heap of the tasks in the queue, ordered by CompileTask::has_higher_priority().
+  // The priorities are assigned by the compilation policy; it refreshes them in bulk
+  // from time to time, so selecting the next task doesn't need to scan the whole queue.
+  GrowableArrayCHeap<CompileTask*, mtCompiler> _heap;
+  jlong _last_priority_update;
+
+  void heap_set(int index, CompileTask* task);
+  void heap_sift_up(int index);
+  void heap_sift_down(int index);
+  void heap_remove(CompileTask* task);
+
   void purge_stale_tasks();
  public:
-  CompileQueue(const char* name) {
+  CompileQueue(const char* name) : _heap(16) {
     _name = name;
     _first = NULL;
     _last = NULL;
     _size = 0;
     _first_stale = NULL;
+    _last_priority_update = 0;
   }
 
   const char*  name() const                      { return _name; }
@@ -113,6 +126,12 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   bool         is_empty() const                  { return _first == NULL; }
   int          size()     const                  { return _size;          }
 
+  // The task with the highest priority, or NULL if the queue is empty.
+  CompileTask* highest_priority() const          { return _heap.is_empty() ? NULL : _heap.at(0); }
+  // Restores the heap order after the priorities of all tasks have been updated at time t (in ms).
+  void         priorities_updated(jlong t);
+  jlong        last_priority_update() const      { return _last_priority_update; }
+
 
   // Redefine Classes support
   void mark_on_stack();
@@ -133,6 +133,9 @@ void CompileTask::initialize(int compile_id,
   }
 
   _next = NULL;
+  _queue_index = -1;
+  _priority_level = 0;
+  _priority_weight = 0.0;
 }
 
 /**
@@ -54,6 +54,7 @@ class CompileTask : public CHeapObj<mtCompiler> {
       Reason_Whitebox,         // Whitebox API
       Reason_MustBeCompiled,   // Used for -Xcomp or AlwaysCompileLoopMethods (see CompilationPolicy::must_be_compiled())
       Reason_Bootstrap,        // JVMCI bootstrap
+      Reason_Precompile,       // Listed in SharedCompiledMethodsFile
       Reason_Count
   };
 
@@ -66,7 +67,8 @@ class CompileTask : public CHeapObj<mtCompiler> {
       "replay",
       "whitebox",
       "must_be_compiled",
-      "bootstrap"
+      "bootstrap",
+      "precompile"
     };
     return reason_names[compile_reason];
   }
@@ -91,6 +93,11 @@ class CompileTask : public CHeapObj<mtCompiler> {
   nmethodLocker* _code_handle;  // holder of eventual result
   CompileTask* _next, *_prev;
   bool         _is_free;
+  // Position in the priority heap of the CompileQueue and the priority
+  // assigned by the compilation policy, see CompileQueue::highest_priority().
+  int          _queue_index;
+  int          _priority_level;
+  double       _priority_weight;
   // Fields used for logging why the compilation was initiated:
   jlong        _time_queued;  // time when task was enqueued
   jlong        _time_started; // time when compilation started
@@ -179,6 +186,25 @@ class CompileTask : public CHeapObj<mtCompiler> {
   void         set_prev(CompileTask* prev)       { _prev = prev; }
   bool         is_free() const                   { return _is_free; }
   void         set_is_free(bool val)             { _is_free = val; }
+
+  int          queue_index() const               { return _queue_index; }
+  void         set_queue_index(int index)        { _queue_index = index; }
+  void         set_priority(int level, double weight) {
+    _priority_level = level;
+    _priority_weight = weight;
+  }
+  // Blocking tasks go first, then tasks with the higher level and weight.
+  // Ties are resolved in the order the tasks were created.
+  bool         has_higher_priority(const CompileTask* other) const {
+    if (_is_blocking != other->_is_blocking) {
+      return _is_blocking;
+    } else if (_priority_level != other->_priority_level) {
+      return _priority_level > other->_priority_level;
+    } else if (_priority_weight != other->_priority_weight) {
+      return _priority_weight > other->_priority_weight;
+    }
+    return _compile_id < other->_compile_id;
+  }
   bool         is_unloaded() const;
 
   // RedefineClasses support
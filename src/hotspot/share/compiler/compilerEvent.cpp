@@ -132,11 +132,13 @@ void CompilerEvent::CompilationFailureEvent::post(EventCompilationFailure& event
   event.commit();
 }
 
-void CompilerEvent::PhaseEvent::post(EventCompilerPhase& event, const Ticks& start_time, int phase, int compile_id, int level) {
+void CompilerEvent::PhaseEvent::post(EventCompilerPhase& event, const Ticks& start_time, int phase, int compile_id, int level,
+                                     uint live_nodes) {
   event.set_starttime(start_time);
   event.set_phase((u1) phase);
   event.set_compileId(compile_id);
   event.set_phaseLevel((short)level);
+  event.set_liveNodeCount(live_nodes);
   event.commit();
 }
 
@@ -72,7 +72,8 @@ class CompilerEvent : AllStatic {
     // If `sync` is true, then access to the registration table is synchronized.
     static int get_phase_id(const char* phase_name, bool may_exist, bool use_strdup, bool sync) NOT_JFR_RETURN_(-1);
 
-    static void post(EventCompilerPhase& event, const Ticks& start_time, int phase, int compile_id, int level) NOT_JFR_RETURN();
+    static void post(EventCompilerPhase& event, const Ticks& start_time, int phase, int compile_id, int level,
+                     uint live_nodes = 0) NOT_JFR_RETURN();
     static void post(EventCompilerPhase& event, jlong start_time, int phase, int compile_id, int level) {
       JFR_ONLY(post(event, Ticks(start_time), phase, compile_id, level);)
     }
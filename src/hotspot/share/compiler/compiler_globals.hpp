@@ -242,6 +242,12 @@
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, TieredCompileQueueScanThreshold, 100,                       \
+          "Update the priorities of all tasks in a compile queue on every " \
+          "task selection if the queue holds at most this many tasks. "     \
+          "Longer queues are updated every TieredRateUpdateMaxTime ms")     \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -23,20 +23,32 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "code/codeCache.hpp"
 #include "gc/epsilon/epsilonHeap.hpp"
 #include "gc/epsilon/epsilonInitLogger.hpp"
 #include "gc/epsilon/epsilonMemoryPool.hpp"
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
 #include "gc/shared/gcArguments.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
+#include "gc/shared/oopStorageSet.inline.hpp"
+#include "gc/shared/weakProcessor.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/iterator.inline.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/compressedOops.inline.hpp"
+#include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/thread.hpp"
+#include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
@@ -269,6 +281,111 @@ HeapWord* EpsilonHeap::allocate_loaded_archive_space(size_t size) {
   return allocate_work(size, /* verbose = */false);
 }
 
+class VM_EpsilonResetHeap : public VM_Operation {
+public:
+  VMOp_Type type() const { return VMOp_EpsilonResetHeap; }
+
+  bool doit_prologue() {
+    // Keep heap expansion out while top is moved.
+    Heap_lock->lock();
+    return true;
+  }
+
+  void doit() {
+    EpsilonHeap::heap()->reset_to_mark();
+  }
+
+  void doit_epilogue() {
+    Heap_lock->unlock();
+  }
+};
+
+// Finds references to objects at or above the mark.
+class EpsilonFindAboveMarkClosure : public BasicOopIterateClosure {
+  HeapWord* const _mark;
+  bool _found;
+
+  template <class T>
+  void do_oop_work(T* p) {
+    T o = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(o) &&
+        cast_from_oop<HeapWord*>(CompressedOops::decode_not_null(o)) >= _mark) {
+      _found = true;
+    }
+  }
+
+public:
+  EpsilonFindAboveMarkClosure(HeapWord* mark) : _mark(mark), _found(false) {}
+
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+
+  bool found() const { return _found; }
+};
+
+class EpsilonIsBelowMarkClosure : public BoolObjectClosure {
+  HeapWord* const _mark;
+
+public:
+  EpsilonIsBelowMarkClosure(HeapWord* mark) : _mark(mark) {}
+
+  virtual bool do_object_b(oop obj) {
+    return cast_from_oop<HeapWord*>(obj) < _mark;
+  }
+};
+
+void EpsilonHeap::reset_to_mark() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Expected at safepoint");
+
+  // Retire all TLABs so that top is the end of the last object.
+  ensure_parsability(true);
+
+  HeapWord* const top = _space->top();
+  HeapWord* const mark = _reset_mark;
+  _reset_mark = top;
+  if (mark == NULL || mark == top) {
+    return;
+  }
+
+  // Everything in [mark, top) can be discarded only if nothing outside of
+  // it refers into it. Dead objects below the mark are considered live,
+  // so this is conservative.
+  EpsilonFindAboveMarkClosure cl(mark);
+  CodeBlobToOopClosure blobs(&cl, !CodeBlobToOopClosure::FixRelocations);
+  Threads::oops_do(&cl, &blobs);
+  CodeCache::blobs_do(&blobs);
+  CLDToOopClosure cld_cl(&cl, ClassLoaderData::_claim_none);
+  ClassLoaderDataGraph::cld_do(&cld_cl);
+  for (OopStorage* storage : OopStorageSet::Range<OopStorageSet::StrongId>()) {
+    storage->oops_do(&cl);
+  }
+  for (HeapWord* p = _space->bottom(); p < mark && !cl.found(); ) {
+    oop obj = cast_to_oop(p);
+    obj->oop_iterate(&cl);
+    p += obj->size();
+  }
+
+  if (cl.found()) {
+    log_info(gc)("Heap reset refused, objects allocated since the last reset are reachable");
+    return;
+  }
+
+  // Clear the weak references into the discarded part.
+  EpsilonIsBelowMarkClosure is_alive(mark);
+  WeakProcessor::weak_oops_do(&is_alive, &do_nothing_cl);
+
+  _space->set_top(mark);
+  _space->mangle_unused_area();
+  _reset_mark = mark;
+  _last_counter_update = used();
+  _last_heap_print = used();
+  _monitoring_support->update_counters();
+
+  log_info(gc)("Heap reset, discarded " SIZE_FORMAT "%s",
+               byte_size_in_proper_unit(pointer_delta(top, mark, 1)),
+               proper_unit_for_byte_size(pointer_delta(top, mark, 1)));
+}
+
 void EpsilonHeap::collect(GCCause::Cause cause) {
   switch (cause) {
     case GCCause::_metadata_GC_threshold:
@@ -282,6 +399,13 @@ void EpsilonHeap::collect(GCCause::Cause cause) {
       MetaspaceGC::compute_new_size();
       print_metaspace_info();
       break;
+    case GCCause::_java_lang_system_gc:
+      if (EpsilonResetOnSystemGC) {
+        VM_EpsilonResetHeap op;
+        VMThread::execute(&op);
+        break;
+      }
+      // fall through
     default:
       log_info(gc)("GC request for \"%s\" is ignored", GCCause::to_string(cause));
   }
@@ -34,6 +34,7 @@
 
 class EpsilonHeap : public CollectedHeap {
   friend class VMStructs;
+  friend class VM_EpsilonResetHeap;
 private:
   SoftRefPolicy _soft_ref_policy;
   EpsilonMonitoringSupport* _monitoring_support;
@@ -47,13 +48,15 @@ private:
   int64_t _decay_time_ns;
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
+  HeapWord* _reset_mark;
 
 public:
   static EpsilonHeap* heap();
 
   EpsilonHeap() :
           _memory_manager("Epsilon Heap", ""),
-          _space(NULL) {};
+          _space(NULL),
+          _reset_mark(NULL) {};
 
   virtual Name kind() const {
     return CollectedHeap::Epsilon;
@@ -140,6 +143,10 @@ public:
   virtual bool print_location(outputStream* st, void* addr) const;
 
 private:
+  // Discard everything allocated since the previous call if none of it is
+  // reachable, otherwise start a new interval. Called at a safepoint.
+  void reset_to_mark();
+
   void print_heap_info(size_t used) const;
   void print_metaspace_info() const;
 
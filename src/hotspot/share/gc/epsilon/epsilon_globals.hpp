@@ -86,7 +86,13 @@
   product(size_t, EpsilonMinHeapExpand, 128 * M, EXPERIMENTAL,              \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  product(bool, EpsilonResetOnSystemGC, false, EXPERIMENTAL,                \
+          "Discard everything allocated since the previous System.gc() "    \
+          "when System.gc() finds that none of it is reachable. Allows "    \
+          "benchmarks to run many iterations in a bounded heap. Costs a "   \
+          "walk over the roots and the heap on each System.gc().")
 
 // end of GC_EPSILON_FLAGS
 
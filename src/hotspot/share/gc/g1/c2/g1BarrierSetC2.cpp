@@ -388,6 +388,12 @@ void G1BarrierSetC2::post_barrier(GraphKit* kit,
     return;
   }
 
+  if (!use_precise && val != NULL && val->uncast() == obj->uncast()) {
+    // Storing an instance into one of its own fields: the card address is
+    // the object itself, so the region-crossing check below always fails.
+    return;
+  }
+
   if (use_ReduceInitialCardMarks() && obj == kit->just_allocated_object(kit->control())) {
     // We can skip marks on a freshly-allocated object in Eden.
     // Keep this code in sync with new_deferred_store_barrier() in runtime.cpp.
@@ -300,6 +300,9 @@ G1PLABAllocator::G1PLABAllocator(G1Allocator* allocator) :
     uint length = alloc_buffers_length(state);
     _alloc_buffers[state] = NEW_C_HEAP_ARRAY(PLAB*, length, mtGC);
     size_t word_sz = _g1h->desired_plab_sz(state);
+    _cur_desired_plab_size[state] = word_sz;
+    _plab_allocated[state] = 0;
+    _num_plab_fills[state] = 0;
     for (uint node_index = 0; node_index < length; node_index++) {
       // Specialized PLABs for old that handle BOT updates for object allocations.
       _alloc_buffers[state][node_index] = (state == G1HeapRegionAttr::Old)
@@ -327,7 +330,7 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
                                                        size_t word_sz,
                                                        bool* plab_refill_failed,
                                                        uint node_index) {
-  size_t plab_word_size = _g1h->desired_plab_sz(dest);
+  size_t plab_word_size = _cur_desired_plab_size[dest.type()];
   size_t required_in_plab = PLAB::size_required_for_allocation(word_sz);
 
   // Only get a new PLAB if the allocation fits and it would not waste more than
@@ -351,6 +354,11 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
 
     if (buf != NULL) {
       alloc_buf->set_buf(buf, actual_plab_size);
+      _plab_allocated[dest.type()] += actual_plab_size;
+      _num_plab_fills[dest.type()]++;
+      if (G1ResizePLABsDuringGC) {
+        update_plab_size(dest.type());
+      }
 
       HeapWord* const obj = alloc_buf->allocate(word_sz);
       assert(obj != NULL, "PLAB should have been big enough, tried to allocate "
@@ -370,6 +378,19 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
   return result;
 }
 
+void G1PLABAllocator::update_plab_size(region_type_t dest) {
+  // With an allocated amount A and a last PLAB of size S that is on average
+  // G1LastPLABAverageOccupancy full, the waste at the end of the collection
+  // is S * (100 - G1LastPLABAverageOccupancy) / 100. Keeping this below
+  // TargetPLABWastePct of A gives the largest S we may use from now on.
+  double unused_pct = MAX2(100.0 - G1LastPLABAverageOccupancy, 1.0);
+  size_t max_size = (size_t)(_plab_allocated[dest] * TargetPLABWastePct / unused_pct);
+  max_size = align_object_size(MIN2(max_size, PLAB::max_size()));
+  if (max_size > _cur_desired_plab_size[dest]) {
+    _cur_desired_plab_size[dest] = max_size;
+  }
+}
+
 void G1PLABAllocator::undo_allocation(G1HeapRegionAttr dest, HeapWord* obj, size_t word_sz, uint node_index) {
   alloc_buffer(dest, node_index)->undo_allocation(obj, word_sz);
 }
@@ -414,6 +435,22 @@ size_t G1PLABAllocator::undo_waste() const {
   return result;
 }
 
+size_t G1PLABAllocator::num_plab_fills() const {
+  size_t result = 0;
+  for (region_type_t state = 0; state < G1HeapRegionAttr::Num; state++) {
+    result += _num_plab_fills[state];
+  }
+  return result;
+}
+
+size_t G1PLABAllocator::direct_allocated() const {
+  size_t result = 0;
+  for (region_type_t state = 0; state < G1HeapRegionAttr::Num; state++) {
+    result += _direct_allocated[state];
+  }
+  return result;
+}
+
 G1ArchiveAllocator* G1ArchiveAllocator::create_allocator(G1CollectedHeap* g1h, bool open) {
   return new G1ArchiveAllocator(g1h, open);
 }
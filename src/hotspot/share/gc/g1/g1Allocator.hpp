@@ -177,6 +177,19 @@ private:
   // Number of words allocated directly (not counting PLAB allocation).
   size_t _direct_allocated[G1HeapRegionAttr::Num];
 
+  // Size of the PLABs requested for each destination. Starts out as the
+  // desired PLAB size of the collection, but may grow during the collection
+  // if G1ResizePLABsDuringGC is set.
+  size_t _cur_desired_plab_size[G1HeapRegionAttr::Num];
+  // Number of words handed out in PLABs and number of PLAB refills.
+  size_t _plab_allocated[G1HeapRegionAttr::Num];
+  size_t _num_plab_fills[G1HeapRegionAttr::Num];
+
+  // Grow the PLAB size for dest as long as the waste of the last PLAB,
+  // assumed to be G1LastPLABAverageOccupancy full, stays within
+  // TargetPLABWastePct of what has already been allocated in PLABs.
+  void update_plab_size(region_type_t dest);
+
   void flush_and_retire_stats();
   inline PLAB* alloc_buffer(G1HeapRegionAttr dest, uint node_index) const;
   inline PLAB* alloc_buffer(region_type_t dest, uint node_index) const;
@@ -200,6 +213,8 @@ public:
 
   size_t waste() const;
   size_t undo_waste() const;
+  size_t num_plab_fills() const;
+  size_t direct_allocated() const;
 
   // Allocate word_sz words in dest, either directly into the regions or by
   // allocating a new PLAB. Returns the address of the allocated memory, NULL if
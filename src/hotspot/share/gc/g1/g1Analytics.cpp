@@ -94,6 +94,7 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
     _pending_cards_seq(new TruncatedSeq(TruncatedSeqLength)),
     _rs_length_seq(new TruncatedSeq(TruncatedSeqLength)),
     _cost_per_byte_ms_during_cm_seq(new TruncatedSeq(TruncatedSeqLength)),
+    _pause_time_prediction_ratio_seq(new TruncatedSeq(TruncatedSeqLength)),
     _recent_prev_end_times_for_all_gcs_sec(new TruncatedSeq(NumPrevPausesForHeuristics)),
     _long_term_pause_time_ratio(0.0),
     _short_term_pause_time_ratio(0.0) {
@@ -225,6 +226,10 @@ void G1Analytics::report_rs_length(double rs_length) {
   _rs_length_seq->add(rs_length);
 }
 
+void G1Analytics::report_pause_time_prediction_ratio(double actual_to_predicted_ratio) {
+  _pause_time_prediction_ratio_seq->add(actual_to_predicted_ratio);
+}
+
 double G1Analytics::predict_alloc_rate_ms() const {
   return predict_zero_bounded(_alloc_rate_ms_seq);
 }
@@ -309,6 +314,13 @@ size_t G1Analytics::predict_pending_cards() const {
   return predict_size(_pending_cards_seq);
 }
 
+double G1Analytics::predict_pause_time_prediction_ratio() const {
+  if (!enough_samples_available(_pause_time_prediction_ratio_seq)) {
+    return 1.0;
+  }
+  return predict_zero_bounded(_pause_time_prediction_ratio_seq);
+}
+
 double G1Analytics::oldest_known_gc_end_time_sec() const {
   return _recent_prev_end_times_for_all_gcs_sec->oldest();
 }
@@ -72,6 +72,9 @@ class G1Analytics: public CHeapObj<mtGC> {
 
   TruncatedSeq* _cost_per_byte_ms_during_cm_seq;
 
+  // The ratio between actual and predicted pause time of young collections.
+  TruncatedSeq* _pause_time_prediction_ratio_seq;
+
   // Statistics kept per GC stoppage, pause or full.
   TruncatedSeq* _recent_prev_end_times_for_all_gcs_sec;
 
@@ -133,6 +136,7 @@ public:
   void report_constant_other_time_ms(double constant_other_time_ms);
   void report_pending_cards(double pending_cards);
   void report_rs_length(double rs_length);
+  void report_pause_time_prediction_ratio(double actual_to_predicted_ratio);
 
   double predict_alloc_rate_ms() const;
   int num_alloc_rate_ms() const;
@@ -165,6 +169,10 @@ public:
   size_t predict_rs_length() const;
   size_t predict_pending_cards() const;
 
+  // Upper bound of the expected ratio between actual and predicted pause time,
+  // or 1.0 if there are not enough samples yet.
+  double predict_pause_time_prediction_ratio() const;
+
   // Add a new GC of the given duration and end time to the record.
   void update_recent_gc_times(double end_time_sec, double elapsed_ms);
   void compute_pause_time_ratios(double end_time_sec, double pause_time_ms);
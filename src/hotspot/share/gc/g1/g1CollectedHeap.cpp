@@ -1349,8 +1349,9 @@ void G1CollectedHeap::shrink_helper(size_t shrink_bytes) {
 void G1CollectedHeap::shrink(size_t shrink_bytes) {
   _verifier->verify_region_sets_optional();
 
-  // We should only reach here at the end of a Full GC or during Remark which
-  // means we should not not be holding to any GC alloc regions. The method
+  // We should only reach here at the end of a Full GC, during Remark or at the
+  // end of a young GC which means we should not not be holding to any GC alloc
+  // regions. The method
   // below will make sure of that and do any remaining clean up.
   _allocator->abandon_gc_alloc_regions();
 
@@ -1691,6 +1692,8 @@ jint G1CollectedHeap::initialize() {
   _workers->initialize_workers();
 
   _numa->set_region_info(HeapRegion::GrainBytes, page_size);
+  // Remembered sets of regions use the card set free pool of their preferred node.
+  G1CardSetFreePool::initialize(_numa->num_active_nodes());
 
   // Create the G1ConcurrentMark data structure and thread.
   // (Must do this late, so that "max_[reserved_]regions" is defined.)
@@ -2392,6 +2395,21 @@ bool G1CollectedHeap::supports_concurrent_gc_breakpoints() const {
   return true;
 }
 
+bool G1CollectedHeap::supports_object_pinning() const {
+  return G1PinRegionsForCriticalNatives;
+}
+
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  assert(obj != NULL, "must be");
+  heap_region_containing(obj)->increment_pinned_object_count();
+  return obj;
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  assert(obj != NULL, "must be");
+  heap_region_containing(obj)->decrement_pinned_object_count();
+}
+
 bool G1CollectedHeap::is_archived_object(oop object) const {
   return object != NULL && heap_region_containing(object)->is_archive();
 }
@@ -2780,16 +2798,24 @@ void G1CollectedHeap::verify_after_young_collection(G1HeapVerifier::G1VerifyType
   phase_times()->record_verify_after_time_ms((Ticks::now() - start).seconds() * MILLIUNITS);
 }
 
-void G1CollectedHeap::expand_heap_after_young_collection(){
-  size_t expand_bytes = _heap_sizing_policy->young_collection_expansion_amount();
-  if (expand_bytes > 0) {
-    // No need for an ergo logging here,
-    // expansion_amount() does this when it returns a value > 0.
+void G1CollectedHeap::resize_heap_after_young_collection() {
+  bool should_expand;
+  size_t resize_bytes = _heap_sizing_policy->young_collection_resize_amount(should_expand);
+  if (resize_bytes == 0) {
+    return;
+  }
+  // No need for an ergo logging here,
+  // young_collection_resize_amount() does this when it returns a value > 0.
+  if (should_expand) {
     double expand_ms = 0.0;
-    if (!expand(expand_bytes, _workers, &expand_ms)) {
+    if (!expand(resize_bytes, _workers, &expand_ms)) {
       // We failed to expand the heap. Cannot do anything about it.
     }
     phase_times()->record_expand_heap_time(expand_ms);
+  } else {
+    shrink(resize_bytes);
+    // The actual uncommit is done concurrently.
+    uncommit_regions_if_necessary();
   }
 }
 
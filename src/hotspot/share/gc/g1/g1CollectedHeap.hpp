@@ -783,7 +783,7 @@ public:
 
   void retire_tlabs();
 
-  void expand_heap_after_young_collection();
+  void resize_heap_after_young_collection();
   // Update object copying statistics.
   void record_obj_copy_mem_stats();
 
@@ -1319,6 +1319,12 @@ public:
   // WhiteBox testing support.
   bool supports_concurrent_gc_breakpoints() const override;
 
+  // JNI critical sections pin the region containing the object
+  // instead of locking out garbage collections.
+  bool supports_object_pinning() const override;
+  oop pin_object(JavaThread* thread, oop obj) override;
+  void unpin_object(JavaThread* thread, oop obj) override;
+
   WorkerThreads* safepoint_workers() override { return _workers; }
 
   bool is_archived_object(oop object) const override;
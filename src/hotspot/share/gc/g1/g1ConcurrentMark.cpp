@@ -1683,9 +1683,88 @@ public:
   }
 };
 
+class G1CMPrecleanTask : public WorkerTask {
+  ReferenceProcessor* _rp;
+  G1ConcurrentMark* _cm;
+  ReferenceType _type;
+  // Claims queue indices. The marking task terminator is not used here, so
+  // the concurrency of the marking tasks is left alone.
+  volatile uint _claimed_queues;
+  volatile bool _aborted;
+
+public:
+  G1CMPrecleanTask(ReferenceProcessor* rp, G1ConcurrentMark* cm, ReferenceType type) :
+    WorkerTask("G1 Concurrent Preclean"),
+    _rp(rp),
+    _cm(cm),
+    _type(type),
+    _claimed_queues(0),
+    _aborted(false) { }
+
+  void work(uint worker_id) {
+    SuspendibleThreadSetJoiner joiner;
+
+    BarrierEnqueueDiscoveredFieldClosure enqueue;
+    G1PrecleanYieldClosure yield_cl(_cm);
+
+    // Every worker takes the list of a queue index, so workers never
+    // touch the same list.
+    for (uint queue = Atomic::fetch_and_add(&_claimed_queues, 1u);
+         queue < _rp->max_num_queues();
+         queue = Atomic::fetch_and_add(&_claimed_queues, 1u)) {
+      if (_rp->preclean_discovered_references(_type,
+                                              queue,
+                                              _rp->is_alive_non_header(),
+                                              &enqueue,
+                                              &yield_cl)) {
+        Atomic::store(&_aborted, true);
+        return;
+      }
+    }
+  }
+
+  bool aborted() const { return Atomic::load(&_aborted); }
+};
+
+void G1ConcurrentMark::preclean_parallel(ReferenceProcessor* rp) {
+  static const struct {
+    ReferenceType _type;
+    const char* _phase;
+  } phases[] = {
+    { REF_SOFT,    "Preclean SoftReferences" },
+    { REF_WEAK,    "Preclean WeakReferences" },
+    { REF_FINAL,   "Preclean FinalReferences" },
+    { REF_PHANTOM, "Preclean PhantomReferences" }
+  };
+
+  uint active_workers = MIN2(_num_concurrent_workers, rp->max_num_queues());
+  active_workers = MAX2(active_workers, 1u);
+
+  // Same phases, and so the same logging and timer events, as the single
+  // threaded ReferenceProcessor::preclean_discovered_references.
+  for (uint i = 0; i < ARRAY_SIZE(phases); i++) {
+    GCTraceTime(Debug, gc, ref) tm(phases[i]._phase, _gc_timer_cm);
+    G1CMPrecleanTask task(rp, this, phases[i]._type);
+    _concurrent_workers->run_task(&task, active_workers);
+    if (task.aborted()) {
+      return;
+    }
+  }
+}
+
 void G1ConcurrentMark::preclean() {
   assert(G1UseReferencePrecleaning, "Precleaning must be enabled.");
 
+  ReferenceProcessor* rp = _g1h->ref_processor_cm();
+  // Precleaning does not expect concurrent discovery. Temporarily disable
+  // MT discovery.
+  ReferenceProcessorMTDiscoveryMutator rp_mut_discovery(rp, false);
+
+  if (G1ParallelReferencePrecleaning) {
+    preclean_parallel(rp);
+    return;
+  }
+
   SuspendibleThreadSetJoiner joiner;
 
   BarrierEnqueueDiscoveredFieldClosure enqueue;
@@ -1694,9 +1773,7 @@ void G1ConcurrentMark::preclean() {
 
   G1PrecleanYieldClosure yield_cl(this);
 
-  ReferenceProcessor* rp = _g1h->ref_processor_cm();
-  // Precleaning is single threaded. Temporarily disable MT discovery.
-  ReferenceProcessorMTDiscoveryMutator rp_mut_discovery(rp, false);
+  // Precleaning is single threaded.
   rp->preclean_discovered_references(rp->is_alive_non_header(),
                                      &enqueue,
                                      &yield_cl,
@@ -1870,6 +1947,10 @@ void G1ConcurrentMark::clear_range_in_prev_bitmap(MemRegion mr) {
   _prev_mark_bitmap->clear_range(mr);
 }
 
+void G1ConcurrentMark::par_clear_range_in_prev_bitmap(MemRegion mr) {
+  _prev_mark_bitmap->par_clear_range(mr);
+}
+
 HeapRegion*
 G1ConcurrentMark::claim_region(uint worker_id) {
   // "checkpoint" the finger
@@ -3040,7 +3121,7 @@ G1PrintRegionLivenessInfoClosure::~G1PrintRegionLivenessInfoClosure() {
   }
 
   // add static memory usages to remembered set sizes
-  _total_remset_bytes += G1CardSetFreePool::free_list_pool()->mem_size() + HeapRegionRemSet::static_mem_size();
+  _total_remset_bytes += G1CardSetFreePool::free_list_pools_mem_size() + HeapRegionRemSet::static_mem_size();
   // Print the footer of the output.
   log_trace(gc, liveness)(G1PPRL_LINE_PREFIX);
   log_trace(gc, liveness)(G1PPRL_LINE_PREFIX
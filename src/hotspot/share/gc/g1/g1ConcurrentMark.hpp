@@ -49,6 +49,7 @@ class G1ConcurrentMark;
 class G1OldTracer;
 class G1RegionToSpaceMapper;
 class G1SurvivorRegions;
+class ReferenceProcessor;
 class ThreadClosure;
 
 // This is a container class for either an oop or a continuation address for
@@ -365,6 +366,9 @@ class G1ConcurrentMark : public CHeapObj<mtGC> {
 
   void weak_refs_work();
 
+  // Preclean the discovered references with the concurrent marking workers.
+  void preclean_parallel(ReferenceProcessor* rp);
+
   void report_object_count(bool mark_completed);
 
   void reclaim_empty_regions();
@@ -569,6 +573,8 @@ public:
   // next bitmaps.  Caution: the previous bitmap is usually
   // read-only, so use this carefully!
   void clear_range_in_prev_bitmap(MemRegion mr);
+  // As above, for ranges that may be cleared concurrently with adjacent ones.
+  void par_clear_range_in_prev_bitmap(MemRegion mr);
 
   inline bool is_marked_in_prev_bitmap(oop p) const;
 
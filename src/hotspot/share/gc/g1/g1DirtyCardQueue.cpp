@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "gc/g1/g1BarrierSet.inline.hpp"
 #include "gc/g1/g1BufferNodeList.hpp"
+#include "gc/g1/g1CardTable.hpp"
 #include "gc/g1/g1CardTableEntryClosure.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1ConcurrentRefineStats.hpp"
@@ -34,6 +35,7 @@
 #include "gc/g1/g1RedirtyCardsQueue.hpp"
 #include "gc/g1/g1RemSet.hpp"
 #include "gc/g1/g1ThreadLocalData.hpp"
+#include "gc/g1/heapRegion.hpp"
 #include "gc/g1/heapRegionRemSet.inline.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "memory/iterator.hpp"
@@ -44,6 +46,7 @@
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
+#include "utilities/align.hpp"
 #include "utilities/globalCounter.inline.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/nonblockingQueue.inline.hpp"
@@ -351,6 +354,11 @@ class G1RefineBufferedCards : public StackObj {
   const uint _worker_id;
   G1ConcurrentRefineStats* _stats;
   G1RemSet* const _g1rs;
+  G1CardTable* const _ct;
+
+  // Upper bound on the number of adjacent cards refined together, to keep
+  // the delay in reacting to a yield request short.
+  static const size_t MaxRefinementRun = 64;
 
   static inline int compare_card(const CardTable::CardValue* p1,
                                  const CardTable::CardValue* p2) {
@@ -404,16 +412,32 @@ class G1RefineBufferedCards : public StackObj {
     return first_clean;
   }
 
+  // Returns the number of cards starting at index i that are adjacent in the
+  // card table and cover the same region. The cards are sorted in decreasing
+  // address order, so the run ends with its lowest card.
+  size_t adjacent_cards(size_t i) const {
+    CardTable::CardValue* const first = _node_buffer[i];
+    size_t run = 1;
+    while (i + run < _node_buffer_size && run < MaxRefinementRun &&
+           _node_buffer[i + run] == first - run &&
+           !is_aligned(_ct->addr_for(first - run + 1), HeapRegion::GrainBytes)) {
+      ++run;
+    }
+    return run;
+  }
+
   bool refine_cleaned_cards(size_t start_index) {
     bool result = true;
     size_t i = start_index;
-    for ( ; i < _node_buffer_size; ++i) {
+    while (i < _node_buffer_size) {
       if (SuspendibleThreadSet::should_yield()) {
         redirty_unrefined_cards(i);
         result = false;
         break;
       }
-      _g1rs->refine_card_concurrently(_node_buffer[i], _worker_id);
+      size_t run = adjacent_cards(i);
+      _g1rs->refine_cards_concurrently(_node_buffer[i + run - 1], run, _worker_id);
+      i += run;
     }
     _node->set_index(i);
     _stats->inc_refined_cards(i - start_index);
@@ -436,7 +460,8 @@ public:
     _node_buffer_size(node_buffer_size),
     _worker_id(worker_id),
     _stats(stats),
-    _g1rs(G1CollectedHeap::heap()->rem_set()) {}
+    _g1rs(G1CollectedHeap::heap()->rem_set()),
+    _ct(G1CollectedHeap::heap()->card_table()) {}
 
   bool refine() {
     size_t first_clean_index = clean_cards();
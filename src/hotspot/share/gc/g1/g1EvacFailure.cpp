@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,48 +37,123 @@
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/align.hpp"
+
+// Fill the memory area from start to end with filler objects, and update the BOT
+// and the mark bitmap accordingly. The area may be adjacent to areas that other
+// workers are zapping at the same time, so BOT and bitmap updates must not
+// depend on the state of the region.
+static void zap_dead_objects(G1ConcurrentMark* cm, HeapRegion* hr, HeapWord* start, HeapWord* end) {
+  if (start == end) {
+    return;
+  }
 
-class RemoveSelfForwardPtrObjClosure {
-  G1CollectedHeap* _g1h;
-  G1ConcurrentMark* _cm;
-  HeapRegion* _hr;
-  size_t _marked_words;
-  bool _during_concurrent_start;
-  uint _worker_id;
-  HeapWord* _last_forwarded_object_end;
-
-public:
-  RemoveSelfForwardPtrObjClosure(HeapRegion* hr,
-                                 bool during_concurrent_start,
-                                 uint worker_id) :
-    _g1h(G1CollectedHeap::heap()),
-    _cm(_g1h->concurrent_mark()),
-    _hr(hr),
-    _marked_words(0),
-    _during_concurrent_start(during_concurrent_start),
-    _worker_id(worker_id),
-    _last_forwarded_object_end(hr->bottom()) { }
-
-  size_t marked_bytes() { return _marked_words * HeapWordSize; }
-
-  // Handle the marked objects in the region. These are self-forwarded objects
-  // that need to be kept live. We need to update the remembered sets of these
-  // objects. Further update the BOT and marks.
-  // We can coalesce and overwrite the remaining heap contents with dummy objects
-  // as they have either been dead or evacuated (which are unreferenced now, i.e.
-  // dead too) already.
-  size_t apply(oop obj) {
-    HeapWord* obj_addr = cast_from_oop<HeapWord*>(obj);
-    assert(_last_forwarded_object_end <= obj_addr, "should iterate in ascending address order");
-    assert(_hr->is_in(obj_addr), "sanity");
+  size_t gap_size = pointer_delta(end, start);
+  MemRegion mr(start, gap_size);
+  if (gap_size >= CollectedHeap::min_fill_size()) {
+    CollectedHeap::fill_with_objects(start, gap_size);
+
+    HeapWord* end_first_obj = start + cast_to_oop(start)->size();
+    hr->update_bot_for_block(start, end_first_obj);
+    // Fill_with_objects() may have created multiple (i.e. two)
+    // objects, as the max_fill_size() is half a region.
+    // After updating the BOT for the first object, also update the
+    // BOT for the second object to make the BOT complete.
+    if (end_first_obj != end) {
+      hr->update_bot_for_block(end_first_obj, end);
+#ifdef ASSERT
+      size_t size_second_obj = cast_to_oop(end_first_obj)->size();
+      HeapWord* end_of_second_obj = end_first_obj + size_second_obj;
+      assert(end == end_of_second_obj,
+             "More than two objects were used to fill the area from " PTR_FORMAT " to " PTR_FORMAT ", "
+             "second objects size " SIZE_FORMAT " ends at " PTR_FORMAT,
+             p2i(start), p2i(end), size_second_obj, p2i(end_of_second_obj));
+#endif
+    }
+  }
+  cm->par_clear_range_in_prev_bitmap(mr);
+}
 
+G1ParRemoveSelfForwardPtrsTask::G1ParRemoveSelfForwardPtrsTask(G1EvacFailureRegions* evac_failure_regions) :
+  WorkerTask("G1 Remove Self-forwarding Pointers"),
+  _g1h(G1CollectedHeap::heap()),
+  _evac_failure_regions(evac_failure_regions),
+  _chunks_per_region(0),
+  _chunk_size(0),
+  _num_chunks(0),
+  _next_chunk(0),
+  _live_bytes(NULL),
+  _remaining_chunks(NULL),
+  _during_concurrent_start(_g1h->collector_state()->in_concurrent_start_gc()) {
+
+  // Chunks are a multiple of the card size so that workers do not share
+  // BOT entries, and large enough that claiming them is cheap compared to
+  // walking them.
+  const size_t ChunkSizeBytes = 256 * K;
+  _chunks_per_region = MAX2((uint)(HeapRegion::GrainBytes / ChunkSizeBytes), 1u);
+  _chunk_size = align_up(HeapRegion::GrainWords / _chunks_per_region,
+                         (size_t)BOTConstants::card_size_in_words());
+
+  uint num_regions = num_failed_regions();
+  _num_chunks = num_regions * _chunks_per_region;
+  _live_bytes = NEW_C_HEAP_ARRAY(size_t, num_regions, mtGC);
+  _remaining_chunks = NEW_C_HEAP_ARRAY(uint, num_regions, mtGC);
+
+  bool during_concurrent_mark = _g1h->collector_state()->mark_or_rebuild_in_progress();
+
+  for (uint i = 0; i < num_regions; i++) {
+    HeapRegion* hr = _g1h->region_at(_evac_failure_regions->region_at(i));
+    assert(!hr->is_pinned(), "Unexpected pinned region at index %u", hr->hrm_index());
+    assert(hr->in_collection_set(), "bad CS");
+
+    _live_bytes[i] = 0;
+    _remaining_chunks[i] = _chunks_per_region;
+
+    // Marking objects in the next bitmap during chunk processing depends on
+    // the TAMS set up here, so this must be complete before any worker
+    // starts.
+    hr->clear_index_in_opt_cset();
+    hr->note_self_forwarding_removal_start(_during_concurrent_start,
+                                           during_concurrent_mark);
+  }
+}
+
+G1ParRemoveSelfForwardPtrsTask::~G1ParRemoveSelfForwardPtrsTask() {
+  FREE_C_HEAP_ARRAY(size_t, _live_bytes);
+  FREE_C_HEAP_ARRAY(uint, _remaining_chunks);
+}
+
+// Handle the marked objects starting in the chunk. These are self-forwarded
+// objects that need to be kept live. Further update the BOT and marks.
+// We can coalesce and overwrite the remaining heap contents following each of
+// these objects with dummy objects as they have either been dead or evacuated
+// (which are unreferenced now, i.e. dead too) already. The area in front of the
+// first marked object of a region is zapped by the first chunk of that region.
+void G1ParRemoveSelfForwardPtrsTask::process_chunk(uint worker_id, uint chunk_idx) {
+  uint region_idx = chunk_idx / _chunks_per_region;
+  uint chunk_in_region = chunk_idx % _chunks_per_region;
+  HeapRegion* hr = _g1h->region_at(_evac_failure_regions->region_at(region_idx));
+
+  G1ConcurrentMark* cm = _g1h->concurrent_mark();
+  // All objects that failed evacuation have been marked in the prev bitmap.
+  const G1CMBitMap* bitmap = cm->prev_mark_bitmap();
+
+  HeapWord* const top = hr->top();
+  HeapWord* const chunk_start = MIN2(hr->bottom() + chunk_in_region * _chunk_size, top);
+  HeapWord* const chunk_end = MIN2(chunk_start + _chunk_size, top);
+
+  HeapWord* obj_addr = bitmap->get_next_marked_addr(chunk_start, top);
+  if (chunk_in_region == 0) {
+    zap_dead_objects(cm, hr, hr->bottom(), obj_addr);
+  }
+
+  size_t marked_words = 0;
+  while (obj_addr < chunk_end) {
+    oop obj = cast_to_oop(obj_addr);
     // The object failed to move.
     assert(obj->is_forwarded() && obj->forwardee() == obj, "sanity");
 
-    zap_dead_objects(_last_forwarded_object_end, obj_addr);
-
-    // Zapping clears the bitmap, make sure it didn't clear too much.
-    assert(_cm->is_marked_in_prev_bitmap(obj), "should be correctly marked");
     if (_during_concurrent_start) {
       // For the next marking info we'll only mark the
       // self-forwarded objects explicitly if we are during
@@ -90,133 +165,55 @@ public:
       // explicitly and all objects in the CSet are considered
       // (implicitly) live. So, we won't mark them explicitly and
       // we'll leave them over NTAMS.
-      _cm->mark_in_next_bitmap(_worker_id, obj);
+      cm->mark_in_next_bitmap(worker_id, obj);
     }
     size_t obj_size = obj->size();
 
-    _marked_words += obj_size;
+    marked_words += obj_size;
     PreservedMarks::init_forwarded_mark(obj);
 
     HeapWord* obj_end = obj_addr + obj_size;
-    _last_forwarded_object_end = obj_end;
-    _hr->alloc_block_in_bot(obj_addr, obj_end);
-    return obj_size;
-  }
-
-  // Fill the memory area from start to end with filler objects, and update the BOT
-  // and the mark bitmap accordingly.
-  void zap_dead_objects(HeapWord* start, HeapWord* end) {
-    if (start == end) {
-      return;
-    }
-
-    size_t gap_size = pointer_delta(end, start);
-    MemRegion mr(start, gap_size);
-    if (gap_size >= CollectedHeap::min_fill_size()) {
-      CollectedHeap::fill_with_objects(start, gap_size);
-
-      HeapWord* end_first_obj = start + cast_to_oop(start)->size();
-      _hr->alloc_block_in_bot(start, end_first_obj);
-      // Fill_with_objects() may have created multiple (i.e. two)
-      // objects, as the max_fill_size() is half a region.
-      // After updating the BOT for the first object, also update the
-      // BOT for the second object to make the BOT complete.
-      if (end_first_obj != end) {
-        _hr->alloc_block_in_bot(end_first_obj, end);
-#ifdef ASSERT
-        size_t size_second_obj = cast_to_oop(end_first_obj)->size();
-        HeapWord* end_of_second_obj = end_first_obj + size_second_obj;
-        assert(end == end_of_second_obj,
-               "More than two objects were used to fill the area from " PTR_FORMAT " to " PTR_FORMAT ", "
-               "second objects size " SIZE_FORMAT " ends at " PTR_FORMAT,
-               p2i(start), p2i(end), size_second_obj, p2i(end_of_second_obj));
-#endif
-      }
-    }
-    _cm->clear_range_in_prev_bitmap(mr);
-  }
+    hr->update_bot_for_block(obj_addr, obj_end);
 
-  void zap_remainder() {
-    zap_dead_objects(_last_forwarded_object_end, _hr->top());
+    HeapWord* next_addr = bitmap->get_next_marked_addr(obj_end, top);
+    zap_dead_objects(cm, hr, obj_end, next_addr);
+    obj_addr = next_addr;
   }
-};
-
-class RemoveSelfForwardPtrHRClosure: public HeapRegionClosure {
-  G1CollectedHeap* _g1h;
-  uint _worker_id;
-
-  G1EvacFailureRegions* _evac_failure_regions;
 
-  G1GCPhaseTimes* _phase_times;
-
-public:
-  RemoveSelfForwardPtrHRClosure(uint worker_id,
-                                G1EvacFailureRegions* evac_failure_regions) :
-    _g1h(G1CollectedHeap::heap()),
-    _worker_id(worker_id),
-    _evac_failure_regions(evac_failure_regions),
-    _phase_times(G1CollectedHeap::heap()->phase_times()) {
+  if (marked_words > 0) {
+    Atomic::add(&_live_bytes[region_idx], marked_words * HeapWordSize);
   }
-
-  size_t remove_self_forward_ptr_by_walking_hr(HeapRegion* hr,
-                                               bool during_concurrent_start) {
-    RemoveSelfForwardPtrObjClosure rspc(hr,
-                                        during_concurrent_start,
-                                        _worker_id);
-
-    // All objects that failed evacuation has been marked in the prev bitmap.
-    // Use the bitmap to apply the above closure to all failing objects.
-    G1CMBitMap* bitmap = const_cast<G1CMBitMap*>(_g1h->concurrent_mark()->prev_mark_bitmap());
-    hr->apply_to_marked_objects(bitmap, &rspc);
-    // Need to zap the remainder area of the processed region.
-    rspc.zap_remainder();
-
-    return rspc.marked_bytes();
+  if (Atomic::sub(&_remaining_chunks[region_idx], 1u) == 0) {
+    finish_region(worker_id, region_idx, hr);
   }
+}
 
-  bool do_heap_region(HeapRegion *hr) {
-    assert(!hr->is_pinned(), "Unexpected pinned region at index %u", hr->hrm_index());
-    assert(hr->in_collection_set(), "bad CS");
-    assert(_evac_failure_regions->contains(hr->hrm_index()), "precondition");
-
-    hr->clear_index_in_opt_cset();
-
-    bool during_concurrent_start = _g1h->collector_state()->in_concurrent_start_gc();
-    bool during_concurrent_mark = _g1h->collector_state()->mark_or_rebuild_in_progress();
-
-    hr->note_self_forwarding_removal_start(during_concurrent_start,
-                                           during_concurrent_mark);
-
-    hr->reset_bot();
-
-    _phase_times->record_or_add_thread_work_item(G1GCPhaseTimes::RestoreRetainedRegions,
-                                                   _worker_id,
-                                                   1,
-                                                   G1GCPhaseTimes::RestoreRetainedRegionsNum);
-
-    size_t live_bytes = remove_self_forward_ptr_by_walking_hr(hr, during_concurrent_start);
-
-    hr->rem_set()->clean_strong_code_roots(hr);
-    hr->rem_set()->clear_locked(true);
-
-    hr->note_self_forwarding_removal_end(live_bytes);
-    _g1h->verifier()->check_bitmaps("Self-Forwarding Ptr Removal", hr);
+void G1ParRemoveSelfForwardPtrsTask::finish_region(uint worker_id, uint region_idx, HeapRegion* hr) {
+  _g1h->phase_times()->record_or_add_thread_work_item(G1GCPhaseTimes::RestoreRetainedRegions,
+                                                      worker_id,
+                                                      1,
+                                                      G1GCPhaseTimes::RestoreRetainedRegionsNum);
 
-    return false;
-  }
-};
+  hr->rem_set()->clean_strong_code_roots(hr);
+  hr->rem_set()->clear_locked(true);
 
-G1ParRemoveSelfForwardPtrsTask::G1ParRemoveSelfForwardPtrsTask(G1EvacFailureRegions* evac_failure_regions) :
-  WorkerTask("G1 Remove Self-forwarding Pointers"),
-  _g1h(G1CollectedHeap::heap()),
-  _hrclaimer(_g1h->workers()->active_workers()),
-  _evac_failure_regions(evac_failure_regions) { }
+  hr->note_self_forwarding_removal_end(Atomic::load(&_live_bytes[region_idx]));
+  // The BOT has been updated without maintaining the threshold; the region
+  // is fully described up to top now.
+  hr->update_bot_threshold();
+  _g1h->verifier()->check_bitmaps("Self-Forwarding Ptr Removal", hr);
+}
 
 void G1ParRemoveSelfForwardPtrsTask::work(uint worker_id) {
-  RemoveSelfForwardPtrHRClosure rsfp_cl(worker_id, _evac_failure_regions);
-
-  // Iterate through all regions that failed evacuation during the entire collection.
-  _evac_failure_regions->par_iterate(&rsfp_cl, &_hrclaimer, worker_id);
+  // Iterate through the chunks of all regions that failed evacuation during
+  // the entire collection.
+  while (true) {
+    uint chunk_idx = Atomic::fetch_and_add(&_next_chunk, 1u);
+    if (chunk_idx >= _num_chunks) {
+      break;
+    }
+    process_chunk(worker_id, chunk_idx);
+  }
 }
 
 uint G1ParRemoveSelfForwardPtrsTask::num_failed_regions() const {
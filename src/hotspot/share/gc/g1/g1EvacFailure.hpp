@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,29 +26,53 @@
 #define SHARE_GC_G1_G1EVACFAILURE_HPP
 
 #include "gc/g1/g1OopClosures.hpp"
-#include "gc/g1/heapRegionManager.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 class G1CollectedHeap;
 class G1EvacFailureRegions;
+class HeapRegion;
 
 // Task to fixup self-forwarding pointers
 // installed as a result of an evacuation failure.
+//
+// Every region that failed evacuation is split into fixed size chunks that
+// are claimed by the workers independently, so that a few regions with many
+// failed objects do not serialize the whole phase on their workers. The
+// per-region work that must happen exactly once is done in the constructor
+// (prologue) and by the worker that completes the last chunk of a region
+// (epilogue).
 class G1ParRemoveSelfForwardPtrsTask: public WorkerTask {
 protected:
   G1CollectedHeap* _g1h;
-  HeapRegionClaimer _hrclaimer;
 
   G1EvacFailureRegions* _evac_failure_regions;
-  uint volatile _num_failed_regions;
+
+  // The chunks are numbered consecutively over all failed regions.
+  uint _chunks_per_region;
+  size_t _chunk_size;
+  uint _num_chunks;
+  volatile uint _next_chunk;
+
+  // Per failed region live bytes found so far and number of chunks still
+  // to be processed, indexed by the position of the region in
+  // _evac_failure_regions.
+  volatile size_t* _live_bytes;
+  volatile uint* _remaining_chunks;
+
+  bool _during_concurrent_start;
+
+  void process_chunk(uint worker_id, uint chunk_idx);
+  void finish_region(uint worker_id, uint region_idx, HeapRegion* hr);
 
 public:
   G1ParRemoveSelfForwardPtrsTask(G1EvacFailureRegions* evac_failure_regions);
+  ~G1ParRemoveSelfForwardPtrsTask();
 
   void work(uint worker_id);
 
   uint num_failed_regions() const;
+  uint num_chunks() const { return _num_chunks; }
 };
 
 #endif // SHARE_GC_G1_G1EVACFAILURE_HPP
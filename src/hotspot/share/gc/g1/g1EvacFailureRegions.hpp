@@ -58,6 +58,12 @@ public:
                    HeapRegionClaimer* _hrclaimer,
                    uint worker_id) const;
 
+  // Returns the index of the i'th region that failed evacuation.
+  uint region_at(uint i) const {
+    assert(i < num_regions_failed_evacuation(), "out of bounds");
+    return _evac_failure_regions[i];
+  }
+
   uint num_regions_failed_evacuation() const {
     return Atomic::load(&_evac_failure_regions_cur_length);
   }
@@ -141,7 +141,9 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   enum GCMergePSSWorkItems {
     MergePSSCopiedBytes,
     MergePSSLABWasteBytes,
-    MergePSSLABUndoWasteBytes
+    MergePSSLABUndoWasteBytes,
+    MergePSSPLABFills,
+    MergePSSDirectAllocatedBytes
   };
 
   enum RestoreRetainedRegionsWorkItems {
@@ -38,7 +38,8 @@ G1HeapSizingPolicy* G1HeapSizingPolicy::create(const G1CollectedHeap* g1h, const
 G1HeapSizingPolicy::G1HeapSizingPolicy(const G1CollectedHeap* g1h, const G1Analytics* analytics) :
   _g1h(g1h),
   _analytics(analytics),
-  _num_prev_pauses_for_heuristics(analytics->number_of_recorded_pause_times()) {
+  _num_prev_pauses_for_heuristics(analytics->number_of_recorded_pause_times()),
+  _ratio_under_threshold_count(0) {
 
   assert(MinOverThresholdForGrowth < _num_prev_pauses_for_heuristics, "Threshold must be less than %u", _num_prev_pauses_for_heuristics);
   clear_ratio_check_data();
@@ -50,6 +51,13 @@ void G1HeapSizingPolicy::clear_ratio_check_data() {
   _pauses_since_start = 0;
 }
 
+double G1HeapSizingPolicy::pause_time_threshold() const {
+  if (G1GCOverheadTargetPercent > 0) {
+    return G1GCOverheadTargetPercent / 100.0;
+  }
+  return 1.0 / (1.0 + GCTimeRatio);
+}
+
 double G1HeapSizingPolicy::scale_with_heap(double pause_time_threshold) {
   double threshold = pause_time_threshold;
   // If the heap is at less than half its maximum size, scale the threshold down,
@@ -87,7 +95,7 @@ size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
 
   double long_term_pause_time_ratio = _analytics->long_term_pause_time_ratio();
   double short_term_pause_time_ratio = _analytics->short_term_pause_time_ratio();
-  const double pause_time_threshold = 1.0 / (1.0 + GCTimeRatio);
+  const double pause_time_threshold = this->pause_time_threshold();
   double threshold = scale_with_heap(pause_time_threshold);
 
   size_t expand_bytes = 0;
@@ -177,6 +185,7 @@ size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
     expand_bytes = clamp(expand_bytes, min_expand_bytes, uncommitted_bytes);
 
     clear_ratio_check_data();
+    _ratio_under_threshold_count = 0;
   } else {
     // An expansion was not triggered. If we've started counting, increment
     // the number of checks we've made in the current window.  If we've
@@ -212,6 +221,62 @@ static size_t target_heap_capacity(size_t used_bytes, uintx free_ratio) {
   return (size_t) desired_capacity_d;
 }
 
+size_t G1HeapSizingPolicy::young_collection_shrink_amount() {
+  assert(G1GCOverheadTargetPercent > 0, "only shrink after young collections with an overhead target");
+
+  double long_term_pause_time_ratio = _analytics->long_term_pause_time_ratio();
+  double short_term_pause_time_ratio = _analytics->short_term_pause_time_ratio();
+  double threshold = pause_time_threshold() * ShrinkThresholdFactor;
+
+  if (short_term_pause_time_ratio > threshold || long_term_pause_time_ratio > threshold) {
+    _ratio_under_threshold_count = 0;
+    return 0;
+  }
+
+  // Only shrink if the overhead has been low for a full window of pauses,
+  // so that a single cheap pause does not give back memory the application
+  // will need again soon.
+  if (++_ratio_under_threshold_count < _num_prev_pauses_for_heuristics) {
+    return 0;
+  }
+  _ratio_under_threshold_count = 0;
+
+  // Keep the free space required by MinHeapFreeRatio so that we do not need
+  // to expand again right away.
+  const size_t capacity = _g1h->capacity();
+  const size_t used = _g1h->used();
+  const size_t minimum_capacity = MAX2(target_heap_capacity(used, MinHeapFreeRatio), MinHeapSize);
+  if (capacity <= minimum_capacity) {
+    return 0;
+  }
+
+  // Shrink in steps so that a decreasing demand is followed smoothly.
+  size_t shrink_bytes = MIN2(capacity - minimum_capacity,
+                             MAX2(capacity * ShrinkStepPercent / 100, HeapRegion::GrainBytes));
+
+  log_debug(gc, ergo, heap)("Heap shrinking: "
+                            "short term pause time ratio %1.2f%% long term pause time ratio %1.2f%% "
+                            "threshold %1.2f%% capacity: " SIZE_FORMAT "B used: " SIZE_FORMAT "B "
+                            "minimum capacity: " SIZE_FORMAT "B resize by " SIZE_FORMAT "B",
+                            short_term_pause_time_ratio * 100.0,
+                            long_term_pause_time_ratio * 100.0,
+                            threshold * 100.0,
+                            capacity, used, minimum_capacity, shrink_bytes);
+
+  return shrink_bytes;
+}
+
+size_t G1HeapSizingPolicy::young_collection_resize_amount(bool& expand) {
+  expand = true;
+  size_t expand_bytes = young_collection_expansion_amount();
+  if (expand_bytes > 0 || G1GCOverheadTargetPercent == 0) {
+    return expand_bytes;
+  }
+
+  expand = false;
+  return young_collection_shrink_amount();
+}
+
 size_t G1HeapSizingPolicy::full_collection_resize_amount(bool& expand) {
   // Capacity, free and used after the GC counted as full regions to
   // include the waste in the following calculations.
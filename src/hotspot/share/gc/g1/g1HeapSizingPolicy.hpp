@@ -35,6 +35,11 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   // pause times in G1Analytics, representing the minimum number of pause
   // time ratios that exceed GCTimeRatio before a heap expansion will be triggered.
   const static uint MinOverThresholdForGrowth = 4;
+  // With G1GCOverheadTargetPercent, the heap is shrunk after young collections
+  // if the pause time ratio stayed below this fraction of the target for a full
+  // window of pauses, by at most ShrinkStepPercent of the capacity at a time.
+  static constexpr double ShrinkThresholdFactor = 0.5;
+  const static uint ShrinkStepPercent = 10;
 
   const G1CollectedHeap* _g1h;
   const G1Analytics* _analytics;
@@ -44,6 +49,11 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   uint _ratio_over_threshold_count;
   double _ratio_over_threshold_sum;
   uint _pauses_since_start;
+  // Number of consecutive pauses with a pause time ratio low enough to shrink.
+  uint _ratio_under_threshold_count;
+
+  // The pause time ratio the heap is sized for.
+  double pause_time_threshold() const;
 
   // Scale "full" gc pause time threshold with heap size as we want to resize more
   // eagerly at small heap sizes.
@@ -55,6 +65,14 @@ public:
   // If an expansion would be appropriate, because recent GC overhead had
   // exceeded the desired limit, return an amount to expand by.
   size_t young_collection_expansion_amount();
+  // If shrinking would be appropriate, because recent GC overhead has been
+  // well below G1GCOverheadTargetPercent, return an amount to shrink by.
+  size_t young_collection_shrink_amount();
+
+  // Returns the amount of bytes to resize the heap after a young collection;
+  // if expand is set, the heap should be expanded by that amount, shrunk
+  // otherwise.
+  size_t young_collection_resize_amount(bool& expand);
 
   // Returns the amount of bytes to resize the heap; if expand is set, the heap
   // should by expanded by that amount, shrunk otherwise.
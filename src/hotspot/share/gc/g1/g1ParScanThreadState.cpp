@@ -145,6 +145,14 @@ size_t G1ParScanThreadState::lab_undo_waste_words() const {
   return _plab_allocator->undo_waste();
 }
 
+size_t G1ParScanThreadState::num_plab_fills() const {
+  return _plab_allocator->num_plab_fills();
+}
+
+size_t G1ParScanThreadState::direct_allocated_words() const {
+  return _plab_allocator->direct_allocated();
+}
+
 #ifdef ASSERT
 void G1ParScanThreadState::verify_task(narrowOop* task) const {
   assert(task != NULL, "invariant");
@@ -451,6 +459,11 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   uint age = 0;
   G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, age);
   HeapRegion* const from_region = _g1h->heap_region_containing(old);
+  if (from_region->has_pinned_objects()) {
+    // Objects in JNI critical sections must stay in place, and we do not know
+    // which objects of the region these are. Keep the whole region.
+    return handle_evacuation_failure_par(old, old_mark, word_sz);
+  }
   uint node_index = from_region->node_index();
 
   HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_attr, word_sz, node_index);
@@ -582,15 +595,19 @@ void G1ParScanThreadStateSet::flush() {
 
     G1GCPhaseTimes* p = _g1h->phase_times();
 
-    // Need to get the following two before the call to G1ParThreadScanState::flush()
+    // Need to get the following before the call to G1ParThreadScanState::flush()
     // because it resets the PLAB allocator where we get this info from.
     size_t lab_waste_bytes = pss->lab_waste_words() * HeapWordSize;
     size_t lab_undo_waste_bytes = pss->lab_undo_waste_words() * HeapWordSize;
+    size_t plab_fills = pss->num_plab_fills();
+    size_t direct_allocated_bytes = pss->direct_allocated_words() * HeapWordSize;
     size_t copied_bytes = pss->flush(_surviving_young_words_total) * HeapWordSize;
 
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, copied_bytes, G1GCPhaseTimes::MergePSSCopiedBytes);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, lab_waste_bytes, G1GCPhaseTimes::MergePSSLABWasteBytes);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, lab_undo_waste_bytes, G1GCPhaseTimes::MergePSSLABUndoWasteBytes);
+    p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, plab_fills, G1GCPhaseTimes::MergePSSPLABFills);
+    p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, direct_allocated_bytes, G1GCPhaseTimes::MergePSSDirectAllocatedBytes);
 
     delete pss;
     _states[worker_id] = NULL;
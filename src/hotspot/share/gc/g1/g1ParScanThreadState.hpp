@@ -149,6 +149,8 @@ public:
 
   size_t lab_waste_words() const;
   size_t lab_undo_waste_words() const;
+  size_t num_plab_fills() const;
+  size_t direct_allocated_words() const;
 
   // Pass locally gathered statistics to global state. Returns the total number of
   // HeapWords copied.
@@ -38,6 +38,7 @@
 #include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1SurvivorRegions.hpp"
+#include "gc/g1/g1Trace.hpp"
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionRemSet.inline.hpp"
@@ -75,6 +76,9 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _rs_length(0),
   _rs_length_prediction(0),
   _pending_cards_at_gc_start(0),
+  _predicted_base_time_ms(0.0),
+  _predicted_young_time_ms(0.0),
+  _predicted_old_time_ms(0.0),
   _concurrent_start_to_mixed(),
   _collection_set(NULL),
   _g1h(NULL),
@@ -310,7 +314,7 @@ uint G1Policy::calculate_young_list_target_length(size_t rs_length,
   assert(desired_max_length > base_min_length, "invariant");
   uint max_young_length = desired_max_length - base_min_length;
 
-  const double target_pause_time_ms = _mmu_tracker->max_gc_time() * 1000.0;
+  const double target_pause_time_ms = corrected_pause_time_target_ms(max_pause_time_ms());
   const size_t pending_cards = _analytics->predict_pending_cards();
   const double base_time_ms = predict_base_elapsed_time_ms(pending_cards, rs_length);
   const uint available_free_regions = _free_regions_at_end_of_collection;
@@ -626,6 +630,35 @@ double G1Policy::logged_cards_processing_time() const {
   return (all_cards_processing_time * logged_dirty_cards / scan_heap_roots_cards) + average_time_ms(G1GCPhaseTimes::MergeLB);
 }
 
+double G1Policy::corrected_pause_time_target_ms(double target_pause_time_ms) const {
+  if (!G1UsePausePredictionErrorCorrection) {
+    return target_pause_time_ms;
+  }
+  // Only ever tighten the target, and at most by half, so that a few badly
+  // mispredicted pauses can not shrink the young generation to nothing.
+  double ratio = clamp(_analytics->predict_pause_time_prediction_ratio(), 1.0, 2.0);
+  return target_pause_time_ms / ratio;
+}
+
+void G1Policy::update_pause_time_prediction_error(double pause_time_ms, bool update_stats) {
+  double predicted_pause_time_ms = _predicted_base_time_ms + _predicted_young_time_ms + _predicted_old_time_ms;
+
+  log_debug(gc, ergo)("Pause time prediction: predicted %1.2fms (base %1.2fms, young %1.2fms, old %1.2fms), "
+                      "actual %1.2fms, target %1.2fms",
+                      predicted_pause_time_ms, _predicted_base_time_ms, _predicted_young_time_ms,
+                      _predicted_old_time_ms, pause_time_ms, max_pause_time_ms());
+
+  _g1h->gc_tracer_stw()->report_pause_time_prediction(max_pause_time_ms(),
+                                                      _predicted_base_time_ms,
+                                                      _predicted_young_time_ms,
+                                                      _predicted_old_time_ms,
+                                                      pause_time_ms);
+
+  if (update_stats && predicted_pause_time_ms > 0.0) {
+    _analytics->report_pause_time_prediction_ratio(pause_time_ms / predicted_pause_time_ms);
+  }
+}
+
 // Anything below that is considered to be zero
 #define MIN_TIMER_GRANULARITY 0.0000001
 
@@ -656,6 +689,8 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
   // We make the assumption that these are rare.
   bool update_stats = !evacuation_failure;
 
+  update_pause_time_prediction_error(pause_time_ms, update_stats);
+
   if (update_stats) {
     // We maintain the invariant that all objects allocated by mutator
     // threads will be allocated out of eden regions. So, we can use
@@ -1314,7 +1349,6 @@ void G1Policy::calculate_old_collection_set_regions(G1CollectionSetCandidates* c
   uint num_expensive_regions = 0;
 
   double predicted_old_time_ms = 0.0;
-  double predicted_initial_time_ms = 0.0;
   double predicted_optional_time_ms = 0.0;
 
   double optional_threshold_ms = time_remaining_ms * optional_prediction_fraction();
@@ -1381,10 +1415,12 @@ void G1Policy::calculate_old_collection_set_regions(G1CollectionSetCandidates* c
                               num_expensive_regions);
   }
 
+  _predicted_old_time_ms += predicted_old_time_ms;
+
   log_debug(gc, ergo, cset)("Finish choosing collection set old regions. Initial: %u, optional: %u, "
                             "predicted old time: %1.2fms, predicted optional time: %1.2fms, time remaining: %1.2f",
                             num_initial_regions, num_optional_regions,
-                            predicted_initial_time_ms, predicted_optional_time_ms, time_remaining_ms);
+                            predicted_old_time_ms, predicted_optional_time_ms, time_remaining_ms);
 }
 
 void G1Policy::calculate_optional_collection_set_regions(G1CollectionSetCandidates* candidates,
@@ -1395,6 +1431,7 @@ void G1Policy::calculate_optional_collection_set_regions(G1CollectionSetCandidat
 
   num_optional_regions = 0;
   double prediction_ms = 0;
+  double selected_prediction_ms = 0;
   uint candidate_idx = candidates->cur_idx();
 
   HeapRegion* r = candidates->at(candidate_idx);
@@ -1409,11 +1446,14 @@ void G1Policy::calculate_optional_collection_set_regions(G1CollectionSetCandidat
     }
     // This region will be included in the next optional evacuation.
 
+    selected_prediction_ms = prediction_ms;
     time_remaining_ms -= prediction_ms;
     num_optional_regions++;
     r = candidates->at(++candidate_idx);
   }
 
+  _predicted_old_time_ms += selected_prediction_ms;
+
   log_debug(gc, ergo, cset)("Prepared %u regions out of %u for optional evacuation. Predicted time: %.3fms",
                             num_optional_regions, max_optional_regions, prediction_ms);
 }
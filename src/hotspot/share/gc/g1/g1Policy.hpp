@@ -109,6 +109,15 @@ class G1Policy: public CHeapObj<mtGC> {
 
   size_t _pending_cards_at_gc_start;
 
+  // Predicted times of the parts of the current pause, recorded while choosing
+  // the collection set to be compared with the actual pause time afterwards.
+  double _predicted_base_time_ms;
+  double _predicted_young_time_ms;
+  double _predicted_old_time_ms;
+
+  // Compare the actual pause time with the predictions and report the result.
+  void update_pause_time_prediction_error(double pause_time_ms, bool update_stats);
+
   G1ConcurrentStartToMixedTimeTracker _concurrent_start_to_mixed;
 
   bool should_update_surv_rate_group_predictors() {
@@ -170,6 +179,11 @@ public:
     return _mmu_tracker->max_gc_time() * 1000.0;
   }
 
+  // The pause time goal the young generation and collection set are sized
+  // for. With G1UsePausePredictionErrorCorrection this is the given pause time
+  // target reduced by how much recent pauses exceeded their predictions.
+  double corrected_pause_time_target_ms(double target_pause_time_ms) const;
+
 private:
   G1CollectionSet* _collection_set;
   double average_time_ms(G1GCPhaseTimes::GCParPhases phase) const;
@@ -249,6 +263,12 @@ private:
 public:
   size_t pending_cards_at_gc_start() const { return _pending_cards_at_gc_start; }
 
+  void record_predicted_young_time_ms(double base_time_ms, double young_time_ms) {
+    _predicted_base_time_ms = base_time_ms;
+    _predicted_young_time_ms = young_time_ms;
+    _predicted_old_time_ms = 0.0;
+  }
+
   // Calculate the minimum number of old regions we'll add to the CSet
   // during a mixed GC.
   uint calc_min_old_cset_length(G1CollectionSetCandidates* candidates) const;
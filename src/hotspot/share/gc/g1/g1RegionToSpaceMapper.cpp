@@ -241,14 +241,25 @@ class G1RegionsSmallerThanCommitSizeMapper : public G1RegionToSpaceMapper {
     // updates to _region_commit_map for this mapper is protected by _lock.
     _region_commit_map.clear_range(start_idx, region_limit, BitMap::unknown_range);
 
+    // We know all pages were committed before clearing the map. If the
+    // the page is still marked as committed after the clear we should
+    // not uncommit it. Runs of uncommittable pages are uncommitted with
+    // a single call, which is cheaper than a call (and TLB shootdown)
+    // per page.
+    size_t first_uncommitted = SIZE_MAX;
     for (size_t page = start_page; page <= end_page; page++) {
-      // We know all pages were committed before clearing the map. If the
-      // the page is still marked as committed after the clear we should
-      // not uncommit it.
       if (!is_page_committed(page)) {
-        _storage.uncommit(page, 1);
+        if (first_uncommitted == SIZE_MAX) {
+          first_uncommitted = page;
+        }
+      } else if (first_uncommitted != SIZE_MAX) {
+        _storage.uncommit(first_uncommitted, page - first_uncommitted);
+        first_uncommitted = SIZE_MAX;
       }
     }
+    if (first_uncommitted != SIZE_MAX) {
+      _storage.uncommit(first_uncommitted, end_page + 1 - first_uncommitted);
+    }
   }
 };
 
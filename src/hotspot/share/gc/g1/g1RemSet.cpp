@@ -58,6 +58,7 @@
 #include "utilities/align.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
+#include "utilities/quickSort.hpp"
 #include "utilities/stack.inline.hpp"
 #include "utilities/ticks.hpp"
 #include CPU_HEADER(gc/g1/g1Globals)
@@ -661,6 +662,26 @@ private:
     return value == G1CardTable::WordAllDirty;
   }
 
+  // Number of words of cards examined at once when skipping long runs.
+  static const size_t BlockWords = 4;
+  static const size_t BlockCards = BlockWords * sizeof(size_t);
+
+  bool cur_block_fits() const {
+    return pointer_delta(_end_addr, _cur_addr, sizeof(CardValue)) >= BlockCards;
+  }
+
+  bool cur_block_of_cards_contains_any_dirty_card() const {
+    assert(cur_addr_aligned(), "Current address should be aligned");
+    const size_t* w = (const size_t*)_cur_addr;
+    return (~(w[0] & w[1] & w[2] & w[3]) & ExpandedToScanMask) != 0;
+  }
+
+  bool cur_block_of_cards_all_dirty_cards() const {
+    assert(cur_addr_aligned(), "Current address should be aligned");
+    const size_t* w = (const size_t*)_cur_addr;
+    return (w[0] | w[1] | w[2] | w[3]) == G1CardTable::WordAllDirty;
+  }
+
   size_t get_and_advance_pos() {
     _cur_addr++;
     return pointer_delta(_cur_addr, _base_addr, sizeof(CardValue)) - 1;
@@ -685,6 +706,9 @@ public:
     }
 
     assert(cur_addr_aligned(), "Current address should be aligned now.");
+    while (cur_block_fits() && !cur_block_of_cards_contains_any_dirty_card()) {
+      _cur_addr += BlockCards;
+    }
     while (_cur_addr != _end_addr) {
       if (cur_word_of_cards_contains_any_dirty_card()) {
         for (size_t i = 0; i < sizeof(size_t); i++) {
@@ -711,6 +735,9 @@ public:
     }
 
     assert(cur_addr_aligned(), "Current address should be aligned now.");
+    while (cur_block_fits() && cur_block_of_cards_all_dirty_cards()) {
+      _cur_addr += BlockCards;
+    }
     while (_cur_addr != _end_addr) {
       if (!cur_word_of_cards_all_dirty_cards()) {
         for (size_t i = 0; i < sizeof(size_t); i++) {
@@ -1697,13 +1724,16 @@ bool G1RemSet::clean_card_before_refine(CardValue** const card_ptr_addr) {
   return true;
 }
 
-void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
-                                        const uint worker_id) {
+void G1RemSet::refine_cards_concurrently(CardValue* const first_card_ptr,
+                                         size_t num_cards,
+                                         const uint worker_id) {
   assert(!_g1h->is_gc_active(), "Only call concurrently");
-  check_card_ptr(card_ptr, _ct);
+  assert(num_cards > 0, "must refine at least one card");
+  check_card_ptr(first_card_ptr, _ct);
+  check_card_ptr(first_card_ptr + num_cards - 1, _ct);
 
-  // Construct the MemRegion representing the card.
-  HeapWord* start = _ct->addr_for(card_ptr);
+  // Construct the MemRegion representing the cards.
+  HeapWord* start = _ct->addr_for(first_card_ptr);
   // And find the region containing it.
   HeapRegion* r = _g1h->heap_region_containing(start);
   // This reload of the top is safe even though it happens after the full
@@ -1717,7 +1747,8 @@ void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
 
   // Don't use addr_for(card_ptr + 1) which can ask for
   // a card beyond the heap.
-  HeapWord* end = start + G1CardTable::card_size_in_words();
+  HeapWord* end = start + num_cards * G1CardTable::card_size_in_words();
+  assert(end <= r->end(), "cards must not span regions");
   MemRegion dirty_region(start, MIN2(scan_limit, end));
   assert(!dirty_region.is_empty(), "sanity");
 
@@ -1726,20 +1757,22 @@ void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
     return;
   }
 
-  // If unable to process the card then we encountered an unparsable
+  // If unable to process the cards then we encountered an unparsable
   // part of the heap (e.g. a partially allocated object, so only
   // temporarily a problem) while processing a stale card.  Despite
   // the card being stale, we can't simply ignore it, because we've
   // already marked the card cleaned, so taken responsibility for
-  // ensuring the card gets scanned.
+  // ensuring the card gets scanned. We don't know how far the walk
+  // got, so all the cards of the run are retried.
   //
   // However, the card might have gotten re-dirtied and re-enqueued
   // while we worked.  (In fact, it's pretty likely.)
-  if (*card_ptr == G1CardTable::dirty_card_val()) {
-    return;
+  for (size_t i = 0; i < num_cards; i++) {
+    CardValue* card_ptr = first_card_ptr + i;
+    if (*card_ptr != G1CardTable::dirty_card_val()) {
+      enqueue_for_reprocessing(card_ptr);
+    }
   }
-
-  enqueue_for_reprocessing(card_ptr);
 }
 
 // Re-dirty and re-enqueue the card to retry refinement later.
@@ -2018,18 +2051,58 @@ public:
     }
   };
 
-  HeapRegionClaimer _hr_claimer;
+  // A region to rebuild the remembered set for, with its live bytes at the
+  // end of marking.
+  struct RebuildRegion {
+    uint _region_idx;
+    size_t _live_bytes;
+  };
+
+  static int order_by_live_bytes(RebuildRegion a, RebuildRegion b) {
+    if (a._live_bytes != b._live_bytes) {
+      return a._live_bytes < b._live_bytes ? -1 : 1;
+    }
+    return a._region_idx < b._region_idx ? -1 : (a._region_idx > b._region_idx ? 1 : 0);
+  }
+
   G1ConcurrentMark* _cm;
 
+  // The regions selected for rebuild, ordered by increasing live bytes. These
+  // are the most efficient to collect, so their remembered sets are completed
+  // first.
+  RebuildRegion* _regions;
+  uint _num_regions;
+  volatile uint _next_region;
+
   uint _worker_id_offset;
+
+  void collect_regions() {
+    uint max_regions = G1CollectedHeap::heap()->max_reserved_regions();
+    _regions = NEW_C_HEAP_ARRAY(RebuildRegion, max_regions, mtGC);
+    for (uint i = 0; i < max_regions; i++) {
+      if (_cm->top_at_rebuild_start(i) != NULL) {
+        _regions[_num_regions]._region_idx = i;
+        _regions[_num_regions]._live_bytes = _cm->live_bytes(i);
+        _num_regions++;
+      }
+    }
+    QuickSort::sort(_regions, _num_regions, order_by_live_bytes, true);
+  }
+
 public:
   G1RebuildRemSetTask(G1ConcurrentMark* cm,
-                      uint n_workers,
                       uint worker_id_offset) :
       WorkerTask("G1 Rebuild Remembered Set"),
-      _hr_claimer(n_workers),
       _cm(cm),
+      _regions(NULL),
+      _num_regions(0),
+      _next_region(0),
       _worker_id_offset(worker_id_offset) {
+    collect_regions();
+  }
+
+  ~G1RebuildRemSetTask() {
+    FREE_C_HEAP_ARRAY(RebuildRegion, _regions);
   }
 
   void work(uint worker_id) {
@@ -2038,7 +2111,21 @@ public:
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
     G1RebuildRemSetHeapRegionClosure cl(g1h, _cm, _worker_id_offset + worker_id);
-    g1h->heap_region_par_iterate_from_worker_offset(&cl, &_hr_claimer, worker_id);
+    while (true) {
+      uint i = Atomic::fetch_and_add(&_next_region, 1u);
+      if (i >= _num_regions) {
+        break;
+      }
+      uint region_idx = _regions[i]._region_idx;
+      // The region may have been eagerly reclaimed (and even uncommitted) since
+      // the regions were collected.
+      if (_cm->top_at_rebuild_start(region_idx) == NULL) {
+        continue;
+      }
+      if (cl.do_heap_region(g1h->region_at(region_idx))) {
+        break;
+      }
+    }
   }
 };
 
@@ -2048,7 +2135,6 @@ void G1RemSet::rebuild_rem_set(G1ConcurrentMark* cm,
   uint num_workers = workers->active_workers();
 
   G1RebuildRemSetTask cl(cm,
-                         num_workers,
                          worker_id_offset);
   workers->run_task(&cl, num_workers);
 }
@@ -136,11 +136,14 @@ public:
   // card needs later refinement. Note that "*card_ptr_addr" could be updated to
   // a different card due to use of hot card cache.
   bool clean_card_before_refine(CardValue** const card_ptr_addr);
-  // Refine the region corresponding to "card_ptr". Must be called after
-  // being filtered by clean_card_before_refine(), and after proper
-  // fence/synchronization.
-  void refine_card_concurrently(CardValue* const card_ptr,
-                                const uint worker_id);
+  // Refine the region corresponding to the "num_cards" adjacent cards starting
+  // at "first_card_ptr", which must all cover the same heap region. Must be
+  // called after each card has been filtered by clean_card_before_refine(),
+  // and after proper fence/synchronization. Refining a run of cards with a
+  // single walk avoids finding the first object of every card again.
+  void refine_cards_concurrently(CardValue* const first_card_ptr,
+                                 size_t num_cards,
+                                 const uint worker_id);
 
   // Print accumulated summary info from the start of the VM.
   void print_summary_info();
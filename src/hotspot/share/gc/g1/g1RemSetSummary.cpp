@@ -29,6 +29,7 @@
 #include "gc/g1/g1ConcurrentRefine.hpp"
 #include "gc/g1/g1ConcurrentRefineThread.hpp"
 #include "gc/g1/g1DirtyCardQueue.hpp"
+#include "gc/g1/g1NUMA.hpp"
 #include "gc/g1/g1RemSet.hpp"
 #include "gc/g1/g1RemSetSummary.hpp"
 #include "gc/g1/heapRegion.hpp"
@@ -206,6 +207,10 @@ private:
   size_t _max_rs_mem_sz;
   HeapRegion* _max_rs_mem_sz_region;
 
+  // Remembered set sizes per NUMA node the remembered set memory is pooled on.
+  uint _num_nodes;
+  size_t* _node_rs_mem_sz;
+
   size_t total_rs_wasted_mem_sz() const     { return _all.rs_wasted_mem_size(); }
   size_t total_rs_mem_sz() const            { return _all.rs_mem_size(); }
   size_t total_cards_occupied() const       { return _all.cards_occupied(); }
@@ -226,8 +231,18 @@ public:
   HRRSStatsIter() : _young("Young"), _humongous("Humongous"),
     _free("Free"), _old("Old"), _archive("Archive"), _all("All"),
     _max_rs_mem_sz(0), _max_rs_mem_sz_region(NULL),
+    _num_nodes(G1NUMA::numa()->num_active_nodes()),
+    _node_rs_mem_sz(NEW_C_HEAP_ARRAY(size_t, _num_nodes, mtGC)),
     _max_code_root_mem_sz(0), _max_code_root_mem_sz_region(NULL)
-  {}
+  {
+    for (uint i = 0; i < _num_nodes; i++) {
+      _node_rs_mem_sz[i] = 0;
+    }
+  }
+
+  ~HRRSStatsIter() {
+    FREE_C_HEAP_ARRAY(size_t, _node_rs_mem_sz);
+  }
 
   bool do_heap_region(HeapRegion* r) {
     HeapRegionRemSet* hrrs = r->rem_set();
@@ -240,6 +255,7 @@ public:
       _max_rs_mem_sz = rs_mem_sz;
       _max_rs_mem_sz_region = r;
     }
+    _node_rs_mem_sz[G1NUMA::numa()->preferred_node_index_for_index(r->hrm_index())] += rs_mem_sz;
     size_t occupied_cards = hrrs->occupied();
     size_t code_root_mem_sz = hrrs->strong_code_roots_mem_size();
     if (code_root_mem_sz > max_code_root_mem_sz()) {
@@ -282,6 +298,14 @@ public:
     for (RegionTypeCounter** current = &counters[0]; *current != NULL; current++) {
       (*current)->print_rs_mem_info_on(out, total_rs_mem_sz());
     }
+    if (_num_nodes > 1) {
+      for (uint i = 0; i < _num_nodes; i++) {
+        out->print_cr("    " SIZE_FORMAT_W(8) "%s on node %d",
+                      byte_size_in_proper_unit(_node_rs_mem_sz[i]),
+                      proper_unit_for_byte_size(_node_rs_mem_sz[i]),
+                      G1NUMA::numa()->numa_id(i));
+      }
+    }
 
     out->print_cr("    " SIZE_FORMAT " occupied cards represented.",
                   total_cards_occupied());
@@ -298,7 +322,7 @@ public:
                   rem_set->occupied());
 
     HeapRegionRemSet::print_static_mem_size(out);
-    G1CardSetFreePool::free_list_pool()->print_on(out);
+    G1CardSetFreePool::print_free_list_pools_on(out);
 
     // Strong code root statistics
     HeapRegionRemSet* max_code_root_rem_set = max_code_root_mem_sz_region()->rem_set();
@@ -182,7 +182,9 @@ void G1RootProcessor::process_java_roots(G1RootClosures* closures,
     bool is_par = n_workers() > 1;
     Threads::possibly_parallel_oops_do(is_par,
                                        closures->strong_oops(),
-                                       closures->strong_codeblobs());
+                                       closures->strong_codeblobs(),
+                                       worker_id,
+                                       n_workers());
   }
 
   {
@@ -51,24 +51,37 @@ static size_t keep_size(size_t free, size_t used, double percent) {
 bool G1SegmentedArrayFreeMemoryTask::calculate_return_infos(jlong deadline) {
   // Ignore the deadline in this step as it is very short.
 
-  G1SegmentedArrayMemoryStats used = _total_used;
-  G1SegmentedArrayMemoryStats free = G1SegmentedArrayFreePool<mtGCCardSet>::free_list_sizes();
+  typedef G1SegmentedArrayFreePool<mtGCCardSet> FreePool;
 
-  _return_info = new G1ReturnMemoryProcessorSet(used.num_pools());
-  for (uint i = 0; i < used.num_pools(); i++) {
-    size_t return_to_vm_size = keep_size(free._num_mem_sizes[i],
+  G1SegmentedArrayMemoryStats used = _total_used;
+  G1SegmentedArrayMemoryStats free = FreePool::free_list_sizes();
+
+  // The amount of memory to keep for a type is distributed across the per-node
+  // pools according to how much each of them currently has free.
+  uint num_pools = FreePool::num_free_list_pools();
+  _return_info = new G1ReturnMemoryProcessorSet(num_pools * used.num_pools());
+  for (uint p = 0; p < num_pools; p++) {
+    G1SegmentedArrayMemoryStats pool_free = FreePool::free_list_pool(p)->memory_sizes();
+    for (uint i = 0; i < used.num_pools(); i++) {
+      size_t total_keep_size = keep_size(free._num_mem_sizes[i],
                                          used._num_mem_sizes[i],
                                          G1RemSetFreeMemoryKeepExcessRatio);
-    log_trace(gc, task)("Segmented Array Free Memory: Type %s: Free: %zu (%zu) "
-                        "Used: %zu Keep: %zu",
-                        G1CardSetConfiguration::mem_object_type_name_str(i),
-                        free._num_mem_sizes[i], free._num_segments[i],
-                        used._num_mem_sizes[i], return_to_vm_size);
-
-    _return_info->append(new G1ReturnMemoryProcessor(return_to_vm_size));
+      size_t return_to_vm_size = 0;
+      if (free._num_mem_sizes[i] > 0) {
+        return_to_vm_size = (size_t)((double)total_keep_size * pool_free._num_mem_sizes[i] / free._num_mem_sizes[i]);
+      }
+      log_trace(gc, task)("Segmented Array Free Memory: Node %u Type %s: Free: %zu (%zu) "
+                          "Used: %zu Keep: %zu",
+                          p,
+                          G1CardSetConfiguration::mem_object_type_name_str(i),
+                          pool_free._num_mem_sizes[i], pool_free._num_segments[i],
+                          used._num_mem_sizes[i], return_to_vm_size);
+
+      _return_info->append(new G1ReturnMemoryProcessor(return_to_vm_size));
+    }
   }
 
-  G1SegmentedArrayFreePool<mtGCCardSet>::update_unlink_processors(_return_info);
+  FreePool::update_unlink_processors(_return_info);
   return false;
 }
 
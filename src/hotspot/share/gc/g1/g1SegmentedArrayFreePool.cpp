@@ -45,10 +45,13 @@ void G1SegmentedArrayMemoryStats::clear() {
 
 template<MEMFLAGS flag>
 void G1SegmentedArrayFreePool<flag>::update_unlink_processors(G1ReturnMemoryProcessorSet* unlink_processor) {
-  uint num_free_lists = _freelist_pool.num_free_lists();
+  for (uint p = 0; p < _num_freelist_pools; p++) {
+    G1SegmentedArrayFreePool* pool = free_list_pool(p);
+    uint num_free_lists = pool->num_free_lists();
 
-  for (uint i = 0; i < num_free_lists; i++) {
-    unlink_processor->at(i)->visit_free_list(_freelist_pool.free_list(i));
+    for (uint i = 0; i < num_free_lists; i++) {
+      unlink_processor->at(p * num_free_lists + i)->visit_free_list(pool->free_list(i));
+    }
   }
 }
 
@@ -153,7 +156,53 @@ bool G1SegmentedArrayFreePool<flag>::G1ReturnMemoryProcessor::return_to_os(jlong
 }
 
 template<MEMFLAGS flag>
-G1SegmentedArrayFreePool<flag> G1SegmentedArrayFreePool<flag>::_freelist_pool(G1CardSetConfiguration::num_mem_object_types());
+G1SegmentedArrayFreePool<flag>* G1SegmentedArrayFreePool<flag>::_freelist_pools = nullptr;
+
+template<MEMFLAGS flag>
+uint G1SegmentedArrayFreePool<flag>::_num_freelist_pools = 0;
+
+template<MEMFLAGS flag>
+void G1SegmentedArrayFreePool<flag>::initialize(uint num_pools) {
+  assert(_freelist_pools == nullptr, "already initialized");
+  assert(num_pools > 0, "must have at least one pool");
+
+  _freelist_pools = NEW_C_HEAP_ARRAY(G1SegmentedArrayFreePool, num_pools, mtGC);
+  for (uint i = 0; i < num_pools; i++) {
+    new (&_freelist_pools[i]) G1SegmentedArrayFreePool(G1CardSetConfiguration::num_mem_object_types());
+  }
+  _num_freelist_pools = num_pools;
+}
+
+template<MEMFLAGS flag>
+G1SegmentedArrayMemoryStats G1SegmentedArrayFreePool<flag>::free_list_sizes() {
+  G1SegmentedArrayMemoryStats result;
+  for (uint i = 0; i < _num_freelist_pools; i++) {
+    result.add(_freelist_pools[i].memory_sizes());
+  }
+  return result;
+}
+
+template<MEMFLAGS flag>
+size_t G1SegmentedArrayFreePool<flag>::free_list_pools_mem_size() {
+  size_t result = 0;
+  for (uint i = 0; i < _num_freelist_pools; i++) {
+    result += _freelist_pools[i].mem_size();
+  }
+  return result;
+}
+
+template<MEMFLAGS flag>
+void G1SegmentedArrayFreePool<flag>::print_free_list_pools_on(outputStream* out) {
+  if (_num_freelist_pools == 1) {
+    _freelist_pools[0].print_on(out);
+    return;
+  }
+  out->print_cr("  Free Pools: size %zu", free_list_pools_mem_size());
+  for (uint i = 0; i < _num_freelist_pools; i++) {
+    out->print_cr("  Node %u:", i);
+    _freelist_pools[i].print_on(out);
+  }
+}
 
 template<MEMFLAGS flag>
 G1SegmentedArrayFreePool<flag>::G1SegmentedArrayFreePool(uint num_free_lists) :
@@ -195,7 +244,7 @@ size_t G1SegmentedArrayFreePool<flag>::mem_size() const {
 
 template<MEMFLAGS flag>
 void G1SegmentedArrayFreePool<flag>::print_on(outputStream* out) {
-  out->print_cr("  Free Pool: size %zu", free_list_pool()->mem_size());
+  out->print_cr("  Free Pool: size %zu", mem_size());
   for (uint i = 0; i < _num_free_lists; i++) {
     FormatBuffer<> fmt("    %s", G1CardSetConfiguration::mem_object_type_name_str(i));
     _free_lists[i].print_on(out, fmt);
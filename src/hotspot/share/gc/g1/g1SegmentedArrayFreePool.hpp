@@ -56,21 +56,38 @@ public:
 
 // A set of free lists holding freed segments for use by G1SegmentedArray,
 // e.g. G1CardSetAllocators::SegmentedArray
+//
+// There is one global free pool per active NUMA node, so that segments freed
+// by the remembered sets of regions on one node are reused by regions on the
+// same node instead of being handed out across nodes.
 template<MEMFLAGS flag>
 class G1SegmentedArrayFreePool {
-  // The global free pool.
-  static G1SegmentedArrayFreePool _freelist_pool;
+  // The global free pools, indexed by NUMA node index.
+  static G1SegmentedArrayFreePool* _freelist_pools;
+  static uint _num_freelist_pools;
 
   const uint _num_free_lists;
   G1SegmentedArrayFreeList<flag>* _free_lists;
 
 public:
-  static G1SegmentedArrayFreePool* free_list_pool() { return &_freelist_pool; }
-  static G1SegmentedArrayMemoryStats free_list_sizes() { return _freelist_pool.memory_sizes(); }
+  // Create the global free pools. Must be called before any of them is used.
+  static void initialize(uint num_pools);
+
+  static uint num_free_list_pools() { return _num_freelist_pools; }
+  static G1SegmentedArrayFreePool* free_list_pool(uint node_index) {
+    assert(node_index < _num_freelist_pools, "node index %u out of bounds", node_index);
+    return &_freelist_pools[node_index];
+  }
+  // Statistics and memory size summed up over all global free pools.
+  static G1SegmentedArrayMemoryStats free_list_sizes();
+  static size_t free_list_pools_mem_size();
+  static void print_free_list_pools_on(outputStream* out);
 
   class G1ReturnMemoryProcessor;
   typedef GrowableArrayCHeap<G1ReturnMemoryProcessor*, mtGC> G1ReturnMemoryProcessorSet;
 
+  // The processors are expected in order of pools, and within a pool in order
+  // of free lists.
   static void update_unlink_processors(G1ReturnMemoryProcessorSet* unlink_processors);
 
   explicit G1SegmentedArrayFreePool(uint num_free_lists);
@@ -127,6 +127,22 @@ void G1NewTracer::report_adaptive_ihop_statistics(size_t threshold,
                                 prediction_active);
 }
 
+void G1NewTracer::report_humongous_waste(uint num_objects, uint num_regions, size_t wasted_bytes) {
+  send_humongous_waste(num_objects, num_regions, wasted_bytes);
+}
+
+void G1NewTracer::report_pause_time_prediction(double target_pause_time_ms,
+                                               double predicted_base_time_ms,
+                                               double predicted_young_time_ms,
+                                               double predicted_old_time_ms,
+                                               double actual_pause_time_ms) {
+  send_pause_time_prediction(target_pause_time_ms,
+                             predicted_base_time_ms,
+                             predicted_young_time_ms,
+                             predicted_old_time_ms,
+                             actual_pause_time_ms);
+}
+
 void G1NewTracer::send_g1_young_gc_event() {
   // Check that the pause type has been updated to something valid for this event.
   G1GCPauseTypeHelper::assert_is_young_pause(_pause);
@@ -248,6 +264,39 @@ void G1NewTracer::send_adaptive_ihop_statistics(size_t threshold,
   }
 }
 
+void G1NewTracer::send_humongous_waste(uint num_objects, uint num_regions, size_t wasted_bytes) {
+  EventG1HumongousWaste evt;
+  if (evt.should_commit()) {
+    evt.set_gcId(GCId::current());
+    evt.set_objects(num_objects);
+    evt.set_regions(num_regions);
+    evt.set_wasted(wasted_bytes);
+    evt.commit();
+  }
+}
+
+static jlong ms_to_ns(double ms) {
+  return (jlong)(ms * NANOSECS_PER_MILLISEC);
+}
+
+void G1NewTracer::send_pause_time_prediction(double target_pause_time_ms,
+                                             double predicted_base_time_ms,
+                                             double predicted_young_time_ms,
+                                             double predicted_old_time_ms,
+                                             double actual_pause_time_ms) {
+  EventG1PausePrediction evt;
+  if (evt.should_commit()) {
+    evt.set_gcId(GCId::current());
+    evt.set_pauseTarget(ms_to_ns(target_pause_time_ms));
+    evt.set_predictedBaseTime(ms_to_ns(predicted_base_time_ms));
+    evt.set_predictedYoungTime(ms_to_ns(predicted_young_time_ms));
+    evt.set_predictedOldTime(ms_to_ns(predicted_old_time_ms));
+    evt.set_predictedPauseTime(ms_to_ns(predicted_base_time_ms + predicted_young_time_ms + predicted_old_time_ms));
+    evt.set_actualPauseTime(ms_to_ns(actual_pause_time_ms));
+    evt.commit();
+  }
+}
+
 void G1OldTracer::report_gc_start_impl(GCCause::Cause cause, const Ticks& timestamp) {
   _shared_gc_info.set_start_timestamp(timestamp);
 }
@@ -63,6 +63,12 @@ public:
                                        double predicted_allocation_rate,
                                        double predicted_marking_length,
                                        bool prediction_active);
+  void report_humongous_waste(uint num_objects, uint num_regions, size_t wasted_bytes);
+  void report_pause_time_prediction(double target_pause_time_ms,
+                                    double predicted_base_time_ms,
+                                    double predicted_young_time_ms,
+                                    double predicted_old_time_ms,
+                                    double actual_pause_time_ms);
 private:
   void send_g1_young_gc_event();
   void send_evacuation_info_event(G1EvacInfo* info);
@@ -84,6 +90,12 @@ private:
                                      double predicted_allocation_rate,
                                      double predicted_marking_length,
                                      bool prediction_active);
+  void send_humongous_waste(uint num_objects, uint num_regions, size_t wasted_bytes);
+  void send_pause_time_prediction(double target_pause_time_ms,
+                                  double predicted_base_time_ms,
+                                  double predicted_young_time_ms,
+                                  double predicted_old_time_ms,
+                                  double actual_pause_time_ms);
 };
 
 class G1OldTracer : public OldGCTracer {
@@ -47,6 +47,7 @@
 #include "gc/g1/g1YoungCollector.hpp"
 #include "gc/g1/g1YoungGCPostEvacuateTasks.hpp"
 #include "gc/g1/g1_globals.hpp"
+#include "gc/g1/heapRegionBounds.inline.hpp"
 #include "gc/shared/concurrentGCBreakpoints.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/gcTimer.hpp"
@@ -329,6 +330,11 @@ class G1PrepareEvacuationTask : public WorkerTask {
     G1PrepareEvacuationTask* _parent_task;
     uint _worker_humongous_total;
     uint _worker_humongous_candidates;
+    // Live humongous objects and the space at the end of their last regions
+    // they do not use.
+    uint _worker_humongous_live;
+    uint _worker_humongous_live_regions;
+    size_t _worker_humongous_waste_words;
 
     G1SegmentedArrayMemoryStats _card_set_stats;
 
@@ -378,10 +384,13 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // structures don't support efficiently performing the needed
       // additional tests or scrubbing of the mark stack.
       //
-      // However, we presently only nominate is_typeArray() objects.
       // A humongous object containing references induces remembered
-      // set entries on other regions.  In order to reclaim such an
-      // object, those remembered sets would need to be cleaned up.
+      // set entries on other regions.  These become stale once the object
+      // is reclaimed, which is benign: stale entries are filtered when
+      // scanning the remembered sets as for any other freed region. Such
+      // objects are only nominated while no marking or rebuild is in
+      // progress, so that they can neither be on the mark stack nor be
+      // partially scanned by the remembered set rebuild.
       //
       // We also treat is_typeArray() objects specially, allowing them
       // to be reclaimed even if allocated before the start of
@@ -393,8 +402,15 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
 
-      return obj->is_typeArray() &&
-             _g1h->is_potential_eager_reclaim_candidate(region);
+      if (!_g1h->is_potential_eager_reclaim_candidate(region)) {
+        return false;
+      }
+      if (obj->is_typeArray()) {
+        return true;
+      }
+      return G1EagerReclaimHumongousObjArrays &&
+             obj->is_objArray() &&
+             !_g1h->collector_state()->mark_or_rebuild_in_progress();
     }
 
   public:
@@ -402,11 +418,30 @@ class G1PrepareEvacuationTask : public WorkerTask {
       _g1h(g1h),
       _parent_task(parent_task),
       _worker_humongous_total(0),
-      _worker_humongous_candidates(0) { }
+      _worker_humongous_candidates(0),
+      _worker_humongous_live(0),
+      _worker_humongous_live_regions(0),
+      _worker_humongous_waste_words(0) { }
 
     ~G1PrepareRegionsClosure() {
       _parent_task->add_humongous_candidates(_worker_humongous_candidates);
       _parent_task->add_humongous_total(_worker_humongous_total);
+      _parent_task->add_humongous_waste(_worker_humongous_live,
+                                        _worker_humongous_live_regions,
+                                        _worker_humongous_waste_words);
+    }
+
+    void sample_humongous_waste(HeapRegion* hr) {
+      oop obj = cast_to_oop(hr->bottom());
+      // Do not query the size of dead objects, their class may be unloaded.
+      if (_g1h->is_obj_dead(obj, hr)) {
+        return;
+      }
+      size_t word_size = obj->size();
+      uint num_regions = (uint)G1CollectedHeap::humongous_obj_size_in_regions(word_size);
+      _worker_humongous_live++;
+      _worker_humongous_live_regions += num_regions;
+      _worker_humongous_waste_words += num_regions * HeapRegion::GrainWords - word_size;
     }
 
     virtual bool do_heap_region(HeapRegion* hr) {
@@ -421,6 +456,8 @@ class G1PrepareEvacuationTask : public WorkerTask {
         return false;
       }
 
+      sample_humongous_waste(hr);
+
       uint index = hr->hrm_index();
       if (humongous_region_is_candidate(hr)) {
         _g1h->set_humongous_reclaim_candidate(index, true);
@@ -455,6 +492,9 @@ class G1PrepareEvacuationTask : public WorkerTask {
   HeapRegionClaimer _claimer;
   volatile uint _humongous_total;
   volatile uint _humongous_candidates;
+  volatile uint _humongous_live;
+  volatile uint _humongous_live_regions;
+  volatile size_t _humongous_waste_words;
 
   G1SegmentedArrayMemoryStats _all_card_set_stats;
 
@@ -464,7 +504,10 @@ public:
     _g1h(g1h),
     _claimer(_g1h->workers()->active_workers()),
     _humongous_total(0),
-    _humongous_candidates(0) { }
+    _humongous_candidates(0),
+    _humongous_live(0),
+    _humongous_live_regions(0),
+    _humongous_waste_words(0) { }
 
   void work(uint worker_id) {
     G1PrepareRegionsClosure cl(_g1h, this);
@@ -482,10 +525,22 @@ public:
     Atomic::add(&_humongous_total, total);
   }
 
+  void add_humongous_waste(uint live, uint live_regions, size_t waste_words) {
+    if (live > 0) {
+      Atomic::add(&_humongous_live, live);
+      Atomic::add(&_humongous_live_regions, live_regions);
+      Atomic::add(&_humongous_waste_words, waste_words);
+    }
+  }
+
   uint humongous_candidates() {
     return _humongous_candidates;
   }
 
+  uint humongous_live() const { return _humongous_live; }
+  uint humongous_live_regions() const { return _humongous_live_regions; }
+  size_t humongous_waste_bytes() const { return _humongous_waste_words * HeapWordSize; }
+
   uint humongous_total() {
     return _humongous_total;
   }
@@ -495,6 +550,34 @@ public:
   }
 };
 
+void G1YoungCollector::report_humongous_waste(uint num_objects, uint num_regions, size_t wasted_bytes) {
+  if (num_objects == 0) {
+    return;
+  }
+  size_t region_bytes = num_regions * HeapRegion::GrainBytes;
+  double waste_percent = percent_of(wasted_bytes, region_bytes);
+  log_debug(gc, humongous)("Live humongous objects %u regions %u wasted " SIZE_FORMAT "B (%1.2f%%)",
+                           num_objects, num_regions, wasted_bytes, waste_percent);
+  gc_tracer_stw()->report_humongous_waste(num_objects, num_regions, wasted_bytes);
+
+  // Many humongous objects that are a bit larger than a multiple of the region
+  // size waste a lot of space that is neither usable for other objects nor
+  // reclaimed before the humongous objects die. Hint at a larger region size
+  // once, if that seems to be the case.
+  const uint MinRegionsForHint = 16;
+  const double WastePercentForHint = 25.0;
+  static bool hinted = false;
+  if (!hinted && num_regions >= MinRegionsForHint && waste_percent >= WastePercentForHint &&
+      HeapRegion::GrainBytes < HeapRegionBounds::max_size()) {
+    hinted = true;
+    log_info(gc, ergo, heap)("Humongous objects waste %1.2f%% of their %u regions, "
+                             "consider increasing G1HeapRegionSize (currently " SIZE_FORMAT "%s)",
+                             waste_percent, num_regions,
+                             byte_size_in_proper_unit(HeapRegion::GrainBytes),
+                             proper_unit_for_byte_size(HeapRegion::GrainBytes));
+  }
+}
+
 Tickspan G1YoungCollector::run_task_timed(WorkerTask* task) {
   Ticks start = Ticks::now();
   workers()->run_task(task);
@@ -553,6 +636,9 @@ void G1YoungCollector::pre_evacuate_collection_set(G1EvacInfo* evacuation_info,
 
     _g1h->set_young_gen_card_set_stats(g1_prep_task.all_card_set_stats());
     _g1h->set_humongous_stats(g1_prep_task.humongous_total(), g1_prep_task.humongous_candidates());
+    report_humongous_waste(g1_prep_task.humongous_live(),
+                           g1_prep_task.humongous_live_regions(),
+                           g1_prep_task.humongous_waste_bytes());
 
     phase_times()->record_register_regions(task_time.seconds() * 1000.0);
   }
@@ -1045,7 +1131,7 @@ void G1YoungCollector::post_evacuate_collection_set(G1EvacInfo* evacuation_info,
 
   _g1h->gc_epilogue(false);
 
-  _g1h->expand_heap_after_young_collection();
+  _g1h->resize_heap_after_young_collection();
 }
 
 bool G1YoungCollector::evacuation_failed() const {
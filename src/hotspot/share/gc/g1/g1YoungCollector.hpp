@@ -93,6 +93,10 @@ class G1YoungCollector {
   // returning the total time taken.
   Tickspan run_task_timed(WorkerTask* task);
 
+  // Log and trace the space wasted at the end of the last regions of live
+  // humongous objects.
+  void report_humongous_waste(uint num_objects, uint num_regions, size_t wasted_bytes);
+
   void wait_for_root_region_scanning();
 
   void calculate_collection_set(G1EvacInfo* evacuation_info, double target_pause_time_ms);
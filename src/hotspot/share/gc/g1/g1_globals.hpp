@@ -139,11 +139,21 @@
                "Concurrently preclean java.lang.ref.references instances "  \
                "before the Remark pause.")                                  \
                                                                             \
+  product(bool, G1ParallelReferencePrecleaning, false, EXPERIMENTAL,        \
+               "Preclean the discovered references with all concurrent "    \
+               "marking threads instead of a single one.")                  \
+                                                                            \
   product(double, G1LastPLABAverageOccupancy, 50.0, EXPERIMENTAL,           \
                "The expected average occupancy of the last PLAB in "        \
                "percent.")                                                  \
                range(0.001, 100.0)                                          \
                                                                             \
+  product(bool, G1ResizePLABsDuringGC, false, EXPERIMENTAL,                 \
+               "Let each GC worker grow its survivor and old PLABs during " \
+               "a collection once it has copied enough into them that the " \
+               "waste of a larger last PLAB stays within "                  \
+               "TargetPLABWastePct.")                                       \
+                                                                            \
   product(size_t, G1SATBBufferSize, 1*K,                                    \
           "Number of entries in an SATB log buffer.")                       \
           range(1, max_uintx)                                               \
@@ -310,6 +320,13 @@
           "The target number of mixed GCs after a marking cycle.")          \
           range(0, max_uintx)                                               \
                                                                             \
+  product(uint, G1GCOverheadTargetPercent, 0, EXPERIMENTAL,                 \
+          "Target percentage of time spent in GC pauses that the heap is "  \
+          "sized for after young GCs, expanding above and gradually "       \
+          "shrinking well below it. Zero means use GCTimeRatio and only "   \
+          "expand.")                                                        \
+          range(0, 100)                                                     \
+                                                                            \
   product(bool, G1EagerReclaimHumongousObjects, true, EXPERIMENTAL,         \
           "Try to reclaim dead large objects at every young GC.")           \
                                                                             \
@@ -317,6 +334,15 @@
           "Try to reclaim dead large objects that have a few stale "        \
           "references at every young GC.")                                  \
                                                                             \
+  product(bool, G1UsePausePredictionErrorCorrection, false, EXPERIMENTAL,   \
+          "Reduce the pause time goal used to size the young generation "   \
+          "and the collection set by how much recent pauses exceeded "      \
+          "their predicted time.")                                          \
+                                                                            \
+  product(bool, G1EagerReclaimHumongousObjArrays, true, EXPERIMENTAL,       \
+          "Also try to reclaim dead large object arrays at young GCs "      \
+          "outside of concurrent marking, not only primitive arrays.")      \
+                                                                            \
   product(uint, G1EagerReclaimRemSetThreshold, 0, EXPERIMENTAL,             \
           "Maximum number of remembered set entries a humongous region "    \
           "otherwise eligible for eager reclaim may have to be a candidate "\
@@ -379,6 +405,11 @@
            number of free regions and the expected survival rates in each   \
            section of the heap.")                                           \
                                                                             \
+  product(bool, G1PinRegionsForCriticalNatives, false, EXPERIMENTAL,        \
+          "Keep the regions containing arrays and strings held in JNI "     \
+          "critical sections in place during garbage collections instead "  \
+          "of blocking garbage collections with the GCLocker.")             \
+                                                                            \
   GC_G1_EVACUATION_FAILURE_FLAGS(develop,                                   \
                     develop_pd,                                             \
                     product,                                                \
@@ -44,6 +44,7 @@
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "utilities/powerOfTwo.hpp"
 
@@ -116,6 +117,7 @@ void HeapRegion::unlink_from_list() {
 void HeapRegion::hr_clear(bool clear_space) {
   assert(_humongous_start_region == NULL,
          "we should have already filtered out humongous regions");
+  assert(!has_pinned_objects(), "region %u with pinned objects must not be freed", hrm_index());
 
   clear_young_index_in_cset();
   clear_index_in_opt_cset();
@@ -133,6 +135,15 @@ void HeapRegion::hr_clear(bool clear_space) {
   _gc_efficiency = -1.0;
 }
 
+void HeapRegion::increment_pinned_object_count() {
+  Atomic::inc(&_pinned_object_count, memory_order_relaxed);
+}
+
+void HeapRegion::decrement_pinned_object_count() {
+  assert(has_pinned_objects(), "region %u has no pinned objects", hrm_index());
+  Atomic::dec(&_pinned_object_count, memory_order_relaxed);
+}
+
 void HeapRegion::clear_cardtable() {
   G1CardTable* ct = G1CollectedHeap::heap()->card_table();
   ct->clear(MemRegion(bottom(), end()));
@@ -242,7 +253,8 @@ HeapRegion::HeapRegion(uint hrm_index,
   _prev_marked_bytes(0), _next_marked_bytes(0),
   _young_index_in_cset(-1),
   _surv_rate_group(NULL), _age_index(G1SurvRateGroup::InvalidAgeIndex), _gc_efficiency(-1.0),
-  _node_index(G1NUMA::UnknownNodeIndex)
+  _node_index(G1NUMA::UnknownNodeIndex),
+  _pinned_object_count(0)
 {
   assert(Universe::on_page_boundary(mr.start()) && Universe::on_page_boundary(mr.end()),
          "invalid space boundaries");
@@ -33,6 +33,7 @@
 #include "gc/shared/ageTable.hpp"
 #include "gc/shared/spaceDecorator.hpp"
 #include "gc/shared/verifyOption.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutex.hpp"
 #include "utilities/macros.hpp"
 
@@ -169,6 +170,10 @@ public:
   // given object must cross the threshold.
   inline void update_bot_crossing_threshold(HeapWord** threshold, HeapWord* obj_start, HeapWord* obj_end);
   inline HeapWord* bot_threshold_for_addr(const void* addr);
+  // Update the BOT for the block [start, end) without using or changing the
+  // BOT threshold of the region. Blocks that do not overlap may be updated
+  // concurrently.
+  inline void update_bot_for_block(HeapWord* start, HeapWord* end);
 
   // Full GC support methods.
 
@@ -267,6 +272,9 @@ private:
 
   uint _node_index;
 
+  // Number of objects in this region held in JNI critical sections.
+  volatile size_t _pinned_object_count;
+
   void report_region_type_change(G1HeapRegionTraceType::Type to);
 
   // Returns whether the given object address refers to a dead object, and either the
@@ -419,6 +427,13 @@ public:
   // Humongous regions and archive regions are pinned.
   bool is_pinned() const { return _type.is_pinned(); }
 
+  // Objects held in JNI critical sections must not move, so a region containing
+  // any of them is kept in place by garbage collections until they are released.
+  size_t pinned_object_count() const { return Atomic::load(&_pinned_object_count); }
+  bool has_pinned_objects() const { return pinned_object_count() > 0; }
+  void increment_pinned_object_count();
+  void decrement_pinned_object_count();
+
   // An archive region is a pinned region, also tagged as old, which
   // should not be marked during mark/sweep. This allows the address
   // space to be shared by JVM instances.
@@ -251,6 +251,15 @@ inline void HeapRegion::update_bot_crossing_threshold(HeapWord** threshold, Heap
   _bot_part.alloc_block_work(threshold, obj_start, obj_end);
 }
 
+inline void HeapRegion::update_bot_for_block(HeapWord* start, HeapWord* end) {
+  assert(is_in(start), "block must start in this region: " HR_FORMAT " start " PTR_FORMAT,
+         HR_FORMAT_PARAMS(this), p2i(start));
+  HeapWord* threshold = _bot_part.threshold_for_addr(start);
+  if (end > threshold) {
+    _bot_part.alloc_block_work(&threshold, start, end);
+  }
+}
+
 inline void HeapRegion::update_bot_at(HeapWord* obj_start, size_t obj_size) {
   HeapWord* threshold = bot_threshold_for_addr(obj_start);
   HeapWord* obj_end = obj_start + obj_size;
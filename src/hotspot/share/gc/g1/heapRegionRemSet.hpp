@@ -143,7 +143,8 @@ public:
   // Returns the memory occupancy of all static data structures associated
   // with remembered sets.
   static size_t static_mem_size() {
-    return G1CardSet::static_mem_size() + G1CodeRootSet::static_mem_size() + sizeof(G1CardSetFreePool);
+    return G1CardSet::static_mem_size() + G1CodeRootSet::static_mem_size() +
+           sizeof(G1CardSetFreePool) * G1CardSetFreePool::num_free_list_pools();
   }
 
   static void print_static_mem_size(outputStream* out);
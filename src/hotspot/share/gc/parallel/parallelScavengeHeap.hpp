@@ -236,6 +236,11 @@ class ParallelScavengeHeap : public CollectedHeap {
   HeapWord* block_start(const void* addr) const;
   bool block_is_obj(const HeapWord* addr) const;
 
+  // Support for loading objects from CDS archive into the heap
+  bool can_load_archived_objects() const { return true; }
+  HeapWord* allocate_loaded_archive_space(size_t size);
+  void complete_loaded_archive_space(MemRegion archive_space);
+
   void prepare_for_verify();
   PSHeapSummary create_ps_heap_summary();
   virtual void print_on(outputStream* st) const;
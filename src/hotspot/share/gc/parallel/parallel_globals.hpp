@@ -56,7 +56,12 @@
           range(0, 100)                                                     \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  product(bool, PSNUMAOldPLABs, false, EXPERIMENTAL,                        \
+          "With UseNUMA, bind the pages of each old gen promotion LAB "     \
+          "to the NUMA node of the GC thread that allocated it. Use "       \
+          "with a large OldPLABSize, since only whole pages are bound")
 
 // end of GC_PARALLEL_FLAGS
 
@@ -231,16 +231,12 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     CardValue* current_card = worker_start_card;
     while (current_card < worker_end_card) {
       // Find an unclean card.
-      while (current_card < worker_end_card && card_is_clean(*current_card)) {
-        current_card++;
-      }
+      current_card = find_first_non_clean_card(current_card, worker_end_card);
       CardValue* first_unclean_card = current_card;
 
       // Find the end of a run of contiguous unclean cards
       while (current_card < worker_end_card && !card_is_clean(*current_card)) {
-        while (current_card < worker_end_card && !card_is_clean(*current_card)) {
-          current_card++;
-        }
+        current_card = find_first_clean_card(current_card, worker_end_card);
 
         if (current_card < worker_end_card) {
           // Some objects may be large enough to span several cards. If such
@@ -296,8 +292,8 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
         if (following_clean_card >= worker_end_card-1)
           following_clean_card = worker_end_card-1;
 
-        while (first_unclean_card < following_clean_card) {
-          *first_unclean_card++ = clean_card;
+        if (first_unclean_card < following_clean_card) {
+          memset(first_unclean_card, clean_card, pointer_delta(following_clean_card, first_unclean_card, sizeof(CardValue)));
         }
 
         const int interval = PrefetchScanIntervalInBytes;
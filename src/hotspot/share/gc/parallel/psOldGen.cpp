@@ -355,6 +355,17 @@ void PSOldGen::post_resize() {
     "Sanity");
 }
 
+void PSOldGen::complete_loaded_archive_space(MemRegion archive_space) {
+  // The archive space was allocated as a single block, so only its first
+  // object has been recorded in the start array. Register the others too.
+  HeapWord* cur = archive_space.start();
+  while (cur < archive_space.end()) {
+    _start_array.allocate_block(cur);
+    size_t word_size = cast_to_oop(cur)->size();
+    cur += word_size;
+  }
+}
+
 void PSOldGen::print() const { print_on(tty);}
 void PSOldGen::print_on(outputStream* st) const {
   st->print(" %-15s", name());
@@ -145,6 +145,10 @@ class PSOldGen : public CHeapObj<mtGC> {
     return res;
   }
 
+  // Record the objects copied from the CDS archive into space
+  // previously handed out by allocate().
+  void complete_loaded_archive_space(MemRegion archive_space);
+
   // Iteration.
   void oop_iterate(OopIterateClosure* cl) { object_space()->oop_iterate(cl); }
   void object_iterate(ObjectClosure* cl) { object_space()->object_iterate(cl); }
@@ -59,10 +59,12 @@
 #include "gc/shared/spaceDecorator.inline.hpp"
 #include "gc/shared/taskTerminator.hpp"
 #include "gc/shared/weakProcessor.inline.hpp"
+#include "gc/shared/workerDataArray.inline.hpp"
 #include "gc/shared/workerPolicy.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "gc/shared/workerUtils.hpp"
 #include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "memory/iterator.inline.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
@@ -2445,7 +2447,8 @@ void PSParallelCompact::write_block_fill_histogram()
 }
 #endif // #ifdef ASSERT
 
-static void compaction_with_stealing_work(TaskTerminator* terminator, uint worker_id) {
+static void compaction_with_stealing_work(TaskTerminator* terminator, uint worker_id,
+                                          double& termination_time, size_t& stolen_regions) {
   assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
 
   ParCompactionManager* cm =
@@ -2462,14 +2465,19 @@ static void compaction_with_stealing_work(TaskTerminator* terminator, uint worke
 
   while (true) {
     if (ParCompactionManager::steal(worker_id, region_index)) {
+      stolen_regions++;
       PSParallelCompact::fill_and_update_region(cm, region_index);
       cm->drain_region_stacks();
     } else if (PSParallelCompact::steal_unavailable_region(cm, region_index)) {
       // Fill and update an unavailable region with the help of a shadow region
+      stolen_regions++;
       PSParallelCompact::fill_and_update_shadow_region(cm, region_index);
       cm->drain_region_stacks();
     } else {
-      if (terminator->offer_termination()) {
+      double start = os::elapsedTime();
+      bool terminated = terminator->offer_termination();
+      termination_time += os::elapsedTime() - start;
+      if (terminated) {
         break;
       }
       // Go around again.
@@ -2482,15 +2490,23 @@ class UpdateDensePrefixAndCompactionTask: public WorkerTask {
   TaskTerminator _terminator;
   uint _active_workers;
 
+  // Per-worker time spent doing work and waiting for termination.
+  WorkerDataArray<double> _busy_times;
+  WorkerDataArray<double> _termination_times;
+
 public:
   UpdateDensePrefixAndCompactionTask(TaskQueue& tq, uint active_workers) :
       WorkerTask("UpdateDensePrefixAndCompactionTask"),
       _tq(tq),
       _terminator(active_workers, ParCompactionManager::region_task_queues()),
-      _active_workers(active_workers) {
+      _active_workers(active_workers),
+      _busy_times(NULL, "Par Compact Busy (ms):", active_workers),
+      _termination_times(NULL, "Par Compact Termination (ms):", active_workers) {
+    _busy_times.create_thread_work_items("Stolen Regions:");
   }
   virtual void work(uint worker_id) {
     ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
+    double start = os::elapsedTime();
 
     for (PSParallelCompact::UpdateDensePrefixTask task; _tq.try_claim(task); /* empty */) {
       PSParallelCompact::update_and_deadwood_in_dense_prefix(cm,
@@ -2501,7 +2517,35 @@ public:
 
     // Once a thread has drained it's stack, it should try to steal regions from
     // other threads.
-    compaction_with_stealing_work(&_terminator, worker_id);
+    double termination_time = 0.0;
+    size_t stolen_regions = 0;
+    compaction_with_stealing_work(&_terminator, worker_id, termination_time, stolen_regions);
+
+    _busy_times.set(worker_id, os::elapsedTime() - start - termination_time);
+    _busy_times.set_thread_work_item(worker_id, stolen_regions);
+    _termination_times.set(worker_id, termination_time);
+  }
+
+  void print_worker_times() const {
+    LogTarget(Debug, gc, phases) lt;
+    if (lt.is_enabled()) {
+      LogStream ls(lt);
+      ls.print("  ");
+      _busy_times.print_summary_on(&ls);
+      ls.print("    ");
+      _busy_times.thread_work_items()->print_summary_on(&ls);
+      ls.print("  ");
+      _termination_times.print_summary_on(&ls);
+
+      LogTarget(Trace, gc, phases) lt_details;
+      if (lt_details.is_enabled()) {
+        LogStream ls_details(lt_details);
+        ls_details.print("  ");
+        _busy_times.print_details_on(&ls_details);
+        ls_details.print("  ");
+        _termination_times.print_details_on(&ls_details);
+      }
+    }
   }
 };
 
@@ -2529,6 +2573,7 @@ void PSParallelCompact::compact() {
 
     UpdateDensePrefixAndCompactionTask task(task_queue, active_gc_threads);
     ParallelScavengeHeap::heap()->workers().run_task(&task);
+    task.print_worker_times();
 
 #ifdef  ASSERT
     // Verify that all regions have been processed before the deferred updates.
@@ -41,6 +41,8 @@
 #include "memory/resourceArea.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 
 PaddedEnd<PSPromotionManager>* PSPromotionManager::_manager_array = NULL;
 PSPromotionManager::PSScannerTasksQueueSet* PSPromotionManager::_stack_array_depth = NULL;
@@ -276,6 +278,17 @@ void PSPromotionManager::drain_stacks_depth(bool totally_drain) {
   assert(tq->overflow_empty(), "Sanity");
 }
 
+void PSPromotionManager::numa_bind_old_lab(HeapWord* lab_base, size_t word_size) {
+  // Only whole pages can be bound, and pages that have already been touched
+  // keep their placement, so this is most effective with a large OldPLABSize.
+  size_t page_size = UseLargePages ? old_gen()->virtual_space()->alignment() : os::vm_page_size();
+  HeapWord* start = align_up(lab_base, page_size);
+  HeapWord* end = align_down(lab_base + word_size, page_size);
+  if (end > start) {
+    os::numa_make_local((char*)start, pointer_delta(end, start, sizeof(char)), os::numa_get_group_id());
+  }
+}
+
 void PSPromotionManager::flush_labs() {
   assert(stacks_empty(), "Attempt to flush lab with live stack");
 
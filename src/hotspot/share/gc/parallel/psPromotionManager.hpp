@@ -106,6 +106,10 @@ class PSPromotionManager {
 
   void push_depth(ScannerTask task);
 
+  // Bind the untouched pages of a freshly allocated old gen PLAB to the
+  // NUMA node of the promoting thread.
+  void numa_bind_old_lab(HeapWord* lab_base, size_t word_size);
+
   inline void promotion_trace_event(oop new_obj, oop old_obj, size_t obj_size,
                                     uint age, bool tenured,
                                     const PSPromotionLAB* lab);
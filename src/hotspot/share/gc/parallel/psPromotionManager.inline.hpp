@@ -219,6 +219,9 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
 
           HeapWord* lab_base = old_gen()->allocate(OldPLABSize);
           if(lab_base != NULL) {
+            if (UseNUMA && PSNUMAOldPLABs) {
+              numa_bind_old_lab(lab_base, OldPLABSize);
+            }
             _old_lab.initialize(MemRegion(lab_base, OldPLABSize));
             // Try the old lab allocation again.
             new_obj = cast_to_oop(_old_lab.allocate(new_obj_size));
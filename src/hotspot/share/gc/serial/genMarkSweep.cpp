@@ -34,6 +34,7 @@
 #include "compiler/oopMap.hpp"
 #include "gc/serial/genMarkSweep.hpp"
 #include "gc/serial/serialGcRefProcProxyTask.hpp"
+#include "gc/serial/serialHeap.hpp"
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
 #include "gc/shared/gcTimer.hpp"
@@ -48,10 +49,12 @@
 #include "gc/shared/space.hpp"
 #include "gc/shared/strongRootsScope.hpp"
 #include "gc/shared/weakProcessor.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "memory/universe.hpp"
 #include "oops/instanceRefKlass.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
@@ -254,6 +257,59 @@ public:
   }
 };
 
+// Adjusts the pointers in the live part of all heap spaces, with the
+// workers claiming the chunks established during phase 2.
+class GenAdjustPointersTask : public WorkerTask {
+  static const uint MaxSpaces = 4;
+
+  class CollectSpacesClosure : public SpaceClosure {
+    GenAdjustPointersTask* _task;
+  public:
+    CollectSpacesClosure(GenAdjustPointersTask* task) : _task(task) {}
+    void do_space(Space* sp) {
+      _task->add_space(sp->toContiguousSpace());
+    }
+  };
+
+  CompactibleSpace* _spaces[MaxSpaces];
+  // Index of the first chunk of each space; the last entry is the total.
+  uint _chunk_offsets[MaxSpaces + 1];
+  uint _num_spaces;
+  volatile uint _claimed_chunks;
+
+  void add_space(CompactibleSpace* sp) {
+    assert(_num_spaces < MaxSpaces, "too many spaces");
+    _spaces[_num_spaces] = sp;
+    _chunk_offsets[_num_spaces + 1] = _chunk_offsets[_num_spaces] + sp->num_adjust_chunks();
+    _num_spaces++;
+  }
+
+public:
+  GenAdjustPointersTask(GenCollectedHeap* gch) :
+    WorkerTask("GenAdjustPointersTask"),
+    _num_spaces(0),
+    _claimed_chunks(0) {
+    _chunk_offsets[0] = 0;
+    CollectSpacesClosure cl(this);
+    gch->old_gen()->space_iterate(&cl);
+    gch->young_gen()->space_iterate(&cl);
+  }
+
+  void work(uint worker_id) {
+    const uint num_chunks = _chunk_offsets[_num_spaces];
+    uint space = 0;
+    for (uint chunk = Atomic::fetch_and_add(&_claimed_chunks, 1u);
+         chunk < num_chunks;
+         chunk = Atomic::fetch_and_add(&_claimed_chunks, 1u)) {
+      // Chunks are claimed in increasing order.
+      while (chunk >= _chunk_offsets[space + 1]) {
+        space++;
+      }
+      _spaces[space]->adjust_pointers_in_chunk(chunk - _chunk_offsets[space]);
+    }
+  }
+};
+
 void GenMarkSweep::mark_sweep_phase3() {
   GenCollectedHeap* gch = GenCollectedHeap::heap();
 
@@ -276,8 +332,16 @@ void GenMarkSweep::mark_sweep_phase3() {
   gch->gen_process_weak_roots(&adjust_pointer_closure);
 
   adjust_marks();
-  GenAdjustPointersClosure blk;
-  gch->generation_iterate(&blk, true);
+
+  WorkerThreads* workers = SerialHeap::heap()->workers();
+  if (workers != NULL) {
+    workers->set_active_workers(workers->max_workers());
+    GenAdjustPointersTask task(gch);
+    workers->run_task(&task);
+  } else {
+    GenAdjustPointersClosure blk;
+    gch->generation_iterate(&blk, true);
+  }
 }
 
 class GenCompactClosure: public GenCollectedHeap::GenClosure {
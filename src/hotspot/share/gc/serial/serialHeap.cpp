@@ -29,6 +29,7 @@
 #include "gc/shared/genMemoryPools.hpp"
 #include "gc/shared/strongRootsScope.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "memory/universe.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "services/memoryManager.hpp"
@@ -43,9 +44,21 @@ SerialHeap::SerialHeap() :
                      "Copy:MSC"),
     _eden_pool(NULL),
     _survivor_pool(NULL),
-    _old_pool(NULL) {
+    _old_pool(NULL),
+    _workers(NULL) {
   _young_manager = new GCMemoryManager("Copy", "end of minor GC");
   _old_manager = new GCMemoryManager("MarkSweepCompact", "end of major GC");
+
+  if (SerialFullGCThreads > 1) {
+    _workers = new WorkerThreads("Serial Full GC Thread", SerialFullGCThreads);
+    _workers->initialize_workers();
+  }
+}
+
+void SerialHeap::gc_threads_do(ThreadClosure* tc) const {
+  if (_workers != NULL) {
+    _workers->threads_do(tc);
+  }
 }
 
 void SerialHeap::initialize_serviceability() {
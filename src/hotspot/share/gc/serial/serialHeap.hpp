@@ -34,6 +34,7 @@ class GCMemoryManager;
 class MemoryPool;
 class OopIterateClosure;
 class TenuredGeneration;
+class WorkerThreads;
 
 class SerialHeap : public GenCollectedHeap {
 private:
@@ -41,6 +42,10 @@ private:
   MemoryPool* _survivor_pool;
   MemoryPool* _old_pool;
 
+  // Workers for the parallel phases of full GCs, NULL unless
+  // SerialFullGCThreads is set.
+  WorkerThreads* _workers;
+
   virtual void initialize_serviceability();
 
 public:
@@ -59,6 +64,9 @@ public:
   virtual GrowableArray<GCMemoryManager*> memory_managers();
   virtual GrowableArray<MemoryPool*> memory_pools();
 
+  WorkerThreads* workers() const { return _workers; }
+  virtual void gc_threads_do(ThreadClosure* tc) const;
+
   DefNewGeneration* young_gen() const {
     assert(_young_gen->kind() == Generation::DefNew, "Wrong generation type");
     return static_cast<DefNewGeneration*>(_young_gen);
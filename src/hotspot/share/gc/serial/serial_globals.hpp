@@ -25,13 +25,17 @@
 #ifndef SHARE_GC_SERIAL_SERIAL_GLOBALS_HPP
 #define SHARE_GC_SERIAL_SERIAL_GLOBALS_HPP
 
-#define GC_SERIAL_FLAGS(develop,     \
-                        develop_pd,  \
-                        product,     \
-                        product_pd,  \
-                        notproduct,  \
-                        range,       \
-                        constraint)
+#define GC_SERIAL_FLAGS(develop,                                            \
+                        develop_pd,                                         \
+                        product,                                            \
+                        product_pd,                                         \
+                        notproduct,                                         \
+                        range,                                              \
+                        constraint)                                         \
+  product(uint, SerialFullGCThreads, 1, EXPERIMENTAL,                       \
+          "Number of threads used by the parallel phases of the Serial "    \
+          "full GC. Currently only pointer adjustment runs in parallel")    \
+          range(1, 64)
 
 // end of GC_SERIAL_FLAGS
 
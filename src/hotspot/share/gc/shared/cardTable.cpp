@@ -382,6 +382,95 @@ void CardTable::clear_MemRegion(MemRegion mr) {
   memset(cur, clean_card, pointer_delta(last, cur, sizeof(CardValue)));
 }
 
+// Number of words of cards examined per step of the card range searches.
+static const size_t CardSearchBlockWords = 4;
+static const size_t CardSearchBlockBytes = CardSearchBlockWords * BytesPerWord;
+
+// Returns whether any byte of the given word is zero.
+static inline bool has_zero_byte(uintx w) {
+  const uintx ones = max_uintx / 0xff;
+  const uintx highs = ones << (BitsPerByte - 1);
+  return ((w - ones) & ~w & highs) != 0;
+}
+
+CardTable::CardValue* CardTable::find_first_non_clean_card(CardValue* start, CardValue* end) {
+  const uintx clean_word = (uintx)clean_card_row;
+  CardValue* cur = start;
+  while (cur < end && !is_aligned(cur, BytesPerWord)) {
+    if (*cur != clean_card) {
+      return cur;
+    }
+    cur++;
+  }
+  while (pointer_delta(end, cur, sizeof(CardValue)) >= CardSearchBlockBytes) {
+    const uintx* w = (const uintx*)cur;
+    if ((w[0] & w[1] & w[2] & w[3]) != clean_word) {
+      break;
+    }
+    cur += CardSearchBlockBytes;
+  }
+  while (pointer_delta(end, cur, sizeof(CardValue)) >= (size_t)BytesPerWord &&
+         *(const uintx*)cur == clean_word) {
+    cur += BytesPerWord;
+  }
+  while (cur < end && *cur == clean_card) {
+    cur++;
+  }
+  return cur;
+}
+
+CardTable::CardValue* CardTable::find_first_clean_card(CardValue* start, CardValue* end) {
+  CardValue* cur = start;
+  while (cur < end && !is_aligned(cur, BytesPerWord)) {
+    if (*cur == clean_card) {
+      return cur;
+    }
+    cur++;
+  }
+  // A clean card is a byte of all ones, i.e. a zero byte in the complement.
+  while (pointer_delta(end, cur, sizeof(CardValue)) >= CardSearchBlockBytes) {
+    const uintx* w = (const uintx*)cur;
+    if (has_zero_byte(~w[0]) | has_zero_byte(~w[1]) | has_zero_byte(~w[2]) | has_zero_byte(~w[3])) {
+      break;
+    }
+    cur += CardSearchBlockBytes;
+  }
+  while (pointer_delta(end, cur, sizeof(CardValue)) >= (size_t)BytesPerWord &&
+         !has_zero_byte(~*(const uintx*)cur)) {
+    cur += BytesPerWord;
+  }
+  while (cur < end && *cur != clean_card) {
+    cur++;
+  }
+  return cur;
+}
+
+CardTable::CardValue* CardTable::find_clean_run_start(CardValue* start, CardValue* end) {
+  const uintx clean_word = (uintx)clean_card_row;
+  CardValue* cur = end;
+  while (cur > start && !is_aligned(cur, BytesPerWord)) {
+    if (cur[-1] != clean_card) {
+      return cur;
+    }
+    cur--;
+  }
+  while (pointer_delta(cur, start, sizeof(CardValue)) >= CardSearchBlockBytes) {
+    const uintx* w = (const uintx*)(cur - CardSearchBlockBytes);
+    if ((w[0] & w[1] & w[2] & w[3]) != clean_word) {
+      break;
+    }
+    cur -= CardSearchBlockBytes;
+  }
+  while (pointer_delta(cur, start, sizeof(CardValue)) >= (size_t)BytesPerWord &&
+         *(const uintx*)(cur - BytesPerWord) == clean_word) {
+    cur -= BytesPerWord;
+  }
+  while (cur > start && cur[-1] == clean_card) {
+    cur--;
+  }
+  return cur;
+}
+
 void CardTable::clear(MemRegion mr) {
   for (int i = 0; i < _cur_covered_regions; i++) {
     MemRegion mri = mr.intersection(_covered[i]);
@@ -249,6 +249,18 @@ public:
   static constexpr CardValue dirty_card_val()          { return dirty_card; }
   static intptr_t clean_card_row_val()   { return clean_card_row; }
 
+  // Card range searches shared by the collectors. They examine several words
+  // of cards per step, which compilers turn into vector compares, and fall
+  // back to single cards only at the ends of the range and around a match.
+
+  // Returns the first card in [start, end) that is not clean, or end if all are.
+  static CardValue* find_first_non_clean_card(CardValue* start, CardValue* end);
+  // Returns the first clean card in [start, end), or end if there is none.
+  static CardValue* find_first_clean_card(CardValue* start, CardValue* end);
+  // Returns the lowest card c in [start, end] such that all cards in [c, end)
+  // are clean, searching downwards from end.
+  static CardValue* find_clean_run_start(CardValue* start, CardValue* end);
+
   // Initialize card size
   static void initialize_card_size();
 
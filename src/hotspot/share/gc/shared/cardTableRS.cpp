@@ -49,10 +49,6 @@ ClearNoncleanCardWrapper::ClearNoncleanCardWrapper(
     _dirty_card_closure(dirty_card_closure), _ct(ct) {
 }
 
-bool ClearNoncleanCardWrapper::is_word_aligned(CardTable::CardValue* entry) {
-  return (((intptr_t)entry) & (BytesPerWord-1)) == 0;
-}
-
 // The regions are visited in *decreasing* address order.
 // This order aids with imprecise card marking, where a dirty
 // card may cause scanning, and summarization marking, of objects
@@ -62,7 +58,7 @@ void ClearNoncleanCardWrapper::do_MemRegion(MemRegion mr) {
   assert(_ct->is_aligned(mr.start()), "mr.start() should be card aligned");
   // mr.end() may not necessarily be card aligned.
   CardValue* cur_entry = _ct->byte_for(mr.last());
-  const CardValue* limit = _ct->byte_for(mr.start());
+  CardValue* limit = _ct->byte_for(mr.start());
   HeapWord* end_of_non_clean = mr.end();
   HeapWord* start_of_non_clean = end_of_non_clean;
   while (cur_entry >= limit) {
@@ -79,15 +75,9 @@ void ClearNoncleanCardWrapper::do_MemRegion(MemRegion mr) {
         _dirty_card_closure->do_MemRegion(mrd);
       }
 
-      // fast forward through potential continuous whole-word range of clean cards beginning at a word-boundary
-      if (is_word_aligned(cur_entry)) {
-        CardValue* cur_row = cur_entry - BytesPerWord;
-        while (cur_row >= limit && *((intptr_t*)cur_row) ==  CardTableRS::clean_card_row_val()) {
-          cur_row -= BytesPerWord;
-        }
-        cur_entry = cur_row + BytesPerWord;
-        cur_hw = _ct->addr_for(cur_entry);
-      }
+      // fast forward through a potential continuous range of clean cards
+      cur_entry = CardTable::find_clean_run_start(limit, cur_entry);
+      cur_hw = _ct->addr_for(cur_entry);
 
       // Reset the dirty window, while continuing to look
       // for the next dirty card that will start a
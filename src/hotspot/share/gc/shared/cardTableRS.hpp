@@ -90,8 +90,6 @@ private:
   // Clears the given card, return true if the corresponding card should be
   // processed.
   inline bool clear_card(CardValue* entry);
-  // check alignment of pointer
-  bool is_word_aligned(CardValue* entry);
 
 public:
   ClearNoncleanCardWrapper(DirtyCardToOopClosure* dirty_card_closure, CardTableRS* ct);
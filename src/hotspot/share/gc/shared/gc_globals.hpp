@@ -278,6 +278,10 @@
   product(uintx, WorkStealingSpinToYieldRatio, 10, EXPERIMENTAL,            \
           "Ratio of hard spins to calls to yield")                          \
                                                                             \
+  product(bool, GCStealBatch, false, EXPERIMENTAL,                          \
+          "Steal up to half of the tasks of the victim task queue at "      \
+          "once, instead of a single task")                                 \
+                                                                            \
   develop(uintx, ObjArrayMarkingStride, 2048,                               \
           "Number of object array elements to push onto the marking stack " \
           "before pushing a continuation entry")                            \
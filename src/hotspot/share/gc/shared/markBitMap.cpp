@@ -45,6 +45,16 @@ void MarkBitMap::initialize(MemRegion heap, MemRegion storage) {
   _bm = BitMapView((BitMap::bm_word_t*) storage.start(), _covered.word_size() >> _shifter);
 }
 
+void MarkBitMap::par_clear_range(MemRegion mr) {
+  MemRegion intersection = mr.intersection(_covered);
+  assert(!intersection.is_empty(),
+         "Given range from " PTR_FORMAT " to " PTR_FORMAT " is completely outside the heap",
+         p2i(mr.start()), p2i(mr.end()));
+  _bm.par_clear_range(addr_to_offset(intersection.start()),
+                      addr_to_offset(intersection.end()),
+                      BitMap::unknown_range);
+}
+
 void MarkBitMap::do_clear(MemRegion mr, bool large) {
   MemRegion intersection = mr.intersection(_covered);
   assert(!intersection.is_empty(),
@@ -97,6 +97,8 @@ public:
   void clear()                         { do_clear(_covered, true); }
   void clear_range(MemRegion mr)       { do_clear(mr, false);      }
   void clear_range_large(MemRegion mr) { do_clear(mr, true);       }
+  // Clear a range that may share bitmap words with ranges cleared concurrently.
+  void par_clear_range(MemRegion mr);
 };
 
 #endif // SHARE_GC_SHARED_MARKBITMAP_HPP
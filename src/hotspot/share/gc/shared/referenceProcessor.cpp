@@ -1122,6 +1122,26 @@ void ReferenceProcessor::preclean_discovered_references(BoolObjectClosure* is_al
   }
 }
 
+bool ReferenceProcessor::preclean_discovered_references(ReferenceType type,
+                                                        uint queue,
+                                                        BoolObjectClosure* is_alive,
+                                                        EnqueueDiscoveredFieldClosure* enqueue,
+                                                        YieldClosure* yield) {
+  assert(queue < _max_num_queues, "queue %u out of range", queue);
+  DiscoveredList* lists = NULL;
+  switch (type) {
+    case REF_SOFT:    lists = _discoveredSoftRefs;    break;
+    case REF_WEAK:    lists = _discoveredWeakRefs;    break;
+    case REF_FINAL:   lists = _discoveredFinalRefs;   break;
+    case REF_PHANTOM: lists = _discoveredPhantomRefs; break;
+    default:          ShouldNotReachHere();
+  }
+  if (yield->should_return()) {
+    return true;
+  }
+  return preclean_discovered_reflist(lists[queue], is_alive, enqueue, yield);
+}
+
 bool ReferenceProcessor::preclean_discovered_reflist(DiscoveredList&    refs_list,
                                                      BoolObjectClosure* is_alive,
                                                      EnqueueDiscoveredFieldClosure* enqueue,
@@ -320,6 +320,15 @@ public:
                                       YieldClosure*      yield,
                                       GCTimer*           gc_timer);
 
+  // Preclean the discovered list of the given reference type with the given
+  // queue index, as described above. Lists with different queue indices can
+  // be precleaned concurrently. Returns whether the operation was aborted.
+  bool preclean_discovered_references(ReferenceType type,
+                                      uint queue,
+                                      BoolObjectClosure* is_alive,
+                                      EnqueueDiscoveredFieldClosure* enqueue,
+                                      YieldClosure*      yield);
+
 private:
   // Returns the name of the discovered reference list
   // occupying the i / _num_queues slot.
@@ -418,8 +418,18 @@ void ContiguousSpace::prepare_for_compaction(CompactPoint* cp) {
   HeapWord* cur_obj = bottom();
   HeapWord* scan_limit = top();
 
+  // Record chunk starts for adjusting the pointers in parallel.
+  const size_t adjust_chunk_size = MAX2(pointer_delta(scan_limit, bottom()) / MaxAdjustChunks, (size_t)1);
+  HeapWord* next_adjust_chunk = bottom() + adjust_chunk_size;
+  _adjust_chunk_starts[0] = bottom();
+  _num_adjust_chunks = 1;
+
   while (cur_obj < scan_limit) {
     if (cast_to_oop(cur_obj)->is_gc_marked()) {
+      if (cur_obj >= next_adjust_chunk && _num_adjust_chunks < MaxAdjustChunks) {
+        _adjust_chunk_starts[_num_adjust_chunks++] = cur_obj;
+        next_adjust_chunk = cur_obj + adjust_chunk_size;
+      }
       // prefetch beyond cur_obj
       Prefetch::write(cur_obj, interval);
       size_t size = cast_to_oop(cur_obj)->size();
@@ -478,12 +488,26 @@ void CompactibleSpace::adjust_pointers() {
 
   // adjust all the interior pointers to point at the new locations of objects
   // Used by MarkSweep::mark_sweep_phase3()
+  adjust_pointers_in(bottom(), _end_of_live);  // Established by prepare_for_compaction().
+}
 
-  HeapWord* cur_obj = bottom();
-  HeapWord* const end_of_live = _end_of_live;  // Established by prepare_for_compaction().
+uint CompactibleSpace::num_adjust_chunks() const {
+  return used() == 0 ? 0 : _num_adjust_chunks;
+}
+
+void CompactibleSpace::adjust_pointers_in_chunk(uint chunk) {
+  assert(chunk < num_adjust_chunks(), "chunk %u out of range", chunk);
+  HeapWord* start = _adjust_chunk_starts[chunk];
+  HeapWord* end = chunk + 1 < _num_adjust_chunks ? _adjust_chunk_starts[chunk + 1] : _end_of_live;
+  adjust_pointers_in(start, MIN2(end, _end_of_live));
+}
+
+void CompactibleSpace::adjust_pointers_in(HeapWord* start, HeapWord* end) {
+  HeapWord* cur_obj = start;
+  HeapWord* const end_of_live = end;
   HeapWord* const first_dead = _first_dead;    // Established by prepare_for_compaction().
 
-  assert(first_dead <= end_of_live, "Stands to reason, no?");
+  assert(first_dead <= _end_of_live, "Stands to reason, no?");
 
   const intx interval = PrefetchScanIntervalInBytes;
 
@@ -321,7 +321,7 @@ private:
 
 public:
   CompactibleSpace() :
-   _compaction_top(NULL), _next_compaction_space(NULL) {}
+   _compaction_top(NULL), _next_compaction_space(NULL), _num_adjust_chunks(0) {}
 
   virtual void initialize(MemRegion mr, bool clear_space, bool mangle_space);
   virtual void clear(bool mangle_space);
@@ -366,6 +366,10 @@ public:
   virtual void prepare_for_compaction(CompactPoint* cp) = 0;
   // MarkSweep support phase3
   virtual void adjust_pointers();
+  // The live part of the space split into chunks that can be adjusted
+  // independently of each other.
+  uint num_adjust_chunks() const;
+  void adjust_pointers_in_chunk(uint chunk);
   // MarkSweep support phase4
   virtual void compact();
 #endif // INCLUDE_SERIALGC
@@ -399,11 +403,23 @@ public:
   void set_first_dead(HeapWord* value) { _first_dead = value; }
   void set_end_of_live(HeapWord* value) { _end_of_live = value; }
 
+  static const uint MaxAdjustChunks = 64;
+
 protected:
   // Used during compaction.
   HeapWord* _first_dead;
   HeapWord* _end_of_live;
 
+  // Starts of roughly evenly spaced chunks of [bottom, end_of_live),
+  // established by prepare_for_compaction(). Only the first chunk may
+  // start with a dead object; the others start with a live one.
+  HeapWord* _adjust_chunk_starts[MaxAdjustChunks];
+  uint _num_adjust_chunks;
+
+#if INCLUDE_SERIALGC
+  void adjust_pointers_in(HeapWord* start, HeapWord* end);
+#endif // INCLUDE_SERIALGC
+
   // This the function to invoke when an allocation of an object covering
   // "start" to "end" occurs to update other internal data structures.
   virtual void alloc_block(HeapWord* start, HeapWord* the_end) { }
@@ -480,14 +480,23 @@ void StringDedup::Table::free_buckets(Bucket* buckets, size_t number_of_buckets)
   FREE_C_HEAP_ARRAY(Bucket, buckets);
 }
 
-// Compute the hash code for obj using halfsiphash_32.  As this is a high
+// Compute the hash code for value using halfsiphash_32.  As this is a high
 // quality hash function that is resistant to hashtable flooding, very
 // unbalanced bucket chains should be rare, and duplicate hash codes within
 // a bucket should be very rare.
-uint StringDedup::Table::compute_hash(typeArrayOop obj) {
-  int length = obj->length();
+//
+// With StringDeduplicationUseStringHash, use the String's own hash code
+// instead.  That is usually already cached in the String, and otherwise
+// gets cached for later use by Java code, but gives up the flooding
+// resistance.  Equal value arrays of Strings with different coders then get
+// different hash codes, which only means they aren't deduplicated.
+uint StringDedup::Table::compute_hash(oop java_string, typeArrayOop value) {
+  if (StringDeduplicationUseStringHash) {
+    return java_lang_String::hash_code(java_string);
+  }
+  int length = value->length();
   uint64_t hash_seed = Config::hash_seed();
-  const uint8_t* data = static_cast<uint8_t*>(obj->base(T_BYTE));
+  const uint8_t* data = static_cast<uint8_t*>(value->base(T_BYTE));
   return AltHashing::halfsiphash_32(hash_seed, data, length);
 }
 
@@ -640,7 +649,7 @@ void StringDedup::Table::deduplicate(oop java_string) {
     return;                     // Done if deduplicated against shared StringTable.
   }
   typeArrayOop value = java_lang_String::value(java_string);
-  uint hash_code = compute_hash(value);
+  uint hash_code = compute_hash(java_string, value);
   TableValue tv = find(value, hash_code);
   if (tv.is_empty()) {
     // Not in table.  Create a new table entry.
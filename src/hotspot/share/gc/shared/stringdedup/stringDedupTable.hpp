@@ -90,7 +90,7 @@ private:
   static volatile size_t _dead_count;
   static volatile DeadState _dead_state;
 
-  static uint compute_hash(typeArrayOop obj);
+  static uint compute_hash(oop java_string, typeArrayOop value);
   static size_t hash_to_index(uint hash_code);
   static void add(TableValue tv, uint hash_code);
   static TableValue find(typeArrayOop obj, uint hash_code);
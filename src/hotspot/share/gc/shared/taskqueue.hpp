@@ -453,6 +453,8 @@ private:
   T** _queues;
 
   bool steal_best_of_2(uint queue_num, E& t);
+  // Move up to half of the victim's sampled size into the local queue.
+  void steal_batch(T* local_queue, T* victim, uint victim_size);
 
 public:
   GenericTaskQueueSet(uint n);
@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_SHARED_TASKQUEUE_INLINE_HPP
 #define SHARE_GC_SHARED_TASKQUEUE_INLINE_HPP
 
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/taskqueue.hpp"
 
 #include "memory/allocation.inline.hpp"
@@ -303,6 +304,9 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
 
     if (suc) {
       local_queue->set_last_stolen_queue_id(sel_k);
+      if (GCStealBatch) {
+        steal_batch(local_queue, _queues[sel_k], MAX2(sz1, sz2));
+      }
     } else {
       local_queue->invalidate_last_stolen_queue_id();
     }
@@ -318,6 +322,24 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
   }
 }
 
+template<class T, MEMFLAGS F> void
+GenericTaskQueueSet<T, F>::steal_batch(T* local_queue, T* victim, uint victim_size) {
+  // Only the owner pushes to the local queue, so the free space computed here
+  // cannot shrink while we are moving tasks. The first task has already been
+  // taken by the caller.
+  uint free_space = local_queue->max_elems() - local_queue->size();
+  uint batch = MIN2(victim_size / 2, free_space + 1);
+  for (uint i = 1; i < batch; i++) {
+    E t;
+    if (!victim->pop_global(t)) {
+      break;
+    }
+    bool pushed = local_queue->push(t);
+    assert(pushed, "must have space");
+    TASKQUEUE_STATS_ONLY(local_queue->stats.record_steal());
+  }
+}
+
 template<class T, MEMFLAGS F> bool
 GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
   assert(queue_num < _n, "index out of range.");
@@ -56,7 +56,8 @@ ThreadLocalAllocBuffer::ThreadLocalAllocBuffer() :
   _gc_waste(0),
   _slow_allocations(0),
   _allocated_size(0),
-  _allocation_fraction(TLABAllocationWeight) {
+  _allocation_fraction(TLABAllocationWeight),
+  _allocation_per_gc(TLABAllocationWeight) {
 
   // do nothing. TLABs must be inited by initialize() calls
 }
@@ -85,10 +86,16 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
 
   print_stats("gc");
 
-  if (_number_of_refills > 0) {
-    // Update allocation history if a reasonable amount of eden was allocated.
-    bool update_allocation_history = used > 0.5 * capacity;
+  // Update allocation history if a reasonable amount of eden was allocated.
+  bool update_allocation_history = used > 0.5 * capacity;
+
+  if (TLABSizeByThreadAllocation && update_allocation_history) {
+    // Unlike the eden fraction below, also sample threads that did not
+    // refill at all, so that the TLABs of idle threads shrink.
+    _allocation_per_gc.sample((float)(allocated_since_last_gc / HeapWordSize));
+  }
 
+  if (_number_of_refills > 0) {
     if (update_allocation_history) {
       // Average the fraction of eden allocated in a tlab by this
       // thread for use in the next resize operation.
@@ -155,8 +162,15 @@ void ThreadLocalAllocBuffer::retire_before_allocation() {
 void ThreadLocalAllocBuffer::resize() {
   // Compute the next tlab size using expected allocation amount
   assert(ResizeTLAB, "Should not call this otherwise");
-  size_t alloc = (size_t)(_allocation_fraction.average() *
-                          (Universe::heap()->tlab_capacity(thread()) / HeapWordSize));
+  size_t capacity = Universe::heap()->tlab_capacity(thread()) / HeapWordSize;
+  size_t alloc;
+  if (TLABSizeByThreadAllocation) {
+    // Predict the allocation of this thread until the next GC from its own
+    // history. This does not depend on how many other threads allocated.
+    alloc = MIN2((size_t)_allocation_per_gc.average(), capacity);
+  } else {
+    alloc = (size_t)(_allocation_fraction.average() * capacity);
+  }
   size_t new_size = alloc / _target_refills;
 
   new_size = clamp(new_size, min_size(), max_size());
@@ -216,6 +230,7 @@ void ThreadLocalAllocBuffer::initialize() {
   // Keep alloc_frac as float and not double to avoid the double to float conversion
   float alloc_frac = desired_size() * target_refills() / (float) capacity;
   _allocation_fraction.sample(alloc_frac);
+  _allocation_per_gc.sample((float)(desired_size() * target_refills()));
 
   set_refill_waste_limit(initial_refill_waste_limit());
 
@@ -69,6 +69,7 @@ private:
   size_t    _allocated_size;
 
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
+  AdaptiveWeightedAverage _allocation_per_gc;    // words allocated by this thread between GCs
 
   void reset_statistics();
 
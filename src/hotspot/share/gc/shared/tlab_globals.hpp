@@ -70,6 +70,11 @@
           "Allocation averaging weight")                                    \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, TLABSizeByThreadAllocation, false, EXPERIMENTAL,            \
+          "Size TLABs from the average amount each thread allocated "       \
+          "between recent GCs instead of from its share of the eden "       \
+          "allocated at those GCs")                                         \
+                                                                            \
   /* Limit the lower bound of this flag to 1 as it is used  */              \
   /* in a division expression.                              */              \
   product(uintx, TLABWasteTargetPercent, 1,                                 \
@@ -75,6 +75,22 @@ public:
   size_t total() const { return dead() + _live; }
 };
 
+template<typename IsAlive, typename KeepAlive>
+void WeakProcessor::Task::work_storage(OopStorageSet::WeakId id,
+                                       uint worker_id,
+                                       IsAlive* is_alive,
+                                       KeepAlive* keep_alive) {
+  CountingClosure<IsAlive, KeepAlive> cl(is_alive, keep_alive);
+  WeakProcessorParTimeTracker pt(_times, id, worker_id);
+  StorageState* cur_state = _storage_states.par_state(id);
+  assert(cur_state->storage() == OopStorageSet::storage(id), "invariant");
+  cur_state->oops_do(&cl);
+  cur_state->increment_num_dead(cl.dead());
+  if (_times != NULL) {
+    _times->record_worker_items(worker_id, id, cl.new_dead(), cl.total());
+  }
+}
+
 template<typename IsAlive, typename KeepAlive>
 void WeakProcessor::Task::work(uint worker_id,
                                IsAlive* is_alive,
@@ -83,16 +99,19 @@ void WeakProcessor::Task::work(uint worker_id,
          "worker_id (%u) exceeds task's configured workers (%u)",
          worker_id, _nworkers);
 
-  for (auto id : EnumRange<OopStorageSet::WeakId>()) {
-    CountingClosure<IsAlive, KeepAlive> cl(is_alive, keep_alive);
-    WeakProcessorParTimeTracker pt(_times, id, worker_id);
-    StorageState* cur_state = _storage_states.par_state(id);
-    assert(cur_state->storage() == OopStorageSet::storage(id), "invariant");
-    cur_state->oops_do(&cl);
-    cur_state->increment_num_dead(cl.dead());
-    if (_times != NULL) {
-      _times->record_worker_items(worker_id, id, cl.new_dead(), cl.total());
-    }
+  // Every worker claims blocks from every storage, but workers start at
+  // different storages and wrap around. Otherwise all workers first contend
+  // for the blocks of the same storage, and a large storage late in the
+  // order is only started once all earlier ones have been claimed.
+  constexpr EnumRange<OopStorageSet::WeakId> all_ids{};
+  OopStorageSet::WeakId start =
+    static_cast<OopStorageSet::WeakId>(static_cast<uint>(all_ids.first()) +
+                                       worker_id % all_ids.size());
+  for (auto id : EnumRange<OopStorageSet::WeakId>(start)) {
+    work_storage(id, worker_id, is_alive, keep_alive);
+  }
+  for (auto id : EnumRange<OopStorageSet::WeakId>(all_ids.first(), start)) {
+    work_storage(id, worker_id, is_alive, keep_alive);
   }
 }
 
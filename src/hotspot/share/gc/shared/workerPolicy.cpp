@@ -87,7 +87,7 @@ uint WorkerPolicy::parallel_worker_threads() {
 //  Else
 //    Calculate the number of GC threads based on the number of Java threads.
 //    Calculate the number of GC threads based on the size of the heap.
-//    Use the larger.
+//    Use the larger, but no more than the currently active processors.
 uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
                                                const uintx min_workers,
                                                uintx active_workers,
@@ -128,6 +128,13 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
       MAX2(min_workers, (prev_active_workers + new_active_workers) / 2);
   }
 
+  // The number of processors available to the VM may have dropped since
+  // startup, e.g. because the container CPU quota was lowered. Running more
+  // workers than that only gets them throttled, so follow it immediately.
+  uintx active_processors = (uintx) os::active_processor_count();
+  new_active_workers =
+    MIN2(new_active_workers, MAX2(min_workers, active_processors));
+
   // Check once more that the number of workers is within the limits.
   assert(min_workers <= total_workers, "Minimum workers not consistent with total workers");
   assert(new_active_workers >= min_workers, "Minimum workers not observed");
@@ -136,9 +143,10 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
   log_trace(gc, task)("WorkerPolicy::calc_default_active_workers() : "
     "active_workers(): " UINTX_FORMAT "  new_active_workers: " UINTX_FORMAT "  "
     "prev_active_workers: " UINTX_FORMAT "\n"
-    " active_workers_by_JT: " UINTX_FORMAT "  active_workers_by_heap_size: " UINTX_FORMAT,
+    " active_workers_by_JT: " UINTX_FORMAT "  active_workers_by_heap_size: " UINTX_FORMAT
+    "  active_processors: " UINTX_FORMAT,
     active_workers, new_active_workers, prev_active_workers,
-    active_workers_by_JT, active_workers_by_heap_size);
+    active_workers_by_JT, active_workers_by_heap_size, active_processors);
   assert(new_active_workers > 0, "Always need at least 1");
   return new_active_workers;
 }
@@ -29,6 +29,7 @@
 #include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
+#include "gc/shenandoah/shenandoahJfrSupport.hpp"
 #include "logging/log.hpp"
 #include "logging/logTag.hpp"
 #include "utilities/quickSort.hpp"
@@ -67,6 +68,11 @@ void ShenandoahAdaptiveHeuristics::choose_collection_set_from_regiondata(Shenand
                                                                          size_t actual_free) {
   size_t garbage_threshold = ShenandoahHeapRegion::region_size_bytes() * ShenandoahGarbageThreshold / 100;
 
+  // Old regions mostly hold long-lived data that would survive the next cycle again.
+  // Evacuating them only pays off when they have accumulated much more garbage.
+  size_t old_garbage_threshold = ShenandoahHeapRegion::region_size_bytes() *
+                                 MAX2(ShenandoahGarbageThreshold, ShenandoahOldGarbageThreshold) / 100;
+
   // The logic for cset selection in adaptive is as follows:
   //
   //   1. We cannot get cset larger than available free space. Otherwise we guarantee OOME
@@ -112,7 +118,9 @@ void ShenandoahAdaptiveHeuristics::choose_collection_set_from_regiondata(Shenand
       break;
     }
 
-    if ((new_garbage < min_garbage) || (r->garbage() > garbage_threshold)) {
+    size_t threshold = r->is_old() ? old_garbage_threshold : garbage_threshold;
+
+    if ((new_garbage < min_garbage) || (r->garbage() > threshold)) {
       cset->add_region(r);
       cur_cset = new_cset;
       cur_garbage = new_garbage;
@@ -215,6 +223,7 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() {
     log_info(gc)("Trigger: Free (" SIZE_FORMAT "%s) is below minimum threshold (" SIZE_FORMAT "%s)",
                  byte_size_in_proper_unit(available),     proper_unit_for_byte_size(available),
                  byte_size_in_proper_unit(min_threshold), proper_unit_for_byte_size(min_threshold));
+    ShenandoahJFRSupport::send_trigger_event("Free", available, available, 0.0, rate);
     return true;
   }
 
@@ -226,6 +235,7 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() {
                    _gc_times_learned + 1, max_learn,
                    byte_size_in_proper_unit(available),      proper_unit_for_byte_size(available),
                    byte_size_in_proper_unit(init_threshold), proper_unit_for_byte_size(init_threshold));
+      ShenandoahJFRSupport::send_trigger_event("Learning", available, available, 0.0, rate);
       return true;
     }
   }
@@ -257,6 +267,7 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() {
                        byte_size_in_proper_unit(allocation_headroom), proper_unit_for_byte_size(allocation_headroom));
 
     _last_trigger = RATE;
+    ShenandoahJFRSupport::send_trigger_event("Rate", available, allocation_headroom, avg_cycle_time, avg_alloc_rate);
     return true;
   }
 
@@ -268,9 +279,27 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() {
                  byte_size_in_proper_unit(allocation_headroom), proper_unit_for_byte_size(allocation_headroom),
                  _spike_threshold_sd);
     _last_trigger = SPIKE;
+    ShenandoahJFRSupport::send_trigger_event("Spike", available, allocation_headroom, avg_cycle_time, rate);
     return true;
   }
 
+  if (ShenandoahAdaptivePeakWindowSeconds > 0) {
+    // Short bursts of allocation move neither the moving average nor,
+    // unless we happen to sample at the top of the burst, the spike
+    // detection. Look at the highest rate seen in the recent window.
+    double peak_rate = _allocation_rate.recent_peak();
+    if (peak_rate > 0 && avg_cycle_time > allocation_headroom / peak_rate) {
+      log_info(gc)("Trigger: Average GC time (%.2f ms) is above the time for recent peak allocation rate (%.0f %sB/s) to deplete free headroom (" SIZE_FORMAT "%s) (window = %.1f s)",
+                   avg_cycle_time * 1000,
+                   byte_size_in_proper_unit(peak_rate), proper_unit_for_byte_size(peak_rate),
+                   byte_size_in_proper_unit(allocation_headroom), proper_unit_for_byte_size(allocation_headroom),
+                   ShenandoahAdaptivePeakWindowSeconds);
+      _last_trigger = PEAK;
+      ShenandoahJFRSupport::send_trigger_event("Peak", available, allocation_headroom, avg_cycle_time, peak_rate);
+      return true;
+    }
+  }
+
   return ShenandoahHeuristics::should_start_gc();
 }
 
@@ -282,6 +311,8 @@ void ShenandoahAdaptiveHeuristics::adjust_last_trigger_parameters(double amount)
     case SPIKE:
       adjust_spike_threshold(amount);
       break;
+    case PEAK:
+      // The peak trigger has no tunable parameter.
     case OTHER:
       // nothing to adjust here.
       break;
@@ -305,7 +336,8 @@ ShenandoahAllocationRate::ShenandoahAllocationRate() :
   _last_sample_value(0),
   _interval_sec(1.0 / ShenandoahAdaptiveSampleFrequencyHz),
   _rate(int(ShenandoahAdaptiveSampleSizeSeconds * ShenandoahAdaptiveSampleFrequencyHz), ShenandoahAdaptiveDecayFactor),
-  _rate_avg(int(ShenandoahAdaptiveSampleSizeSeconds * ShenandoahAdaptiveSampleFrequencyHz), ShenandoahAdaptiveDecayFactor) {
+  _rate_avg(int(ShenandoahAdaptiveSampleSizeSeconds * ShenandoahAdaptiveSampleFrequencyHz), ShenandoahAdaptiveDecayFactor),
+  _recent_rate(MAX2(int(ShenandoahAdaptivePeakWindowSeconds * ShenandoahAdaptiveSampleFrequencyHz), 1)) {
 }
 
 double ShenandoahAllocationRate::sample(size_t allocated) {
@@ -316,6 +348,7 @@ double ShenandoahAllocationRate::sample(size_t allocated) {
       rate = instantaneous_rate(now, allocated);
       _rate.add(rate);
       _rate_avg.add(_rate.avg());
+      _recent_rate.add(rate);
     }
 
     _last_sample_time = now;
@@ -332,6 +365,10 @@ double ShenandoahAllocationRate::upper_bound(double sds) const {
   return _rate.davg() + (sds * _rate_avg.dsd());
 }
 
+double ShenandoahAllocationRate::recent_peak() const {
+  return _recent_rate.maximum();
+}
+
 void ShenandoahAllocationRate::allocation_counter_reset() {
   _last_sample_time = os::elapsedTime();
   _last_sample_value = 0;
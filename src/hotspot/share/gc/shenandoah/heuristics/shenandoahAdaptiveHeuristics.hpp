@@ -40,6 +40,9 @@ class ShenandoahAllocationRate : public CHeapObj<mtGC> {
   double upper_bound(double sds) const;
   bool is_spiking(double rate, double threshold) const;
 
+  // Highest rate sampled in the last ShenandoahAdaptivePeakWindowSeconds.
+  double recent_peak() const;
+
  private:
 
   double instantaneous_rate(double time, size_t allocated) const;
@@ -49,6 +52,7 @@ class ShenandoahAllocationRate : public CHeapObj<mtGC> {
   double _interval_sec;
   TruncatedSeq _rate;
   TruncatedSeq _rate_avg;
+  TruncatedSeq _recent_rate;
 };
 
 class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
@@ -92,7 +96,7 @@ public:
   // error for the average cycle time and allocation rate or the allocation
   // spike detection threshold.
   enum Trigger {
-    SPIKE, RATE, OTHER
+    SPIKE, RATE, PEAK, OTHER
   };
 
   void adjust_last_trigger_parameters(double amount);
@@ -110,6 +110,9 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
         immediate_garbage += garbage;
         region->make_trash_immediate();
       } else {
+        // The region survived another marking cycle.
+        region->increment_age();
+
         // This is our candidate for later consideration.
         candidates[cand_idx]._region = region;
         candidates[cand_idx]._garbage = garbage;
@@ -29,6 +29,8 @@
 #include "gc/shenandoah/shenandoahHeap.hpp"
 
 class ShenandoahFreeSet : public CHeapObj<mtGC> {
+  friend class ShenandoahRebuildFreeSetClosure;
+
 private:
   ShenandoahHeap* const _heap;
   CHeapBitMap _mutator_free_bitmap;
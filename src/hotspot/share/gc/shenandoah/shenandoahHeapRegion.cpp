@@ -67,6 +67,7 @@ ShenandoahHeapRegion::ShenandoahHeapRegion(HeapWord* start, size_t index, bool c
   _gclab_allocs(0),
   _live_data(0),
   _critical_pins(0),
+  _age(0),
   _update_watermark(start) {
 
   assert(Universe::on_page_boundary(_bottom) && Universe::on_page_boundary(_end),
@@ -374,6 +375,7 @@ void ShenandoahHeapRegion::print_on(outputStream* st) const {
   st->print("|S " SIZE_FORMAT_W(5) "%1s", byte_size_in_proper_unit(get_shared_allocs()),   proper_unit_for_byte_size(get_shared_allocs()));
   st->print("|L " SIZE_FORMAT_W(5) "%1s", byte_size_in_proper_unit(get_live_data_bytes()), proper_unit_for_byte_size(get_live_data_bytes()));
   st->print("|CP " SIZE_FORMAT_W(3), pin_count());
+  st->print("|A %3u", age());
   st->cr();
 }
 
@@ -424,6 +426,7 @@ ShenandoahHeapRegion* ShenandoahHeapRegion::humongous_start_region() const {
 void ShenandoahHeapRegion::recycle() {
   set_top(bottom());
   clear_live_data();
+  _age = 0;
 
   reset_alloc_metadata();
 
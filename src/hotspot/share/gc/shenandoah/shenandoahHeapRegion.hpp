@@ -244,6 +244,8 @@ private:
   volatile size_t _live_data;
   volatile size_t _critical_pins;
 
+  uint _age;
+
   HeapWord* volatile _update_watermark;
 
 public:
@@ -352,6 +354,11 @@ public:
 
   inline size_t garbage() const;
 
+  // Number of marking cycles this region survived since it was last recycled
+  uint age() const            { return _age; }
+  void increment_age()        { if (_age < UINT8_MAX) _age++; }
+  bool is_old() const         { return ShenandoahOldRegionAge > 0 && _age >= ShenandoahOldRegionAge; }
+
   void print_on(outputStream* st) const;
 
   void recycle();
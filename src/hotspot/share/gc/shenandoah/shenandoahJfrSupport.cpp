@@ -65,6 +65,22 @@ public:
   }
 };
 
+void ShenandoahJFRSupport::send_trigger_event(const char* trigger,
+                                              size_t available,
+                                              size_t headroom,
+                                              double avg_cycle_time_sec,
+                                              double alloc_rate) {
+  EventShenandoahHeuristicsTrigger evt;
+  if (evt.should_commit()) {
+    evt.set_trigger(trigger);
+    evt.set_available(available);
+    evt.set_headroom(headroom);
+    evt.set_averageCycleTime((s8)(avg_cycle_time_sec * NANOSECS_PER_SEC));
+    evt.set_allocationRate(alloc_rate);
+    evt.commit();
+  }
+}
+
 void VM_ShenandoahSendHeapRegionInfoEvents::doit() {
   ShenandoahDumpHeapRegionInfoClosure c;
   ShenandoahHeap::heap()->heap_region_iterate(&c);
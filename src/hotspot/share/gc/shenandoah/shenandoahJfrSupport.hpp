@@ -36,6 +36,13 @@ public:
 class ShenandoahJFRSupport {
 public:
   static void register_jfr_type_serializers();
+
+  // Report the heuristics decision to start a GC cycle.
+  static void send_trigger_event(const char* trigger,
+                                 size_t available,
+                                 size_t headroom,
+                                 double avg_cycle_time_sec,
+                                 double alloc_rate);
 };
 
 #endif // SHARE_VM_GC_SHENANDOAH_SHENANDOAHJFRSUPPORT_HPP
@@ -89,6 +89,18 @@
           "collector accepts. In percents of heap region size.")            \
           range(0,100)                                                      \
                                                                             \
+  product(uintx, ShenandoahOldRegionAge, 0, EXPERIMENTAL,                   \
+          "Number of marking cycles a region has to survive before it is "  \
+          "considered old. Old regions are only taken for collection with " \
+          "more than ShenandoahOldGarbageThreshold garbage. Set to zero "   \
+          "to disable.")                                                    \
+          range(0,255)                                                      \
+                                                                            \
+  product(uintx, ShenandoahOldGarbageThreshold, 50, EXPERIMENTAL,           \
+          "How much garbage an old region has to contain before it would "  \
+          "be taken for collection. In percents of heap region size.")      \
+          range(0,100)                                                      \
+                                                                            \
   product(uintx, ShenandoahInitFreeThreshold, 70, EXPERIMENTAL,             \
           "How much heap should be free before some heuristics trigger the "\
           "initial (learning) cycles. Affects cycle frequency on startup "  \
@@ -149,6 +161,14 @@
           "the heuristic is to allocation spikes. Decreasing this number "  \
           "increases the sensitivity. ")                                    \
                                                                             \
+  product(double, ShenandoahAdaptivePeakWindowSeconds, 0, EXPERIMENTAL,     \
+          "If the highest allocation rate sampled in this many most "       \
+          "recent seconds would deplete the free headroom before an "       \
+          "average cycle completes, then a cycle is initiated. This "       \
+          "catches bursts that are too short to move the moving average. "  \
+          "Setting this to 0 disables the trigger.")                        \
+          range(0, 60)                                                      \
+                                                                            \
   product(double, ShenandoahAdaptiveDecayFactor, 0.5, EXPERIMENTAL,         \
           "The decay factor (alpha) used for values in the weighted "       \
           "moving average of cycle time and allocation rate. "              \
@@ -26,6 +26,7 @@
 
 #include "gc/z/zBitField.hpp"
 #include "memory/allocation.hpp"
+#include "utilities/debug.hpp"
 
 //
 // Allocation flags layout
@@ -33,7 +34,7 @@
 //
 //   7     2 1 0
 //  +-----+-+-+-+
-//  |00000|1|1|1|
+//  |11111|1|1|1|
 //  +-----+-+-+-+
 //  |     | | |
 //  |     | | * 0-0 Non-Blocking Flag (1-bit)
@@ -42,7 +43,7 @@
 //  |     |
 //  |     * 2-2 Low Address Flag (1-bit)
 //  |
-//  * 7-3 Unused (5-bits)
+//  * 7-3 Preferred NUMA Id Plus One (5-bits, zero means no preference)
 //
 
 class ZAllocationFlags {
@@ -50,6 +51,9 @@ private:
   typedef ZBitField<uint8_t, bool, 0, 1> field_non_blocking;
   typedef ZBitField<uint8_t, bool, 1, 1> field_worker_relocation;
   typedef ZBitField<uint8_t, bool, 2, 1> field_low_address;
+  typedef ZBitField<uint8_t, uint8_t, 3, 5> field_numa_id;
+
+  static const uint32_t max_numa_id = (1 << 5) - 1;
 
   uint8_t _flags;
 
@@ -69,6 +73,13 @@ public:
     _flags |= field_low_address::encode(true);
   }
 
+  void set_numa_id(uint32_t numa_id) {
+    // NUMA ids that do not fit are silently ignored
+    if (numa_id < max_numa_id) {
+      _flags |= field_numa_id::encode((uint8_t)(numa_id + 1));
+    }
+  }
+
   bool non_blocking() const {
     return field_non_blocking::decode(_flags);
   }
@@ -80,6 +91,15 @@ public:
   bool low_address() const {
     return field_low_address::decode(_flags);
   }
+
+  bool has_numa_id() const {
+    return field_numa_id::decode(_flags) != 0;
+  }
+
+  uint32_t numa_id() const {
+    assert(has_numa_id(), "No NUMA id");
+    return field_numa_id::decode(_flags) - 1;
+  }
 };
 
 #endif // SHARE_GC_Z_ZALLOCATIONFLAGS_HPP
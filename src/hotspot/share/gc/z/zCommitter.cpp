@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/z/zCommitter.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zPageAllocator.hpp"
+#include "gc/z/zStat.hpp"
+#include "logging/log.hpp"
+#include "utilities/align.hpp"
+
+static const ZStatCounter ZCounterCommitAhead("Memory", "Commit Ahead", ZStatUnitBytesPerSecond);
+
+constexpr double one_in_1000 = 3.290527;
+
+ZCommitter::ZCommitter(ZPageAllocator* page_allocator) :
+    _page_allocator(page_allocator),
+    _metronome(ZStatAllocRate::sample_hz) {
+  set_name("ZCommitter");
+  create_and_start();
+}
+
+size_t ZCommitter::commit_ahead_target() const {
+  // Keep enough unused memory committed to satisfy the allocations expected
+  // during the next ZCommitAheadInterval. The allocation rate is estimated
+  // the same way as in the director's allocation rate rule, i.e. with the
+  // spike tolerance factor and ~3.3 sigma added to the moving average.
+  const double max_alloc_rate = (ZStatAllocRate::avg() * ZAllocationSpikeTolerance) + (ZStatAllocRate::sd() * one_in_1000);
+  return align_up((size_t)(max_alloc_rate * ZCommitAheadInterval / MILLIUNITS), ZGranuleSize);
+}
+
+void ZCommitter::run_service() {
+  while (_metronome.wait_for_tick()) {
+    const size_t target = commit_ahead_target();
+    size_t committed = 0;
+
+    for (;;) {
+      const size_t unused = _page_allocator->unused();
+      if (unused >= target) {
+        // Enough committed ahead
+        break;
+      }
+
+      // Commit chunk
+      const size_t chunk = _page_allocator->commit_ahead(target - unused);
+      if (chunk == 0) {
+        // Reached soft max capacity, allocations are stalled, or out of memory
+        break;
+      }
+
+      committed += chunk;
+    }
+
+    if (committed > 0) {
+      // Update statistics
+      ZStatInc(ZCounterCommitAhead, committed);
+      log_debug(gc, heap)("Committed Ahead: " SIZE_FORMAT "M(%.0f%%), Target: " SIZE_FORMAT "M",
+                          committed / M, percent_of(committed, ZHeap::heap()->max_capacity()), target / M);
+    }
+  }
+}
+
+void ZCommitter::stop_service() {
+  _metronome.stop();
+}
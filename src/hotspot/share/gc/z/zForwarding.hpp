@@ -63,6 +63,7 @@ public:
   static ZForwarding* alloc(ZForwardingAllocator* allocator, ZPage* page);
 
   uint8_t type() const;
+  uint32_t numa_id() const;
   uintptr_t start() const;
   size_t size() const;
   size_t object_alignment_shift() const;
@@ -351,19 +351,85 @@ void ZMark::mark_and_follow(ZMarkContext* context, ZMarkStackEntry entry) {
   }
 }
 
+// Small FIFO of popped mark stack entries. The memory an entry refers to
+// is prefetched when the entry is inserted, and the entry is followed when
+// it leaves the queue, which gives the prefetch time to complete while the
+// entries ahead of it are processed.
+class ZMarkPrefetchQueue : public StackObj {
+private:
+  static const size_t _size = 8;
+  static const size_t _mask = _size - 1;
+
+  ZMarkStackEntry _entries[_size];
+  size_t          _head;
+  size_t          _length;
+
+  static void prefetch(ZMarkStackEntry entry) {
+    const uintptr_t addr = entry.partial_array()
+        ? ZAddress::good(entry.partial_array_offset() << ZMarkPartialArrayMinSizeShift)
+        : entry.object_address();
+    Prefetch::read((void*)addr, 0);
+  }
+
+public:
+  ZMarkPrefetchQueue() :
+      _entries(),
+      _head(0),
+      _length(0) {
+    STATIC_ASSERT(is_power_of_2(_size));
+  }
+
+  bool is_empty() const {
+    return _length == 0;
+  }
+
+  bool is_full() const {
+    return _length == _size;
+  }
+
+  void push(ZMarkStackEntry entry) {
+    assert(!is_full(), "Queue full");
+    prefetch(entry);
+    _entries[(_head + _length) & _mask] = entry;
+    _length++;
+  }
+
+  ZMarkStackEntry pop() {
+    assert(!is_empty(), "Queue empty");
+    const ZMarkStackEntry entry = _entries[_head];
+    _head = (_head + 1) & _mask;
+    _length--;
+    return entry;
+  }
+};
+
 template <typename T>
 bool ZMark::drain(ZMarkContext* context, T* timeout) {
   ZMarkStripe* const stripe = context->stripe();
   ZMarkThreadLocalStacks* const stacks = context->stacks();
+  ZMarkPrefetchQueue queue;
   ZMarkStackEntry entry;
 
   // Drain stripe stacks
-  while (stacks->pop(&_allocator, &_stripes, stripe, entry)) {
-    mark_and_follow(context, entry);
+  for (;;) {
+    if (stacks->pop(&_allocator, &_stripes, stripe, entry)) {
+      if (queue.is_full()) {
+        mark_and_follow(context, queue.pop());
+      }
+      queue.push(entry);
+    } else if (!queue.is_empty()) {
+      mark_and_follow(context, queue.pop());
+    } else {
+      // Stacks and queue empty
+      break;
+    }
 
     // Check timeout
     if (timeout->has_expired()) {
-      // Timeout
+      // Timeout, process already popped entries before returning
+      while (!queue.is_empty()) {
+        mark_and_follow(context, queue.pop());
+      }
       return false;
     }
   }
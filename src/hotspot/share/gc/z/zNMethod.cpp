@@ -278,6 +278,23 @@ void ZNMethod::nmethods_do(NMethodClosure* cl) {
   ZNMethodTable::nmethods_do(cl);
 }
 
+// Number of registered nmethods that makes it worthwhile to engage
+// another worker when walking the nmethod table.
+static const size_t ZNMethodsPerWorker = 4 * K;
+
+static void run_nmethod_table_task(ZWorkers* workers, ZTask* task) {
+  // The nmethod table is claimed in small partitions, so any number of
+  // workers can share the walk. With a large code cache the walk dominates
+  // class unloading, and we use all workers instead of only the number
+  // selected for the current cycle.
+  const size_t nworkers_needed = ZNMethodTable::registered_nmethods() / ZNMethodsPerWorker;
+  if (nworkers_needed > workers->active_workers()) {
+    workers->run_all(task);
+  } else {
+    workers->run(task);
+  }
+}
+
 class ZNMethodUnlinkClosure : public NMethodClosure {
 private:
   bool          _unloading_occurred;
@@ -378,7 +395,7 @@ void ZNMethod::unlink(ZWorkers* workers, bool unloading_occurred) {
 
     {
       ZNMethodUnlinkTask task(unloading_occurred, &verifier);
-      workers->run(&task);
+      run_nmethod_table_task(workers, &task);
       if (task.success()) {
         return;
       }
@@ -423,5 +440,5 @@ public:
 
 void ZNMethod::purge(ZWorkers* workers) {
   ZNMethodPurgeTask task;
-  workers->run(&task);
+  run_nmethod_table_task(workers, &task);
 }
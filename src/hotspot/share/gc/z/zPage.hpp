@@ -78,6 +78,9 @@ public:
   bool is_allocating() const;
   bool is_relocatable() const;
 
+  uint32_t age() const;
+  bool is_old() const;
+
   uint64_t last_used() const;
   void set_last_used();
 
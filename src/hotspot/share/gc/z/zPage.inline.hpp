@@ -26,6 +26,7 @@
 
 #include "gc/z/zPage.hpp"
 
+#include "gc/shared/gc_globals.hpp"
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zLiveMap.inline.hpp"
@@ -153,6 +154,15 @@ inline bool ZPage::is_relocatable() const {
   return _seqnum < ZGlobalSeqNum;
 }
 
+inline uint32_t ZPage::age() const {
+  // Number of GC cycles this page has survived without being relocated
+  return ZGlobalSeqNum - _seqnum;
+}
+
+inline bool ZPage::is_old() const {
+  return ZOldPageAge > 0 && age() >= ZOldPageAge;
+}
+
 inline uint64_t ZPage::last_used() const {
   return _last_used;
 }
@@ -26,9 +26,11 @@
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/z/zArray.inline.hpp"
 #include "gc/z/zCollectedHeap.hpp"
+#include "gc/z/zCommitter.hpp"
 #include "gc/z/zFuture.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zLock.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAllocator.inline.hpp"
 #include "gc/z/zPageCache.hpp"
@@ -150,6 +152,7 @@ ZPageAllocator::ZPageAllocator(ZWorkers* workers,
     _satisfied(),
     _unmapper(new ZUnmapper(this)),
     _uncommitter(new ZUncommitter(this)),
+    _committer(ZCommitAheadInterval > 0 ? new ZCommitter(this) : NULL),
     _safe_delete(),
     _initialized(false) {
 
@@ -392,14 +395,14 @@ bool ZPageAllocator::is_alloc_allowed(size_t size) const {
   return available >= size;
 }
 
-bool ZPageAllocator::alloc_page_common_inner(uint8_t type, size_t size, ZList<ZPage>* pages) {
+bool ZPageAllocator::alloc_page_common_inner(uint8_t type, size_t size, uint32_t numa_id, ZList<ZPage>* pages) {
   if (!is_alloc_allowed(size)) {
     // Out of memory
     return false;
   }
 
   // Try allocate from the page cache
-  ZPage* const page = _cache.alloc_page(type, size);
+  ZPage* const page = _cache.alloc_page(type, size, numa_id);
   if (page != NULL) {
     // Success
     pages->insert_last(page);
@@ -425,7 +428,10 @@ bool ZPageAllocator::alloc_page_common(ZPageAllocation* allocation) {
   const ZAllocationFlags flags = allocation->flags();
   ZList<ZPage>* const pages = allocation->pages();
 
-  if (!alloc_page_common_inner(type, size, pages)) {
+  // Prefer the NUMA node asked for, or else the node we are running on
+  const uint32_t numa_id = flags.has_numa_id() ? flags.numa_id() : ZNUMA::id();
+
+  if (!alloc_page_common_inner(type, size, numa_id, pages)) {
     // Out of memory
     return false;
   }
@@ -809,6 +815,84 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
   return flushed;
 }
 
+size_t ZPageAllocator::commit_ahead(size_t requested) {
+  // See uncommit() for why the suspendible thread set is joined like this.
+  // A page being committed ahead is not yet visible to pages_do().
+  SuspendibleThreadSetJoiner joiner(ZVerifyViews);
+  size_t size;
+
+  {
+    SuspendibleThreadSetJoiner joiner(!ZVerifyViews);
+    ZLocker<ZLock> locker(&_lock);
+
+    if (!_stalled.is_empty()) {
+      // Leave any capacity increase to the stalled allocations
+      return 0;
+    }
+
+    // Never commit ahead beyond the soft max capacity. We commit chunks at
+    // a time, using the same chunk size as uncommit, so that allocations
+    // can interleave with us.
+    const size_t limit = soft_max_capacity();
+    const size_t headroom = limit > _capacity ? limit - _capacity : 0;
+    const size_t chunk = MIN2(align_up(_current_max_capacity >> 7, ZGranuleSize), 256 * M);
+    size = align_down(MIN3(requested, headroom, chunk), ZGranuleSize);
+    if (size == 0 || !is_alloc_allowed(size)) {
+      // Nothing to commit
+      return 0;
+    }
+
+    // Record increased capacity as claimed until the page is cached
+    increase_capacity(size);
+    Atomic::add(&_claimed, size);
+  }
+
+  // Create, commit, map and pre-touch page
+  ZPage* page = NULL;
+  const ZVirtualMemory vmem = _virtual.alloc(size, false /* force_low_address */);
+  if (!vmem.is_null()) {
+    ZPhysicalMemory pmem;
+    _physical.alloc(pmem, size);
+    page = new ZPage(ZPageTypeLarge, vmem, pmem);
+
+    if (!commit_page(page)) {
+      // Failed or partially failed. Keep any successfully committed part.
+      ZPage* const committed_page = page->split_committed();
+      destroy_page(page);
+      page = committed_page;
+    }
+
+    if (page != NULL) {
+      map_page(page);
+      _physical.pretouch(page->start(), page->size());
+    }
+  }
+
+  const size_t committed = (page != NULL) ? page->size() : 0;
+
+  {
+    SuspendibleThreadSetJoiner joiner(!ZVerifyViews);
+    ZLocker<ZLock> locker(&_lock);
+
+    // Adjust claimed and capacity to reflect the commit
+    Atomic::sub(&_claimed, size);
+    if (committed < size) {
+      decrease_capacity(size - committed, false /* set_max_capacity */);
+    }
+
+    if (page != NULL) {
+      // Cache page
+      page->set_last_used();
+      _cache.free_page(page);
+
+      // Try satisfy stalled allocations
+      satisfy_stalled();
+    }
+  }
+
+  return committed;
+}
+
 void ZPageAllocator::enable_deferred_delete() const {
   _safe_delete.enable_deferred_delete();
 }
@@ -867,4 +951,7 @@ void ZPageAllocator::check_out_of_memory() {
 void ZPageAllocator::threads_do(ThreadClosure* tc) const {
   tc->do_thread(_unmapper);
   tc->do_thread(_uncommitter);
+  if (_committer != NULL) {
+    tc->do_thread(_committer);
+  }
 }
@@ -37,11 +37,13 @@ class ThreadClosure;
 class ZPageAllocation;
 class ZPageAllocatorStats;
 class ZWorkers;
+class ZCommitter;
 class ZUncommitter;
 class ZUnmapper;
 
 class ZPageAllocator {
   friend class VMStructs;
+  friend class ZCommitter;
   friend class ZUnmapper;
   friend class ZUncommitter;
 
@@ -64,6 +66,7 @@ private:
   ZList<ZPageAllocation>     _satisfied;
   ZUnmapper*                 _unmapper;
   ZUncommitter*              _uncommitter;
+  ZCommitter*                _committer;
   mutable ZSafeDelete<ZPage> _safe_delete;
   bool                       _initialized;
 
@@ -85,7 +88,7 @@ private:
 
   bool is_alloc_allowed(size_t size) const;
 
-  bool alloc_page_common_inner(uint8_t type, size_t size, ZList<ZPage>* pages);
+  bool alloc_page_common_inner(uint8_t type, size_t size, uint32_t numa_id, ZList<ZPage>* pages);
   bool alloc_page_common(ZPageAllocation* allocation);
   bool alloc_page_stall(ZPageAllocation* allocation);
   bool alloc_page_or_stall(ZPageAllocation* allocation);
@@ -100,6 +103,7 @@ private:
   void free_page_inner(ZPage* page, bool reclaimed);
 
   size_t uncommit(uint64_t* timeout);
+  size_t commit_ahead(size_t requested);
 
 public:
   ZPageAllocator(ZWorkers* workers,
@@ -60,11 +60,11 @@ ZPageCache::ZPageCache() :
     _large(),
     _last_commit(0) {}
 
-ZPage* ZPageCache::alloc_small_page() {
-  const uint32_t numa_id = ZNUMA::id();
+ZPage* ZPageCache::alloc_small_page(uint32_t numa_id) {
   const uint32_t numa_count = ZNUMA::count();
+  assert(numa_id < numa_count, "Invalid NUMA id");
 
-  // Try NUMA local page cache
+  // Try preferred NUMA page cache
   ZPage* const l1_page = _small.get(numa_id).remove_first();
   if (l1_page != NULL) {
     ZStatInc(ZCounterPageCacheHitL1);
@@ -151,12 +151,12 @@ ZPage* ZPageCache::alloc_oversized_page(size_t size) {
   return page;
 }
 
-ZPage* ZPageCache::alloc_page(uint8_t type, size_t size) {
+ZPage* ZPageCache::alloc_page(uint8_t type, size_t size, uint32_t numa_id) {
   ZPage* page;
 
   // Try allocate exact page
   if (type == ZPageTypeSmall) {
-    page = alloc_small_page();
+    page = alloc_small_page(numa_id);
   } else if (type == ZPageTypeMedium) {
     page = alloc_medium_page();
   } else {
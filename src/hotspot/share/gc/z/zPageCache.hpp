@@ -37,7 +37,7 @@ private:
   ZList<ZPage>            _large;
   uint64_t                _last_commit;
 
-  ZPage* alloc_small_page();
+  ZPage* alloc_small_page(uint32_t numa_id);
   ZPage* alloc_medium_page();
   ZPage* alloc_large_page(size_t size);
 
@@ -53,7 +53,7 @@ private:
 public:
   ZPageCache();
 
-  ZPage* alloc_page(uint8_t type, size_t size);
+  ZPage* alloc_page(uint8_t type, size_t size, uint32_t numa_id);
   void free_page(ZPage* page);
 
   void flush_for_allocation(size_t requested, ZList<ZPage>* to);
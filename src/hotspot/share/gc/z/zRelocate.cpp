@@ -28,6 +28,7 @@
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zForwarding.inline.hpp"
 #include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zRelocate.hpp"
 #include "gc/z/zRelocationSet.inline.hpp"
@@ -39,6 +40,9 @@
 #include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
 
+static const ZStatCounter ZCounterRelocationNUMALocal("Memory", "Relocation NUMA Local", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterRelocationNUMARemote("Memory", "Relocation NUMA Remote", ZStatUnitOpsPerSecond);
+
 ZRelocate::ZRelocate(ZWorkers* workers) :
     _workers(workers) {}
 
@@ -125,7 +129,7 @@ uintptr_t ZRelocate::forward_object(ZForwarding* forwarding, uintptr_t from_addr
   return to_addr;
 }
 
-static ZPage* alloc_page(const ZForwarding* forwarding) {
+static ZPage* alloc_page(const ZForwarding* forwarding, uint32_t numa_id) {
   if (ZStressRelocateInPlace) {
     // Simulate failure to allocate a new page. This will
     // cause the page being relocated to be relocated in-place.
@@ -135,9 +139,14 @@ static ZPage* alloc_page(const ZForwarding* forwarding) {
   ZAllocationFlags flags;
   flags.set_non_blocking();
   flags.set_worker_relocation();
+  flags.set_numa_id(numa_id);
   return ZHeap::heap()->alloc_page(forwarding->type(), forwarding->size(), flags);
 }
 
+static ZPage* alloc_page(const ZForwarding* forwarding) {
+  return alloc_page(forwarding, ZNUMA::id());
+}
+
 static void free_page(ZPage* page) {
   ZHeap::heap()->free_page(page, true /* reclaimed */);
 }
@@ -158,10 +167,27 @@ public:
   ZRelocateSmallAllocator() :
       _in_place_count(0) {}
 
+  // Small pages are relocated into a target page on the NUMA node of the
+  // page being relocated, to keep objects close to the threads using them.
+  uint32_t ntargets() const {
+    return ZNUMA::count();
+  }
+
+  uint32_t target_index(ZForwarding* forwarding) const {
+    return ZNUMA::is_enabled() ? forwarding->numa_id() : 0;
+  }
+
   ZPage* alloc_target_page(ZForwarding* forwarding, ZPage* target) {
-    ZPage* const page = alloc_page(forwarding);
+    const uint32_t numa_id = target_index(forwarding);
+    ZPage* const page = alloc_page(forwarding, numa_id);
     if (page == NULL) {
       Atomic::inc(&_in_place_count);
+    } else if (ZNUMA::is_enabled()) {
+      if (page->numa_id() == numa_id) {
+        ZStatInc(ZCounterRelocationNUMALocal);
+      } else {
+        ZStatInc(ZCounterRelocationNUMARemote);
+      }
     }
 
     return page;
@@ -214,6 +240,16 @@ public:
     }
   }
 
+  // Medium pages are not cached per NUMA node, and all workers
+  // share a single target page.
+  uint32_t ntargets() const {
+    return 1;
+  }
+
+  uint32_t target_index(ZForwarding* forwarding) const {
+    return 0;
+  }
+
   ZPage* alloc_target_page(ZForwarding* forwarding, ZPage* target) {
     ZLocker<ZConditionLock> locker(&_lock);
 
@@ -277,6 +313,17 @@ private:
   Allocator* const _allocator;
   ZForwarding*     _forwarding;
   ZPage*           _target;
+  ZPage** const    _targets;
+  uint32_t         _target_index;
+
+  void select_target(ZForwarding* forwarding) {
+    const uint32_t index = _allocator->target_index(forwarding);
+    if (index != _target_index) {
+      _targets[_target_index] = _target;
+      _target_index = index;
+      _target = _targets[index];
+    }
+  }
 
   bool relocate_object(uintptr_t from_addr) const {
     ZForwardingCursor cursor;
@@ -338,14 +385,25 @@ public:
   ZRelocateClosure(Allocator* allocator) :
       _allocator(allocator),
       _forwarding(NULL),
-      _target(NULL) {}
+      _target(NULL),
+      _targets(NEW_C_HEAP_ARRAY(ZPage*, allocator->ntargets(), mtGC)),
+      _target_index(0) {
+    for (uint32_t i = 0; i < _allocator->ntargets(); i++) {
+      _targets[i] = NULL;
+    }
+  }
 
   ~ZRelocateClosure() {
-    _allocator->free_target_page(_target);
+    _targets[_target_index] = _target;
+    for (uint32_t i = 0; i < _allocator->ntargets(); i++) {
+      _allocator->free_target_page(_targets[i]);
+    }
+    FREE_C_HEAP_ARRAY(ZPage*, _targets);
   }
 
   void do_forwarding(ZForwarding* forwarding) {
     _forwarding = forwarding;
+    select_target(forwarding);
 
     // Check if we should abort
     if (ZAbort::should_abort()) {
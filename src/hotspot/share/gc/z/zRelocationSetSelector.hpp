@@ -36,6 +36,7 @@ private:
   size_t _npages;
   size_t _total;
   size_t _live;
+  size_t _old_live;
   size_t _empty;
   size_t _relocate;
 
@@ -45,6 +46,7 @@ public:
   size_t npages() const;
   size_t total() const;
   size_t live() const;
+  size_t old_live() const;
   size_t empty() const;
   size_t relocate() const;
 };
@@ -70,6 +72,7 @@ private:
   const size_t                     _page_size;
   const size_t                     _object_size_limit;
   const size_t                     _fragmentation_limit;
+  const size_t                     _old_fragmentation_limit;
   ZArray<ZPage*>                   _live_pages;
   size_t                           _forwarding_entries;
   ZRelocationSetSelectorGroupStats _stats;
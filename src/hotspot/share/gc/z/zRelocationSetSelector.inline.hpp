@@ -41,6 +41,10 @@ inline size_t ZRelocationSetSelectorGroupStats::live() const {
   return _live;
 }
 
+inline size_t ZRelocationSetSelectorGroupStats::old_live() const {
+  return _old_live;
+}
+
 inline size_t ZRelocationSetSelectorGroupStats::empty() const {
   return _empty;
 }
@@ -66,14 +70,23 @@ inline void ZRelocationSetSelectorGroup::register_live_page(ZPage* page) {
   const size_t size = page->size();
   const size_t live = page->live_bytes();
   const size_t garbage = size - live;
+  const bool old = page->is_old();
 
-  if (garbage > _fragmentation_limit) {
+  // Old pages have survived several cycles in place, and their live
+  // objects are likely to survive the next cycle too. Copying them is
+  // mostly wasted work unless the page has become very sparse.
+  const size_t fragmentation_limit = old ? _old_fragmentation_limit : _fragmentation_limit;
+
+  if (garbage > fragmentation_limit) {
     _live_pages.append(page);
   }
 
   _stats._npages++;
   _stats._total += size;
   _stats._live += live;
+  if (old) {
+    _stats._old_live += live;
+  }
 }
 
 inline void ZRelocationSetSelectorGroup::register_empty_page(ZPage* page) {
@@ -1239,13 +1239,14 @@ void ZStatRelocation::print(const char* name,
                             const ZRelocationSetSelectorGroupStats& selector_group,
                             size_t in_place_count) {
   log_info(gc, reloc)("%s Pages: " SIZE_FORMAT " / " SIZE_FORMAT "M, Empty: " SIZE_FORMAT "M, "
-                      "Relocated: " SIZE_FORMAT "M, In-Place: " SIZE_FORMAT,
+                      "Relocated: " SIZE_FORMAT "M, In-Place: " SIZE_FORMAT ", Old Live: " SIZE_FORMAT "M",
                       name,
                       selector_group.npages(),
                       selector_group.total() / M,
                       selector_group.empty() / M,
                       selector_group.relocate() / M,
-                      in_place_count);
+                      in_place_count,
+                      selector_group.old_live() / M);
 }
 
 void ZStatRelocation::print() {
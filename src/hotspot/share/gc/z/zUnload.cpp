@@ -39,6 +39,8 @@
 
 static const ZStatSubPhase ZSubPhaseConcurrentClassesUnlink("Concurrent Classes Unlink");
 static const ZStatSubPhase ZSubPhaseConcurrentClassesPurge("Concurrent Classes Purge");
+static const ZStatSubPhase ZSubPhaseConcurrentClassesUnlinkNMethods("Concurrent Classes Unlink NMethods");
+static const ZStatSubPhase ZSubPhaseConcurrentClassesPurgeNMethods("Concurrent Classes Purge NMethods");
 
 class ZPhantomIsAliveObjectClosure : public BoolObjectClosure {
 public:
@@ -149,7 +151,12 @@ void ZUnload::unlink() {
   }
 
   Klass::clean_weak_klass_links(unloading_occurred);
-  ZNMethod::unlink(_workers, unloading_occurred);
+
+  {
+    ZStatTimer timer(ZSubPhaseConcurrentClassesUnlinkNMethods);
+    ZNMethod::unlink(_workers, unloading_occurred);
+  }
+
   DependencyContext::cleaning_end();
 }
 
@@ -161,6 +168,7 @@ void ZUnload::purge() {
   ZStatTimer timer(ZSubPhaseConcurrentClassesPurge);
 
   {
+    ZStatTimer timer(ZSubPhaseConcurrentClassesPurgeNMethods);
     SuspendibleThreadSetJoiner sts;
     ZNMethod::purge(_workers);
   }
@@ -38,6 +38,16 @@
   product(double, ZFragmentationLimit, 25.0,                                \
           "Maximum allowed heap fragmentation")                             \
                                                                             \
+  product(uint, ZOldPageAge, 0, EXPERIMENTAL,                               \
+          "Number of GC cycles a page must survive before it is treated "   \
+          "as old and held to ZOldFragmentationLimit when selecting pages " \
+          "to relocate (0 = disabled)")                                     \
+          range(0, 255)                                                     \
+                                                                            \
+  product(double, ZOldFragmentationLimit, 50.0, EXPERIMENTAL,               \
+          "Maximum allowed fragmentation of old pages")                     \
+          range(0.0, 100.0)                                                 \
+                                                                            \
   product(size_t, ZMarkStackSpaceLimit, 8*G,                                \
           "Maximum number of bytes allocated for mark stacks")              \
           range(32*M, 1024*G)                                               \
@@ -55,6 +65,12 @@
           "Uncommit memory if it has been unused for the specified "        \
           "amount of time (in seconds)")                                    \
                                                                             \
+  product(uintx, ZCommitAheadInterval, 0, EXPERIMENTAL,                     \
+          "Keep enough memory committed ahead of demand to satisfy the "    \
+          "predicted allocations of the specified amount of time (in "      \
+          "milliseconds, 0 = disabled)")                                    \
+          range(0, 1000 * 60)                                               \
+                                                                            \
   product(uint, ZStatisticsInterval, 10, DIAGNOSTIC,                        \
           "Time between statistics print outs (in seconds)")                \
           range(1, (uint)-1)                                                \
@@ -39,7 +39,7 @@
 #define CDS_ARCHIVE_MAGIC 0xf00baba2
 #define CDS_DYNAMIC_ARCHIVE_MAGIC 0xf00baba8
 #define CDS_GENERIC_HEADER_SUPPORTED_MIN_VERSION 13
-#define CURRENT_CDS_ARCHIVE_VERSION 13
+#define CURRENT_CDS_ARCHIVE_VERSION 14
 
 typedef struct CDSFileMapRegion {
   int     _crc;               // CRC checksum of this region.
@@ -79,6 +79,16 @@ static void log_edge_queue_summary(const EdgeQueue& edge_queue) {
   }
 }
 
+// The search is bounded by the cutoff, but root processing is not, so
+// report both to show where the safepoint time went.
+static void log_search_summary(const JfrTicks& roots_end, int64_t cutoff_ticks) {
+  const JfrTickspan roots_time = roots_end - GranularTimer::start_time();
+  const JfrTickspan total_time = GranularTimer::end_time() - GranularTimer::start_time();
+  log_debug(jfr, system)("Path to GC roots: roots " UINT64_FORMAT " ms, total " UINT64_FORMAT " ms%s",
+                         roots_time.milliseconds(), total_time.milliseconds(),
+                         total_time.value() >= cutoff_ticks ? " (cutoff reached)" : "");
+}
+
 void PathToGcRootsOperation::doit() {
   assert(SafepointSynchronize::is_at_safepoint(), "invariant");
   assert(_cutoff_ticks > 0, "invariant");
@@ -114,6 +124,7 @@ void PathToGcRootsOperation::doit() {
 
   GranularTimer::start(_cutoff_ticks, 1000000);
   roots.process();
+  const JfrTicks roots_end = JfrTicks::now();
   if (edge_queue.is_full() || _skip_bfs) {
     // Pathological case where roots don't fit in queue
     // Do a depth-first search, but mark roots first
@@ -124,6 +135,7 @@ void PathToGcRootsOperation::doit() {
   }
   GranularTimer::stop();
   log_edge_queue_summary(edge_queue);
+  log_search_summary(roots_end, _cutoff_ticks);
 
   // Emit old objects including their reference chains as events
   EventEmitter emitter(GranularTimer::start_time(), GranularTimer::end_time());
@@ -29,125 +29,221 @@
 #include "logging/logHandle.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/os.inline.hpp"
+#include "utilities/align.hpp"
+
+AsyncLogBuffer::AsyncLogBuffer(size_t capacity)
+  : _buf(NEW_C_HEAP_ARRAY(char, align_down(capacity, RecordAlignment), mtLogging)),
+    _capacity(align_down(capacity, RecordAlignment)),
+    _write_pos(0),
+    _read_pos(0) {
+  memset(_buf, 0, _capacity);
+}
+
+AsyncLogBuffer::~AsyncLogBuffer() {
+  FREE_C_HEAP_ARRAY(char, _buf);
+}
+
+bool AsyncLogBuffer::reserve(size_t size, uint64_t* pos) {
+  assert(is_aligned(size, RecordAlignment), "must be");
+  uint64_t cur = Atomic::load(&_write_pos);
+
+  while (true) {
+    size_t offset = cur % _capacity;
+    // Skip the rest of the array if the record doesn't fit.
+    size_t padding = (offset + size > _capacity) ? _capacity - offset : 0;
+    uint64_t next = cur + padding + size;
+
+    if (next - Atomic::load_acquire(&_read_pos) > _capacity) {
+      return false;
+    }
 
-class AsyncLogWriter::AsyncLogLocker : public StackObj {
- public:
-  AsyncLogLocker() {
-    assert(_instance != nullptr, "AsyncLogWriter::_lock is unavailable");
-    _instance->_lock.lock();
+    uint64_t witness = Atomic::cmpxchg(&_write_pos, cur, next);
+    if (witness == cur) {
+      if (padding > 0) {
+        Atomic::release_store(header_at(cur), (uint32_t)padding | PaddingBit);
+      }
+      *pos = cur + padding;
+      return true;
+    }
+    cur = witness;
   }
+}
+
+void AsyncLogBuffer::write_message(uint64_t pos, size_t size, LogFileStreamOutput* output,
+                                   const LogDecorations& decorations, const char* msg) {
+  char* record = _buf + pos % _capacity;
+  AsyncLogMessage* m = ::new (record + RecordAlignment) AsyncLogMessage(output, decorations);
+  strcpy(const_cast<char*>(m->message()), msg);
+  // Publish the record.
+  Atomic::release_store(header_at(pos), (uint32_t)size);
+}
+
+bool AsyncLogBuffer::push_back(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg) {
+  size_t size = record_size(msg);
+  uint64_t pos;
 
-  ~AsyncLogLocker() {
-    _instance->_lock.unlock();
+  if (size > _capacity || !reserve(size, &pos)) {
+    return false;
   }
-};
 
-void AsyncLogWriter::enqueue_locked(const AsyncLogMessage& msg) {
-  if (_buffer.size() >= _buffer_max_size) {
-    bool p_created;
-    uint32_t* counter = _stats.put_if_absent(msg.output(), 0, &p_created);
-    *counter = *counter + 1;
-    // drop the enqueueing message.
-    os::free(msg.message());
-    return;
+  write_message(pos, size, output, decorations, msg);
+  return true;
+}
+
+bool AsyncLogBuffer::push_back_all(LogFileStreamOutput* output, LogMessageBuffer::Iterator msg_iterator) {
+  size_t total = 0;
+  for (LogMessageBuffer::Iterator it = msg_iterator; !it.is_at_end(); it++) {
+    total += record_size(it.message());
+  }
+
+  uint64_t pos;
+  if (total == 0) {
+    return true;
+  } else if (total > _capacity || !reserve(total, &pos)) {
+    return false;
   }
 
-  _buffer.push_back(msg);
-  _data_available = true;
-  _lock.notify();
+  // The records are reserved as one block, so they are consecutive in the buffer.
+  for (; !msg_iterator.is_at_end(); msg_iterator++) {
+    size_t size = record_size(msg_iterator.message());
+    write_message(pos, size, output, msg_iterator.decorations(), msg_iterator.message());
+    pos += size;
+  }
+  return true;
 }
 
-void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
-  AsyncLogMessage m(&output, decorations, os::strdup(msg));
+const AsyncLogMessage* AsyncLogBuffer::front() {
+  while (true) {
+    uint64_t pos = _read_pos;
+    uint32_t header = Atomic::load_acquire(header_at(pos));
+
+    if (header == 0) {
+      return nullptr;
+    } else if ((header & PaddingBit) == 0) {
+      return reinterpret_cast<const AsyncLogMessage*>(_buf + pos % _capacity + RecordAlignment);
+    }
+
+    // Skip the padding at the end of the array.
+    size_t size = header & ~PaddingBit;
+    memset(_buf + pos % _capacity, 0, size);
+    Atomic::release_store(&_read_pos, pos + size);
+  }
+}
+
+void AsyncLogBuffer::pop_front() {
+  uint64_t pos = _read_pos;
+  size_t size = *header_at(pos);
+  assert(size != 0 && (size & PaddingBit) == 0, "no message to pop");
+
+  // Clear the record, so the header reads as unpublished when the space is reused.
+  memset(_buf + pos % _capacity, 0, size);
+  Atomic::release_store(&_read_pos, pos + size);
+}
 
-  { // critical area
-    AsyncLogLocker locker;
-    enqueue_locked(m);
+void AsyncLogWriter::notify() {
+  // Only the producer that sets _data_available wakes up the AsyncLog thread. The fence
+  // orders the publication of the message before the check, see AsyncLogWriter::run().
+  OrderAccess::fence();
+  if (!Atomic::load(&_data_available) && !Atomic::xchg(&_data_available, true)) {
+    _data_sem.signal();
+  }
+}
+
+void AsyncLogWriter::dropped(LogFileStreamOutput& output, uint32_t count) {
+  Atomic::add(&output._async_dropped_total, (size_t)count);
+
+  // The producer which makes the count of unreported messages non-zero pushes the
+  // output to _dropped_outputs. The AsyncLog thread resets the count to zero only
+  // after it has unlinked the output, so the output is never pushed twice.
+  if (Atomic::fetch_and_add(&output._async_dropped, count) == 0) {
+    LogFileStreamOutput* head = Atomic::load(&_dropped_outputs);
+    while (true) {
+      output._async_next_dropped = head;
+      LogFileStreamOutput* witness = Atomic::cmpxchg(&_dropped_outputs, head, &output);
+      if (witness == head) {
+        break;
+      }
+      head = witness;
+    }
+  }
+}
+
+void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
+  if (_buffer.push_back(&output, decorations, msg)) {
+    notify();
+  } else {
+    // drop the enqueueing message.
+    dropped(output, 1);
+    notify();
   }
 }
 
 // LogMessageBuffer consists of a multiple-part/multiple-line messsage.
-// The lock here guarantees its integrity.
+// The lines are added as one block to guarantee its integrity.
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, LogMessageBuffer::Iterator msg_iterator) {
-  AsyncLogLocker locker;
-
-  for (; !msg_iterator.is_at_end(); msg_iterator++) {
-    AsyncLogMessage m(&output, msg_iterator.decorations(), os::strdup(msg_iterator.message()));
-    enqueue_locked(m);
+  if (!_buffer.push_back_all(&output, msg_iterator)) {
+    // Not enough space for all of the lines, add as many as possible.
+    for (; !msg_iterator.is_at_end(); msg_iterator++) {
+      if (!_buffer.push_back(&output, msg_iterator.decorations(), msg_iterator.message())) {
+        dropped(output, 1);
+      }
+    }
   }
+  notify();
 }
 
 AsyncLogWriter::AsyncLogWriter()
-  : _flush_sem(0), _lock(), _data_available(false),
+  : _flush_sem(0), _data_sem(0), _data_available(false),
     _initialized(false),
-    _stats() {
+    _buffer(AsyncLogBufferSize),
+    _dropped_outputs(nullptr) {
   if (os::create_thread(this, os::asynclog_thread)) {
     _initialized = true;
   } else {
     log_warning(logging, thread)("AsyncLogging failed to create thread. Falling back to synchronous logging.");
   }
 
-  log_info(logging)("The maximum entries of AsyncLogBuffer: " SIZE_FORMAT ", estimated memory use: " SIZE_FORMAT " bytes",
-                    _buffer_max_size, AsyncLogBufferSize);
+  log_info(logging)("The capacity of AsyncLogBuffer: " SIZE_FORMAT " bytes", _buffer.capacity());
 }
 
-class AsyncLogMapIterator {
-  AsyncLogBuffer& _logs;
+// Writes the meta-messages of the dropped counters.
+void AsyncLogWriter::report_dropped() {
+  using none = LogTagSetMapping<LogTag::__NO_TAG>;
+  LogFileStreamOutput* output = Atomic::xchg(&_dropped_outputs, (LogFileStreamOutput*)nullptr);
 
- public:
-  AsyncLogMapIterator(AsyncLogBuffer& logs) :_logs(logs) {}
-  bool do_entry(LogFileStreamOutput* output, uint32_t& counter) {
-    using none = LogTagSetMapping<LogTag::__NO_TAG>;
+  while (output != nullptr) {
+    // Read the link before the count is reset; after that the output may be pushed again.
+    LogFileStreamOutput* next = output->_async_next_dropped;
+    uint32_t counter = Atomic::xchg(&output->_async_dropped, 0u);
 
-    if (counter > 0) {
-      LogDecorations decorations(LogLevel::Warning, none::tagset(), LogDecorators::All);
-      stringStream ss;
-      ss.print(UINT32_FORMAT_W(6) " messages dropped due to async logging", counter);
-      AsyncLogMessage msg(output, decorations, ss.as_string(true /*c_heap*/));
-      _logs.push_back(msg);
-      counter = 0;
-    }
+    LogDecorations decorations(LogLevel::Warning, none::tagset(), LogDecorators::All);
+    stringStream ss;
+    ss.print(UINT32_FORMAT_W(6) " messages dropped due to async logging", counter);
+    output->write_blocking(decorations, ss.base());
 
-    return true;
+    output = next;
   }
-};
+}
 
 void AsyncLogWriter::write() {
-  // Use kind of copy-and-swap idiom here.
-  // Empty 'logs' swaps the content with _buffer.
-  // Along with logs destruction, all processed messages are deleted.
-  //
-  // The operation 'pop_all()' is done in O(1). All I/O jobs are then performed without
-  // lock protection. This guarantees I/O jobs don't block logsites.
-  AsyncLogBuffer logs;
-
-  { // critical region
-    AsyncLogLocker locker;
-
-    _buffer.pop_all(&logs);
-    // append meta-messages of dropped counters
-    AsyncLogMapIterator dropped_counters_iter(logs);
-    _stats.iterate(&dropped_counters_iter);
-    _data_available = false;
-  }
-
-  LinkedListIterator<AsyncLogMessage> it(logs.head());
-
+  // All I/O jobs are performed without blocking the logsites. Producers
+  // can keep adding messages while the published ones are written out.
   int req = 0;
-  while (!it.is_empty()) {
-    AsyncLogMessage* e = it.next();
-    char* msg = e->message();
-
-    if (msg != nullptr) {
-      e->output()->write_blocking(e->decorations(), msg);
-      os::free(msg);
-    } else if (e->output() == nullptr) {
+  const AsyncLogMessage* e;
+
+  while ((e = _buffer.front()) != nullptr) {
+    if (e->output() != nullptr) {
+      e->output()->write_blocking(e->decorations(), e->message());
+    } else {
       // This is a flush token. Record that we found it and then
       // signal the flushing thread after the loop.
       req++;
     }
+    _buffer.pop_front();
   }
 
+  report_dropped();
+
   if (req > 0) {
     assert(req == 1, "AsyncLogWriter::flush() is NOT MT-safe!");
     _flush_sem.signal(req);
@@ -156,14 +252,9 @@ void AsyncLogWriter::write() {
 
 void AsyncLogWriter::run() {
   while (true) {
-    {
-      AsyncLogLocker locker;
-
-      while (!_data_available) {
-        _lock.wait(0/* no timeout */);
-      }
-    }
-
+    _data_sem.wait();
+    // Messages published after this point signal the semaphore again.
+    Atomic::release_store_fence(&_data_available, false);
     write();
   }
 }
@@ -199,17 +290,15 @@ AsyncLogWriter* AsyncLogWriter::instance() {
 // usecase - see the comments in the header file for more details.
 void AsyncLogWriter::flush() {
   if (_instance != nullptr) {
-    {
-      using none = LogTagSetMapping<LogTag::__NO_TAG>;
-      AsyncLogLocker locker;
-      LogDecorations d(LogLevel::Off, none::tagset(), LogDecorators::None);
-      AsyncLogMessage token(nullptr, d, nullptr);
-
-      // Push directly in-case we are at logical max capacity, as this must not get dropped.
-      _instance->_buffer.push_back(token);
-      _instance->_data_available = true;
-      _instance->_lock.notify();
+    using none = LogTagSetMapping<LogTag::__NO_TAG>;
+    LogDecorations d(LogLevel::Off, none::tagset(), LogDecorators::None);
+
+    // The token must not get dropped, so wait for the AsyncLog thread to make room for it.
+    while (!_instance->_buffer.push_back(nullptr, d, "")) {
+      _instance->notify();
+      os::naked_short_sleep(1);
     }
+    _instance->notify();
 
     _instance->_flush_sem.wait();
   }
@@ -26,97 +26,88 @@
 #include "logging/log.hpp"
 #include "logging/logDecorations.hpp"
 #include "logging/logMessageBuffer.hpp"
-#include "memory/resourceArea.hpp"
+#include "memory/allocation.hpp"
 #include "runtime/nonJavaThread.hpp"
 #include "runtime/semaphore.hpp"
-#include "utilities/resourceHash.hpp"
-#include "utilities/linkedlist.hpp"
+#include "utilities/align.hpp"
 
-template <typename E, MEMFLAGS F>
-class LinkedListDeque : private LinkedListImpl<E, ResourceObj::C_HEAP, F> {
- private:
-  LinkedListNode<E>* _tail;
-  size_t _size;
-
- public:
-  LinkedListDeque() : _tail(NULL), _size(0) {}
-  void push_back(const E& e) {
-    if (!_tail) {
-      _tail = this->add(e);
-    } else {
-      _tail = this->insert_after(e, _tail);
-    }
-
-    ++_size;
-  }
-
-  // pop all elements to logs.
-  void pop_all(LinkedList<E>* logs) {
-    logs->move(static_cast<LinkedList<E>* >(this));
-    _tail = NULL;
-    _size = 0;
-  }
-
-  void pop_all(LinkedListDeque<E, F>* logs) {
-    logs->_size = _size;
-    logs->_tail = _tail;
-    pop_all(static_cast<LinkedList<E>* >(logs));
-  }
+// Forward declaration
+class LogFileStreamOutput;
 
-  void pop_front() {
-    LinkedListNode<E>* h = this->unlink_head();
-    if (h == _tail) {
-      _tail = NULL;
-    }
+// A message in the AsyncLogBuffer. The text of the message is stored inline,
+// directly after the object.
+class AsyncLogMessage {
+  LogFileStreamOutput* const _output;
+  const LogDecorations _decorations;
 
-    if (h != NULL) {
-      --_size;
-      this->delete_node(h);
-    }
-  }
+public:
+  AsyncLogMessage(LogFileStreamOutput* output, const LogDecorations& decorations)
+    : _output(output), _decorations(decorations) {}
 
-  size_t size() const { return _size; }
+  // A message without an output is a flush token.
+  LogFileStreamOutput* output() const { return _output; }
+  const LogDecorations& decorations() const { return _decorations; }
+  const char* message() const { return reinterpret_cast<const char*>(this + 1); }
+};
 
-  const E* front() const {
-    return this->_head == NULL ? NULL : this->_head->peek();
+// A bounded multi-producer single-consumer ring buffer of AsyncLogMessages.
+//
+// The buffer is a preallocated byte array. A producer reserves space for a record by
+// advancing _write_pos with a CAS, copies the message into the reserved space and then
+// publishes the record by storing its size into the record header. Records never wrap
+// around the end of the array; if a record does not fit into the remaining space, the
+// producer also reserves the rest of the array and fills it with a padding record.
+//
+// The consumer reads the records in order and stops at the first record that has not
+// been published yet. Consumed records are cleared before _read_pos is advanced, so an
+// unpublished record header always reads as zero.
+//
+// _read_pos and _write_pos increase monotonically; the offset into the array is the
+// position modulo the capacity.
+class AsyncLogBuffer : public CHeapObj<mtLogging> {
+  static const uint32_t PaddingBit = 1u << 31;
+  // Records start at multiples of this alignment. The header takes one alignment unit.
+  static const size_t RecordAlignment = BytesPerLong;
+
+  char* const _buf;
+  const size_t _capacity;
+  volatile uint64_t _write_pos;
+  volatile uint64_t _read_pos;
+
+  static size_t record_size(const char* msg) {
+    return align_up(RecordAlignment + sizeof(AsyncLogMessage) + strlen(msg) + 1, RecordAlignment);
   }
 
-  const E* back() const {
-    return _tail == NULL ? NULL : _tail->peek();
+  volatile uint32_t* header_at(uint64_t pos) const {
+    return reinterpret_cast<volatile uint32_t*>(_buf + pos % _capacity);
   }
 
-  LinkedListNode<E>* head() const {
-    return this->_head;
-  }
-};
+  // Reserves 'size' contiguous bytes and sets 'pos' to the position of the reserved
+  // space. Returns false if there is not enough free space.
+  bool reserve(size_t size, uint64_t* pos);
+  void write_message(uint64_t pos, size_t size, LogFileStreamOutput* output,
+                     const LogDecorations& decorations, const char* msg);
 
-// Forward declaration
-class LogFileStreamOutput;
+  NONCOPYABLE(AsyncLogBuffer);
 
-class AsyncLogMessage {
-  LogFileStreamOutput* _output;
-  const LogDecorations _decorations;
-  char* _message;
+ public:
+  AsyncLogBuffer(size_t capacity);
+  ~AsyncLogBuffer();
 
-public:
-  AsyncLogMessage(LogFileStreamOutput* output, const LogDecorations& decorations, char* msg)
-    : _output(output), _decorations(decorations), _message(msg) {}
+  size_t capacity() const { return _capacity; }
 
-  // placeholder for LinkedListImpl.
-  bool equals(const AsyncLogMessage& o) const { return false; }
+  // MT-safe and lock-free. Returns false if the buffer is full and the message was not added.
+  bool push_back(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg);
+  // Adds all messages of a LogMessageBuffer as consecutive records. MT-safe and lock-free.
+  // Returns false, without adding any message, if there is not enough space for all of them.
+  bool push_back_all(LogFileStreamOutput* output, LogMessageBuffer::Iterator msg_iterator);
 
-  LogFileStreamOutput* output() const { return _output; }
-  const LogDecorations& decorations() const { return _decorations; }
-  char* message() const { return _message; }
+  // Only called by the single consumer. Returns the oldest published message, or null.
+  const AsyncLogMessage* front();
+  // Only called by the single consumer. Releases the space of the message returned by front().
+  void pop_front();
 };
 
-typedef LinkedListDeque<AsyncLogMessage, mtLogging> AsyncLogBuffer;
-typedef ResourceHashtable<LogFileStreamOutput*,
-                          uint32_t,
-                          17, /*table_size*/
-                          ResourceObj::C_HEAP,
-                          mtLogging> AsyncLogMap;
-
 //
 // ASYNC LOGGING SUPPORT
 //
@@ -132,30 +123,29 @@ typedef ResourceHashtable<LogFileStreamOutput*,
 // successfully initialized. Clients can use its return value to determine async logging is established or not.
 //
 // enqueue() is the basic operation of AsyncLogWriter. Two overloading versions of it are provided to match LogOutput::write().
-// They are both MT-safe and non-blocking. Derived classes of LogOutput can invoke the corresponding enqueue() in write() and
-// return 0. AsyncLogWriter is responsible of copying neccessary data.
+// They are both MT-safe, lock-free and non-blocking. Derived classes of LogOutput can invoke the corresponding enqueue() in
+// write() and return 0. AsyncLogWriter is responsible of copying neccessary data. If the buffer is full, the message is
+// dropped and counted against its output; the AsyncLog thread reports the number of dropped messages to that output.
 //
 // flush() ensures that all pending messages have been written out before it returns. It is not MT-safe in itself. When users
 // change the logging configuration via jcmd, LogConfiguration::configure_output() calls flush() under the protection of the
 // ConfigurationLock. In addition flush() is called during JVM termination, via LogConfiguration::finalize.
 class AsyncLogWriter : public NonJavaThread {
-  class AsyncLogLocker;
-
   static AsyncLogWriter* _instance;
   Semaphore _flush_sem;
-  // Can't use a Monitor here as we need a low-level API that can be used without Thread::current().
-  os::PlatformMonitor _lock;
-  bool _data_available;
+  // Signalled by the producer which sets _data_available. Can't use a Monitor here as we need
+  // a low-level API that can be used without Thread::current().
+  Semaphore _data_sem;
+  volatile bool _data_available;
   volatile bool _initialized;
-  AsyncLogMap _stats; // statistics for dropped messages
   AsyncLogBuffer _buffer;
-
-  // The memory use of each AsyncLogMessage (payload) consists of itself and a variable-length c-str message.
-  // A regular logging message is smaller than vwrite_buffer_size, which is defined in logtagset.cpp
-  const size_t _buffer_max_size = {AsyncLogBufferSize / (sizeof(AsyncLogMessage) + vwrite_buffer_size)};
+  // Outputs with dropped messages that have not been reported yet.
+  LogFileStreamOutput* volatile _dropped_outputs;
 
   AsyncLogWriter();
-  void enqueue_locked(const AsyncLogMessage& msg);
+  void notify();
+  void dropped(LogFileStreamOutput& output, uint32_t count);
+  void report_dropped();
   void write();
   void run() override;
   void pre_run() override {
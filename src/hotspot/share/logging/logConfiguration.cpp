@@ -553,6 +553,11 @@ void LogConfiguration::describe_current_configuration(outputStream* out) {
     if (_outputs[i]->is_reconfigured()) {
       out->print(" (reconfigured)");
     }
+    if (AsyncLogWriter::instance() != nullptr) {
+      // All outputs are LogFileStreamOutputs.
+      out->print(" (" SIZE_FORMAT " messages dropped by async logging)",
+                 static_cast<LogFileStreamOutput*>(_outputs[i])->async_dropped());
+    }
     out->cr();
   }
 }
@@ -26,6 +26,7 @@
 
 #include "logging/logDecorators.hpp"
 #include "logging/logOutput.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -41,16 +42,26 @@ static LogFileStreamInitializer log_stream_initializer;
 
 // Base class for all FileStream-based log outputs.
 class LogFileStreamOutput : public LogOutput {
+  friend class AsyncLogWriter;
  private:
   static const char* const FoldMultilinesOptionKey;
   bool                _fold_multilines;
   bool                _write_error_is_shown;
 
+  // Messages dropped by async logging. _async_dropped counts the ones that have not
+  // been reported to this output yet; _async_next_dropped links the outputs with
+  // unreported messages together, see AsyncLogWriter::dropped().
+  volatile uint32_t   _async_dropped;
+  volatile size_t     _async_dropped_total;
+  LogFileStreamOutput* volatile _async_next_dropped;
+
  protected:
   FILE*               _stream;
   size_t              _decorator_padding[LogDecorators::Count];
 
-  LogFileStreamOutput(FILE *stream) : _fold_multilines(false), _write_error_is_shown(false), _stream(stream) {
+  LogFileStreamOutput(FILE *stream) : _fold_multilines(false), _write_error_is_shown(false),
+                                      _async_dropped(0), _async_dropped_total(0),
+                                      _async_next_dropped(nullptr), _stream(stream) {
     for (size_t i = 0; i < LogDecorators::Count; i++) {
       _decorator_padding[i] = 0;
     }
@@ -67,6 +78,8 @@ class LogFileStreamOutput : public LogOutput {
   // Write API used by AsyncLogWriter
   virtual int write_blocking(const LogDecorations& decorations, const char* msg);
   virtual void describe(outputStream* out);
+  // Total number of messages dropped because the async logging buffer was full.
+  size_t async_dropped() const { return Atomic::load(&_async_dropped_total); }
 };
 
 class LogStdoutOutput : public LogFileStreamOutput {
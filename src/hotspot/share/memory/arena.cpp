@@ -26,6 +26,7 @@
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
 #include "runtime/threadCritical.hpp"
@@ -60,6 +61,11 @@ class ChunkPool {
 
   // Allocate a chunk from the pool; returns NULL if pool is empty.
   Chunk* allocate() {
+    // Racy pre-check so that a miss, which is followed by a malloc
+    // anyway, does not take the global ThreadCritical lock.
+    if (Atomic::load(&_first) == nullptr) {
+      return nullptr;
+    }
     ThreadCritical tc;
     Chunk* c = _first;
     if (_first != nullptr) {
@@ -562,6 +562,18 @@ size_t CodeHeap::heap_unallocated_capacity() const {
   return segments_to_size(_number_of_reserved_segments - _next_segment);
 }
 
+// Returns the size of the largest contiguous free space, either on the
+// freelist or at the end of the heap. Together with the total free space
+// this shows whether an allocation failure is due to fragmentation.
+size_t CodeHeap::largest_free_block() const {
+  assert_locked_or_safepoint(CodeCache_lock);
+  size_t largest = _number_of_reserved_segments - _next_segment;
+  for (FreeBlock* b = _freelist; b != NULL; b = b->link()) {
+    largest = MAX2(largest, b->length());
+  }
+  return segments_to_size(largest);
+}
+
 // Free list management
 
 FreeBlock* CodeHeap::following_block(FreeBlock *b) {
@@ -189,6 +189,7 @@ class CodeHeap : public CHeapObj<mtCode> {
 
   size_t allocated_in_freelist() const           { return _freelist_segments * CodeCacheSegmentSize; }
   int    freelist_length()       const           { return _freelist_length; } // number of elements in the freelist
+  size_t largest_free_block()    const;          // largest contiguous free space, in bytes; caller must hold CodeCache_lock
 
   // returns the first block or NULL
   virtual void* first() const                    { return next_used(first_block()); }
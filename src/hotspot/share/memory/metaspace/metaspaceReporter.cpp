@@ -342,6 +342,28 @@ void MetaspaceReporter::print_report(outputStream* out, size_t scale, int flags)
   print_scaled_words_and_percentage(out, free_in_chunks_in_use, committed_words, scale, 6);
   out->cr();
 
+  // Break down the unused space in chunks in use by space type. For the many
+  // small loaders of hidden classes and reflection this is mostly the unused
+  // remainder of their first chunk.
+  for (int space_type = (int)Metaspace::ZeroMetaspaceType;
+       space_type < (int)Metaspace::MetaspaceTypeCount; space_type++) {
+    const uintx num_loaders = cl._num_loaders_by_spacetype[space_type];
+    if (num_loaders == 0) {
+      continue;
+    }
+    const ClmsStats& stats = cl._stats_by_spacetype[space_type];
+    InUseChunkStats ucs_nc = stats._arena_stats_nonclass.totals();
+    InUseChunkStats ucs_c = stats._arena_stats_class.totals();
+    const size_t unused_words = ucs_nc._free_words + ucs_nc._waste_words +
+                                ucs_c._free_words + ucs_c._waste_words;
+    out->print("%30s: ", describe_spacetype((Metaspace::MetaspaceType)space_type));
+    print_scaled_words_and_percentage(out, unused_words, committed_words, scale, 6);
+    out->print(", ");
+    print_scaled_words(out, unused_words / num_loaders, scale);
+    out->print(" per loader");
+    out->cr();
+  }
+
   // Print waste in free chunks.
   const size_t committed_in_free_chunks = total_cm_stat.total_committed_word_size();
   out->print("                In free chunks: ");
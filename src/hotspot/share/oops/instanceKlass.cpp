@@ -27,6 +27,7 @@
 #include "cds/archiveUtils.hpp"
 #include "cds/classListWriter.hpp"
 #include "cds/metaspaceShared.hpp"
+#include "cds/precompileList.hpp"
 #include "classfile/classFileParser.hpp"
 #include "classfile/classFileStream.hpp"
 #include "classfile/classLoader.hpp"
@@ -1188,6 +1189,9 @@ void InstanceKlass::initialize_impl(TRAPS) {
   if (!HAS_PENDING_EXCEPTION) {
     set_initialization_state_and_notify(fully_initialized, CHECK);
     debug_only(vtable().verify(tty, true);)
+    if (is_shared()) {
+      PrecompileList::class_initialized(this, jt);
+    }
   }
   else {
     // Step 10 and 11
@@ -2323,7 +2327,7 @@ inline DependencyContext InstanceKlass::dependencies() {
 }
 
 int InstanceKlass::mark_dependent_nmethods(KlassDepChange& changes) {
-  return dependencies().mark_dependent_nmethods(changes);
+  return dependencies().mark_dependent_nmethods(changes, this);
 }
 
 void InstanceKlass::add_dependent_nmethod(nmethod* nm) {
@@ -1157,13 +1157,20 @@ void klassItable::initialize_itable(GrowableArray<Method*>* supers) {
                        _klass->name()->as_C_string());
     }
 
+    // The super class has already been linked, so its itable can be used
+    // to skip the selection search for methods this class does not declare.
+    InstanceKlass* super = _klass->java_super();
+    klassItable super_itable(super != NULL ? super : _klass);
+
     // Iterate through all interfaces
     for(int i = 0; i < num_interfaces; i++) {
       itableOffsetEntry* ioe = offset_entry(i);
       InstanceKlass* interf = ioe->interface_klass();
       assert(interf != NULL && ioe->offset() != 0, "bad offset entry in itable");
+      itableMethodEntry* super_entries = super != NULL ? super_itable.method_entries_for_interface(interf) : NULL;
       initialize_itable_for_interface(ioe->offset(), interf, supers,
-                       (ioe->offset() - offset_entry(0)->offset())/wordSize);
+                       (ioe->offset() - offset_entry(0)->offset())/wordSize,
+                       super_entries);
     }
   }
   // Check that the last entry is empty
@@ -1311,9 +1318,40 @@ int klassItable::method_count_for_interface(InstanceKlass* interf) {
 }
 
 
+// Returns the itable method entries for 'interf', or NULL if this itable
+// has none, e.g. because it has not been initialized.
+itableMethodEntry* klassItable::method_entries_for_interface(InstanceKlass* interf) {
+  for (int i = 0; i < size_offset_table() - 1; i++) {
+    itableOffsetEntry* ioe = offset_entry(i);
+    if (ioe->interface_klass() == interf) {
+      return ioe->first_method_entry(_klass);
+    }
+  }
+  return NULL;
+}
+
+// The method selected by the super class can be reused if it was found in
+// the class hierarchy (not among the default methods) and this class does
+// not declare a method that would be selected instead.
+static Method* inherited_itable_target(InstanceKlass* klass, Method* super_target, Method* m) {
+  if (super_target == NULL ||
+      super_target->method_holder()->is_interface() ||
+      super_target == Universe::throw_illegal_access_error()) {
+    return NULL;
+  }
+  if (klass->find_local_method(m->name(), m->signature(),
+                               Klass::OverpassLookupMode::find,
+                               Klass::StaticLookupMode::skip,
+                               Klass::PrivateLookupMode::skip) != NULL) {
+    return NULL;
+  }
+  return super_target;
+}
+
 void klassItable::initialize_itable_for_interface(int method_table_offset, InstanceKlass* interf,
                                                   GrowableArray<Method*>* supers,
-                                                  int start_offset) {
+                                                  int start_offset,
+                                                  itableMethodEntry* super_entries) {
   assert(interf->is_interface(), "must be");
   Array<Method*>* methods = interf->methods();
   int nof_methods = methods->length();
@@ -1323,14 +1361,23 @@ void klassItable::initialize_itable_for_interface(int method_table_offset, Insta
     Method* m = methods->at(i);
     Method* target = NULL;
     if (m->has_itable_index()) {
-      // This search must match the runtime resolution, i.e. selection search for invokeinterface
-      // to correctly enforce loader constraints for interface method inheritance.
-      // Private methods are skipped as a private class method can never be the implementation
-      // of an interface method.
-      // Invokespecial does not perform selection based on the receiver, so it does not use
-      // the cached itable.
-      target = LinkResolver::lookup_instance_method_in_klasses(_klass, m->name(), m->signature(),
-                                                               Klass::PrivateLookupMode::skip);
+      if (super_entries != NULL) {
+        target = inherited_itable_target(_klass, super_entries[m->itable_index()].method(), m);
+        assert(target == NULL ||
+               target == LinkResolver::lookup_instance_method_in_klasses(_klass, m->name(), m->signature(),
+                                                                          Klass::PrivateLookupMode::skip),
+               "inherited itable entry must match selection");
+      }
+      if (target == NULL) {
+        // This search must match the runtime resolution, i.e. selection search for invokeinterface
+        // to correctly enforce loader constraints for interface method inheritance.
+        // Private methods are skipped as a private class method can never be the implementation
+        // of an interface method.
+        // Invokespecial does not perform selection based on the receiver, so it does not use
+        // the cached itable.
+        target = LinkResolver::lookup_instance_method_in_klasses(_klass, m->name(), m->signature(),
+                                                                 Klass::PrivateLookupMode::skip);
+      }
     }
     if (target == NULL || !target->is_public() || target->is_abstract() || target->is_overpass()) {
       assert(target == NULL || !target->is_overpass() || target->is_public(),
@@ -283,7 +283,9 @@ class klassItable {
   int                  _size_method_table; // size of methodtable (in itableMethodEntry entries)
 
   void initialize_itable_for_interface(int method_table_offset, InstanceKlass* interf_h,
-                                       GrowableArray<Method*>* supers, int start_offset);
+                                       GrowableArray<Method*>* supers, int start_offset,
+                                       itableMethodEntry* super_entries);
+  itableMethodEntry* method_entries_for_interface(InstanceKlass* interf);
   void check_constraints(GrowableArray<Method*>* supers, TRAPS);
  public:
   klassItable(InstanceKlass* klass);
@@ -22,6 +22,7 @@
  *
  */
 #include "precompiled.hpp"
+#include "cds/archivedMethodProfiles.hpp"
 #include "compiler/compiler_globals.hpp"
 #include "oops/method.hpp"
 #include "oops/methodCounters.hpp"
@@ -38,6 +39,10 @@ MethodCounters::MethodCounters(const methodHandle& mh) :
   JVMTI_ONLY(clear_number_of_breakpoints());
   invocation_counter()->init();
   backedge_counter()->init();
+  if (mh->is_shared()) {
+    // Start out where the training run of the dynamic archive left off.
+    ArchivedMethodProfiles::initialize_counters(mh(), this);
+  }
 
   if (StressCodeAging) {
     set_nmethod_age(HotMethodDetectionLimit);
@@ -157,6 +157,7 @@ bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
   int default_max_inline_size = C->max_inline_size();
   int inline_small_code_size  = InlineSmallCode / 4;
   int max_inline_size         = default_max_inline_size;
+  bool is_hot                 = false;
 
   int call_site_count  = caller_method->scale_count(profile.count());
   int invoke_count     = caller_method->interpreter_invocation_count();
@@ -170,6 +171,7 @@ bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
       is_init_with_ea(callee_method, caller_method, C)) {
 
     max_inline_size = C->freq_inline_size();
+    is_hot = true;
     if (size <= max_inline_size && TraceFrequencyInlining) {
       CompileTask::print_inline_indent(inline_level());
       tty->print_cr("Inlined frequent method (freq=%lf):", freq);
@@ -184,10 +186,17 @@ bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
       set_msg("already compiled into a medium method");
       return false;
     }
+    // Warm sites get a share of the extra room hot sites get, in
+    // proportion to how close they are to InlineFrequencyRatio.
+    if (InlineFrequencyScaledSize && freq > 0 && C->freq_inline_size() > default_max_inline_size) {
+      max_inline_size += (int)((C->freq_inline_size() - default_max_inline_size) * (freq / InlineFrequencyRatio));
+    }
   }
   if (size > max_inline_size) {
-    if (max_inline_size > default_max_inline_size) {
+    if (is_hot) {
       set_msg("hot method too big");
+    } else if (max_inline_size > default_max_inline_size) {
+      set_msg("warm method too big");
     } else {
       set_msg("too big");
     }
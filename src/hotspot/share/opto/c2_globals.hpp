@@ -394,6 +394,10 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(bool, UsePolymorphicInlining, false, EXPERIMENTAL,                \
+          "Profiling based inlining for more than two receivers, up to "    \
+          "TypeProfileWidth, with a virtual call for the remaining ones")   \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
@@ -662,6 +666,10 @@
           "The maximum bytecode size of a frequent method to be inlined")   \
           range(0, max_jint)                                                \
                                                                             \
+  product(bool, InlineFrequencyScaledSize, false, EXPERIMENTAL,             \
+          "Scale the bytecode size limit of warm call sites between "       \
+          "MaxInlineSize and FreqInlineSize by call site frequency")        \
+                                                                            \
   product(intx, MaxTrivialSize, 6,                                          \
           "The maximum bytecode size of a trivial method to be inlined by " \
           "high tier compiler")                                             \
@@ -41,6 +41,7 @@
 #include "opto/movenode.hpp"
 #include "opto/opcodes.hpp"
 #include "opto/rootnode.hpp"
+#include "runtime/threadCritical.hpp"
 #include "utilities/align.hpp"
 
 #ifndef PRODUCT
@@ -681,12 +682,73 @@ void PhaseChaitin::Register_Allocate() {
     }
   }
 
+  count_spill_copies();
+
   // Done!
   _live = NULL;
   _ifg = NULL;
   C->set_indexSet_arena(NULL);  // ResourceArea is at end of scope
 }
 
+void PhaseChaitin::count_spill_copies() {
+  CompileLog* log = C->log();
+  if (log == NULL NOT_PRODUCT(&& !PrintOptoStatistics)) {
+    return;
+  }
+
+  int loads = 0, stores = 0, memoves = 0, copies = 0;
+  double load_cost = 0, store_cost = 0, memove_cost = 0, copy_cost = 0;
+  for (uint i = 0; i < _cfg.number_of_blocks(); i++) {
+    Block* block = _cfg.get_block(i);
+    for (uint j = 0; j < block->number_of_nodes(); j++) {
+      Node* n = block->get_node(j);
+      if (!n->is_MachSpillCopy()) {
+        continue;
+      }
+      OptoReg::Name src = get_reg_first(n->in(1));
+      OptoReg::Name dst = get_reg_first(n);
+      if (src == dst || !OptoReg::is_valid(src) || !OptoReg::is_valid(dst)) {
+        continue;  // Will not emit any code
+      }
+      if (OptoReg::is_stack(src)) {
+        if (OptoReg::is_stack(dst)) {
+          memoves++;
+          memove_cost += block->_freq;
+        } else {
+          loads++;
+          load_cost += block->_freq;
+        }
+      } else if (OptoReg::is_stack(dst)) {
+        stores++;
+        store_cost += block->_freq;
+      } else {
+        copies++;
+        copy_cost += block->_freq;
+      }
+    }
+  }
+
+#ifndef PRODUCT
+  if (PrintOptoStatistics) {
+    // Compiler threads update the totals concurrently
+    ThreadCritical tc;
+    _final_loads   += loads;
+    _final_stores  += stores;
+    _final_memoves += memoves;
+    _final_copies  += copies;
+    _final_load_cost   += load_cost;
+    _final_store_cost  += store_cost;
+    _final_memove_cost += memove_cost;
+    _final_copy_cost   += copy_cost;
+  }
+#endif
+
+  if (log != NULL) {
+    log->elem("regalloc_spills loads='%d' stores='%d' memoves='%d' copies='%d'",
+              loads, stores, memoves, copies);
+  }
+}
+
 void PhaseChaitin::de_ssa() {
   // Set initial Names for all Nodes.  Most Nodes get the virtual register
   // number.  A few get the ZERO live range number.  These do not
@@ -768,6 +768,9 @@ private:
   // Merge nodes that are a part of a multidef lrg and produce the same value within a block.
   void merge_multidefs();
 
+  // Count the spill copies that remain after allocation.
+  void count_spill_copies();
+
 private:
 
   static int _final_loads, _final_stores, _final_copies, _final_memoves;
@@ -4763,7 +4763,7 @@ void Compile::sort_macro_nodes() {
 void Compile::print_method(CompilerPhaseType cpt, const char *name, int level) {
   EventCompilerPhase event;
   if (event.should_commit()) {
-    CompilerEvent::PhaseEvent::post(event, C->_latest_stage_start_counter, cpt, C->_compile_id, level);
+    CompilerEvent::PhaseEvent::post(event, C->_latest_stage_start_counter, cpt, C->_compile_id, level, C->live_nodes());
   }
 #ifndef PRODUCT
   if (should_print(level)) {
@@ -4800,7 +4800,7 @@ void Compile::print_method(CompilerPhaseType cpt, Node* n, int level) {
 void Compile::end_method(int level) {
   EventCompilerPhase event;
   if (event.should_commit()) {
-    CompilerEvent::PhaseEvent::post(event, C->_latest_stage_start_counter, PHASE_END, C->_compile_id, level);
+    CompilerEvent::PhaseEvent::post(event, C->_latest_stage_start_counter, PHASE_END, C->_compile_id, level, C->live_nodes());
   }
 
 #ifndef PRODUCT
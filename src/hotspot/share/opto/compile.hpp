@@ -908,6 +908,8 @@ class Compile : public Phase {
   CallGenerator*    call_generator(ciMethod* call_method, int vtable_index, bool call_does_dispatch,
                                    JVMState* jvms, bool allow_inline, float profile_factor, ciKlass* speculative_receiver_type = NULL,
                                    bool allow_intrinsics = true);
+  CallGenerator*    polymorphic_call_generator(ciMethod* callee, int vtable_index, JVMState* jvms,
+                                               ciCallProfile& profile, float profile_factor);
   bool should_delay_inlining(ciMethod* call_method, JVMState* jvms) {
     return should_delay_string_inlining(call_method, jvms) ||
            should_delay_boxing_inlining(call_method, jvms) ||
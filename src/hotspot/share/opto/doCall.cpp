@@ -289,6 +289,10 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           }
         }
       }
+      if (UsePolymorphicInlining && speculative_receiver_type == NULL && profile.has_receiver(2)) {
+        CallGenerator* cg = polymorphic_call_generator(callee, vtable_index, jvms, profile, prof_factor);
+        if (cg != NULL)  return cg;
+      }
     }
 
     // If there is only one implementor of this interface then we
@@ -372,6 +376,49 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
   }
 }
 
+// Guard the inlinable receivers recorded at a megamorphic call site with a
+// chain of type checks, most frequent receiver first, and use a virtual
+// call for all other receivers.
+CallGenerator* Compile::polymorphic_call_generator(ciMethod* callee, int vtable_index, JVMState* jvms,
+                                                   ciCallProfile& profile, float prof_factor) {
+  ciMethod* caller = jvms->method();
+  int site_count = profile.count();
+  int receivers = 0;
+  while (profile.has_receiver(receivers)) {
+    receivers++;
+  }
+
+  CallGenerator* cg = (IncrementalInlineVirtual ? CallGenerator::for_late_inline_virtual(callee, vtable_index, prof_factor)
+                                                : CallGenerator::for_virtual_call(callee, vtable_index));
+  int guarded = 0;
+  // The chain is built inside out, so start with the least frequent receiver.
+  for (int i = receivers - 1; i >= 0 && cg != NULL; i--) {
+    ciKlass* k = profile.receiver(i);
+    ciMethod* receiver_method = callee->resolve_invoke(caller->holder(), k);
+    if (receiver_method == NULL) {
+      continue;
+    }
+    CallGenerator* hit_cg = call_generator(receiver_method, vtable_index, false /* call_does_dispatch */,
+                                           jvms, true /* allow_inline */, prof_factor);
+    if (hit_cg == NULL || !hit_cg->is_inline()) {
+      // A guarded call is no better than the virtual call.
+      continue;
+    }
+    // Probability of this receiver given that the checks for the more
+    // frequent receivers have failed.
+    int checked_count = 0;
+    for (int j = 0; j < i; j++) {
+      checked_count += profile.receiver_count(j);
+    }
+    float hit_prob = (float)profile.receiver_count(i) / (float)MAX2(site_count - checked_count, 1);
+    hit_prob = MIN2(MAX2(hit_prob, PROB_MIN), PROB_MAX);
+    trace_type_profile(C, caller, jvms->depth() - 1, jvms->bci(), receiver_method, k, site_count, profile.receiver_count(i));
+    cg = CallGenerator::for_predicted_call(k, cg, hit_cg, hit_prob);
+    guarded++;
+  }
+  return guarded > 0 ? cg : NULL;
+}
+
 // Return true for methods that shouldn't be inlined early so that
 // they are easier to analyze and optimize as intrinsics.
 bool Compile::should_delay_string_inlining(ciMethod* call_method, JVMState* jvms) {
@@ -165,6 +165,12 @@ JVMState* LibraryIntrinsic::generate(JVMState* jvms) {
     }
   }
   C->gather_intrinsic_statistics(intrinsic_id(), is_virtual(), Compile::_intrinsic_failed);
+  if (C->log()) {
+    C->log()->elem("intrinsic_failed id='%s'%s bci='%d'",
+                   vmIntrinsics::name_at(intrinsic_id()),
+                   (is_virtual() ? " virtual='1'" : ""),
+                   bci);
+  }
   C->print_inlining_update(this);
 
   return NULL;
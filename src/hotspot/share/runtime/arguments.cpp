@@ -3127,6 +3127,10 @@ jint Arguments::finalize_vm_init_args(bool patch_mod_javabase) {
     set_mode_flags(_int);
   }
 
+  if (AutoCreateSharedArchive && !init_auto_create_shared_archive()) {
+    return JNI_ERR;
+  }
+
   // RecordDynamicDumpInfo is not compatible with ArchiveClassesAtExit
   if (ArchiveClassesAtExit != NULL && RecordDynamicDumpInfo) {
     jio_fprintf(defaultStream::output_stream(),
@@ -3507,6 +3511,50 @@ void Arguments::extract_shared_archive_paths(const char* archive_path,
   *top_archive_path = cur_path;
 }
 
+// -XX:+AutoCreateSharedArchive -XX:SharedArchiveFile=top.jsa behaves like
+// -XX:SharedArchiveFile=top.jsa when top.jsa is a usable dynamic archive, and
+// like -XX:ArchiveClassesAtExit=top.jsa on top of the default archive otherwise.
+bool Arguments::init_auto_create_shared_archive() {
+  assert(AutoCreateSharedArchive, "sanity");
+  if (SharedArchiveFile == NULL) {
+    log_warning(cds)("-XX:+AutoCreateSharedArchive is ignored without -XX:SharedArchiveFile");
+    FLAG_SET_DEFAULT(AutoCreateSharedArchive, false);
+    return true;
+  }
+  if (ArchiveClassesAtExit != NULL || RecordDynamicDumpInfo) {
+    jio_fprintf(defaultStream::output_stream(),
+                "-XX:+AutoCreateSharedArchive cannot be used with -XX:ArchiveClassesAtExit "
+                "or -XX:+RecordDynamicDumpInfo.\n");
+    return false;
+  }
+  if (DumpSharedSpaces || !UseSharedSpaces || num_archives(SharedArchiveFile) != 1) {
+    log_warning(cds)("-XX:+AutoCreateSharedArchive is ignored");
+    FLAG_SET_DEFAULT(AutoCreateSharedArchive, false);
+    return true;
+  }
+
+  struct stat st;
+  char* base_archive_path = NULL;
+  if (os::stat(SharedArchiveFile, &st) == 0 &&
+      FileMapInfo::get_base_archive_name_from_header(SharedArchiveFile, &base_archive_path)) {
+    if (base_archive_path == NULL) {
+      log_warning(cds)("-XX:+AutoCreateSharedArchive is ignored: %s is a static archive", SharedArchiveFile);
+      FLAG_SET_DEFAULT(AutoCreateSharedArchive, false);
+    } else {
+      // Use the existing dynamic archive. If it fails validation against the
+      // base archive while being mapped, it is recreated at exit instead (see
+      // MetaspaceShared::initialize_runtime_shared_and_meta_spaces()).
+      os::free(base_archive_path);
+    }
+    return true;
+  }
+
+  log_info(cds)("Dynamic archive %s will be created at exit", SharedArchiveFile);
+  FLAG_SET_ERGO(ArchiveClassesAtExit, SharedArchiveFile);
+  FLAG_SET_ERGO(SharedArchiveFile, (ccstr)NULL);
+  return true;
+}
+
 void Arguments::init_shared_archive_paths() {
   if (ArchiveClassesAtExit != nullptr) {
     assert(!RecordDynamicDumpInfo, "already checked");
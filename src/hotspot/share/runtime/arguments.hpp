@@ -619,6 +619,7 @@ class Arguments : AllStatic {
 
   static char* get_default_shared_archive_path() NOT_CDS_RETURN_(NULL);
   static void  init_shared_archive_paths() NOT_CDS_RETURN;
+  static bool  init_auto_create_shared_archive() NOT_CDS_RETURN_(true);
 
   // Operation modi
   static Mode mode()                { return _mode;           }
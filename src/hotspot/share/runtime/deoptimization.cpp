@@ -38,6 +38,8 @@
 #include "interpreter/bytecode.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/oopMapCache.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
@@ -85,7 +87,6 @@
 #include "utilities/preserveException.hpp"
 #include "utilities/xmlstream.hpp"
 #if INCLUDE_JFR
-#include "jfr/jfrEvents.hpp"
 #include "jfr/metadata/jfrSerializer.hpp"
 #endif
 
@@ -903,14 +904,19 @@ class DeoptimizeMarkedClosure : public HandshakeClosure {
 void Deoptimization::deoptimize_all_marked(nmethod* nmethod_only) {
   ResourceMark rm;
   DeoptimizationMarker dm;
+  EventDeoptimizeMarked event;
+  jlong start_time_ns = os::javaTimeNanos();
 
   // Make the dependent methods not entrant
+  int made_not_entrant = 0;
   if (nmethod_only != NULL) {
     nmethod_only->mark_for_deoptimization();
-    nmethod_only->make_not_entrant();
+    if (nmethod_only->make_not_entrant()) {
+      made_not_entrant++;
+    }
   } else {
     MutexLocker mu(SafepointSynchronize::is_at_safepoint() ? NULL : CodeCache_lock, Mutex::_no_safepoint_check_flag);
-    CodeCache::make_marked_nmethods_not_entrant();
+    made_not_entrant = CodeCache::make_marked_nmethods_not_entrant();
   }
 
   DeoptimizeMarkedClosure deopt;
@@ -919,6 +925,13 @@ void Deoptimization::deoptimize_all_marked(nmethod* nmethod_only) {
   } else {
     Handshake::execute(&deopt);
   }
+
+  log_debug(codecache)("Deoptimized marked nmethods: " INT32_FORMAT " made not entrant, " JLONG_FORMAT " ns",
+                       made_not_entrant, os::javaTimeNanos() - start_time_ns);
+  if (event.should_commit()) {
+    event.set_nmethodCount(made_not_entrant);
+    event.commit();
+  }
 }
 
 Deoptimization::DeoptAction Deoptimization::_unloaded_action
@@ -30,6 +30,7 @@
 #include "runtime/os.hpp"
 #include "runtime/safepointMechanism.hpp"
 #include "runtime/task.hpp"
+#include "services/heapDumperCompression.hpp"
 #include "utilities/powerOfTwo.hpp"
 
 JVMFlag::Error ObjectAlignmentInBytesConstraintFunc(intx value, bool verbose) {
@@ -105,3 +106,14 @@ JVMFlag::Error NUMAInterleaveGranularityConstraintFunc(size_t value, bool verbos
 
   return JVMFlag::SUCCESS;
 }
+
+JVMFlag::Error HeapDumpCompressorConstraintFunc(ccstr value, bool verbose) {
+  if (value == NULL || !HeapDumpCompressors::is_supported(value)) {
+    JVMFlag::printError(verbose,
+                        "HeapDumpCompressor (%s) must be one of gzip, zstd or lz4\n",
+                        value == NULL ? "" : value);
+    return JVMFlag::VIOLATES_CONSTRAINT;
+  }
+
+  return JVMFlag::SUCCESS;
+}
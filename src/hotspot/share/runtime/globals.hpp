@@ -511,6 +511,12 @@ const intx ObjectAlignmentInBytes = 8;
           "error log in case of a crash.")                                  \
           range(0, (uint64_t)max_jlong/1000)                                \
                                                                             \
+  product(uint64_t, ErrorLogStepTimeout, 0,                                 \
+          "Timeout, in seconds, after which a single step of writing an "   \
+          "error log is abandoned and reporting continues with the next "   \
+          "step. 0 means a quarter of ErrorLogTimeout.")                    \
+          range(0, (uint64_t)max_jlong/1000)                                \
+                                                                            \
   product(bool, SuppressFatalErrorMessage, false,                           \
           "Report NO fatal error message (avoid deadlock)")                 \
                                                                             \
@@ -543,6 +549,12 @@ const intx ObjectAlignmentInBytes = 8;
           "compression. Otherwise the level must be between 1 and 9.")      \
           range(0, 9)                                                       \
                                                                             \
+  product(ccstr, HeapDumpCompressor, "gzip", MANAGEABLE,                    \
+          "The compression format used when HeapDumpGzipLevel is not 0: "   \
+          "gzip, zstd or lz4. zstd and lz4 need the corresponding "         \
+          "library to be installed on the system.")                         \
+          constraint(HeapDumpCompressorConstraintFunc, AtParse)             \
+                                                                            \
   product(ccstr, NativeMemoryTracking, "off",                               \
           "Native memory tracking options")                                 \
                                                                             \
@@ -705,6 +717,18 @@ const intx ObjectAlignmentInBytes = 8;
           "at one time (minimum is 1024).")                      \
           range(1024, max_jint)                                             \
                                                                             \
+  product(uint, MonitorDeflationThreads, 1, EXPERIMENTAL,                   \
+          "Number of threads that deflate idle monitors in parallel. "      \
+          "Each thread owns a separate in-use monitor list, and "           \
+          "inflating threads are spread over the lists. The "               \
+          "serviceability agent only sees the monitors of the first list.") \
+          range(1, 16)                                                      \
+                                                                            \
+  product(bool, MonitorSpinAIMD, false, EXPERIMENTAL,                       \
+          "Adapt the spin duration of each contended monitor with an "      \
+          "additive increase scaled by how much of the spin a successful "  \
+          "attempt needed, and a multiplicative decrease on failure")       \
+                                                                            \
   product(intx, MonitorUsedDeflationThreshold, 90, DIAGNOSTIC,              \
           "Percentage of used monitors before triggering deflation (0 is "  \
           "off). The check is performed on GuaranteedSafepointInterval "    \
@@ -749,6 +773,13 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, UseFastJNIAccessors, true,                                  \
           "Use optimized versions of Get<Primitive>Field")                  \
                                                                             \
+  product(uintx, JNIHandleAllocationCacheSize, 0, EXPERIMENTAL,             \
+          "Number of free JNI global and weak global handle entries "       \
+          "each thread keeps for reuse, to avoid contention on the "        \
+          "handle storage. 0 disables the cache. Not used with "            \
+          "-Xcheck:jni")                                                    \
+          range(0, 32)                                                      \
+                                                                            \
   product(intx, MaxJNILocalCapacity, 65536,                                 \
           "Maximum allowable local JNI handle capacity to "                 \
           "EnsureLocalCapacity() and PushLocalFrame(), "                    \
@@ -1924,6 +1955,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(uint64_t, StringDeduplicationHashSeed, 0, DIAGNOSTIC,             \
           "Seed for the table hashing function; 0 requests computed seed")  \
                                                                             \
+  product(bool, StringDeduplicationUseStringHash, false, EXPERIMENTAL,      \
+          "Use the cached String.hashCode() value for the table instead "   \
+          "of computing a seeded hash of the value array. Cheaper, but "    \
+          "not resistant to hash flooding")                                 \
+                                                                            \
   product(bool, WhiteBoxAPI, false, DIAGNOSTIC,                             \
           "Enable internal testing APIs")                                   \
                                                                             \
@@ -1940,9 +1976,33 @@ const intx ObjectAlignmentInBytes = 8;
   product(ccstr, ArchiveClassesAtExit, NULL,                                \
           "The path and name of the dynamic archive file")                  \
                                                                             \
+  product(bool, AutoCreateSharedArchive, false,                             \
+          "Create the dynamic archive named by SharedArchiveFile at exit "  \
+          "if it does not exist or cannot be used")                         \
+                                                                            \
   product(ccstr, ExtraSharedClassListFile, NULL,                            \
           "Extra classlist for building the CDS archive file")              \
                                                                             \
+  product(uint, ArchivedClassPreloadThreads, 0,                             \
+          "Number of threads that load and link the boot classes of the "   \
+          "CDS archive in the background during startup. 0 disables "       \
+          "preloading")                                                     \
+          range(0, 256)                                                     \
+                                                                            \
+  product(bool, ArchiveMethodProfiles, false, EXPERIMENTAL,                 \
+          "Store the invocation and backedge counts of the methods in the " \
+          "dynamic CDS archive, and use them to seed the counters of the "  \
+          "archived methods at runtime")                                    \
+                                                                            \
+  product(ccstr, ArchiveCompiledMethodsAtExit, NULL, EXPERIMENTAL,          \
+          "The path and name of the file listing the archived methods "     \
+          "that are compiled when the application exits")                   \
+                                                                            \
+  product(ccstr, SharedCompiledMethodsFile, NULL, EXPERIMENTAL,             \
+          "Compile the methods listed in this file, written by "            \
+          "ArchiveCompiledMethodsAtExit, as soon as their classes are "     \
+          "initialized")                                                    \
+                                                                            \
   product(intx, ArchiveRelocationMode, 0, DIAGNOSTIC,                       \
            "(0) first map at preferred address, and if "                    \
            "unsuccessful, map at alternative address (default); "           \
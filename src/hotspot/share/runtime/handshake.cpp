@@ -103,6 +103,10 @@ class HandshakeSpinYield : public StackObj {
   jlong _last_spin_start_ns;
   jlong _spin_time_ns;
 
+  // Timing breakdown for logging.
+  jlong _wait_time_ns;
+  int   _passes;
+
   int _result_count[2][HandshakeState::_number_states];
   int _prev_result_pos;
 
@@ -142,7 +146,8 @@ class HandshakeSpinYield : public StackObj {
  public:
   HandshakeSpinYield(jlong start_time) :
     _start_time_ns(start_time), _last_spin_start_ns(start_time),
-    _spin_time_ns(0), _result_count(), _prev_result_pos(0) {
+    _spin_time_ns(0), _wait_time_ns(0), _passes(0),
+    _result_count(), _prev_result_pos(0) {
 
     const jlong max_spin_time_ns = 100 /* us */ * (NANOUNITS / MICROUNITS);
     int free_cpus = os::active_processor_count() - 1;
@@ -156,6 +161,7 @@ class HandshakeSpinYield : public StackObj {
 
   void process() {
     jlong now = os::javaTimeNanos();
+    _passes++;
     if (state_changed()) {
       reset_state();
       // We spin for x amount of time since last state change.
@@ -172,9 +178,15 @@ class HandshakeSpinYield : public StackObj {
         wait_raw(now);
       }
       _last_spin_start_ns = os::javaTimeNanos();
+      _wait_time_ns += _last_spin_start_ns - now;
     }
     reset_state();
   }
+
+  // Nanoseconds spent sleeping while waiting for the handshakees.
+  jlong wait_time_ns() const { return _wait_time_ns; }
+  // Number of passes over the handshakees.
+  int passes() const         { return _passes; }
 };
 
 static void handle_timeout(HandshakeOperation* op, JavaThread* target) {
@@ -228,6 +240,14 @@ static void log_handshake_info(jlong start_time_ns, const char* name, int target
   }
 }
 
+static void log_handshake_breakdown(jlong start_time_ns, const char* name, const HandshakeSpinYield& hsy) {
+  if (log_is_enabled(Debug, handshake)) {
+    jlong completion_time = os::javaTimeNanos() - start_time_ns;
+    log_debug(handshake)("Handshake \"%s\", Passes: %d, Waiting: " JLONG_FORMAT " ns, Processing and polling: " JLONG_FORMAT " ns",
+                         name, hsy.passes(), hsy.wait_time_ns(), completion_time - hsy.wait_time_ns());
+  }
+}
+
 class VM_HandshakeAllThreads: public VM_Operation {
   HandshakeOperation* const _op;
  public:
@@ -283,6 +303,7 @@ class VM_HandshakeAllThreads: public VM_Operation {
     // by the Handshakee.
     OrderAccess::acquire();
 
+    log_handshake_breakdown(start_time_ns, _op->name(), hsy);
     log_handshake_info(start_time_ns, _op->name(), number_of_threads_issued, emitted_handshakes_executed);
   }
 
@@ -399,6 +420,7 @@ void Handshake::execute(HandshakeClosure* hs_cl, ThreadsListHandle* tlh, JavaThr
   // by the Handshakee.
   OrderAccess::acquire();
 
+  log_handshake_breakdown(start_time_ns, op.name(), hsy);
   log_handshake_info(start_time_ns, op.name(), 1, emitted_handshakes_executed);
 }
 
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "cds/dynamicArchive.hpp"
+#include "cds/precompileList.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/stringTable.hpp"
@@ -503,6 +504,9 @@ void before_exit(JavaThread* thread) {
   os::terminate_signal_thread();
 
 #if INCLUDE_CDS
+  if (ArchiveCompiledMethodsAtExit != NULL) {
+    PrecompileList::dump_at_exit();
+  }
   if (DynamicArchive::should_dump_at_vm_exit()) {
     assert(ArchiveClassesAtExit != NULL, "Must be already set");
     ExceptionMark em(thread);
@@ -35,6 +35,7 @@
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/thread.inline.hpp"
+#include "runtime/threadSMR.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 
@@ -81,6 +82,88 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+oop* JNIHandleAllocationCache::Entries::allocate(OopStorage* storage, size_t cache_size) {
+  if (_count == 0) {
+    _count = storage->allocate(_entries, cache_size);
+    if (_count == 0) {
+      return NULL;
+    }
+  }
+  return _entries[--_count];
+}
+
+bool JNIHandleAllocationCache::Entries::release(oop* ptr, size_t cache_size) {
+  for (size_t i = 0; i < _count; i++) {
+    if (_entries[i] == ptr) {
+      // The handle has been deleted twice. Keep a single copy, otherwise
+      // two later allocations would get the same entry.
+      return true;
+    }
+  }
+  if (_count < cache_size) {
+    _entries[_count++] = ptr;
+    return true;
+  }
+  return false;
+}
+
+void JNIHandleAllocationCache::Entries::flush(OopStorage* storage) {
+  if (_count > 0) {
+    storage->release(_entries, _count);
+    _count = 0;
+  }
+}
+
+static JNIHandleAllocationCache* current_allocation_cache() {
+  // Cached entries are still allocated in their storage, so -Xcheck:jni could
+  // not tell them from live handles. Bypass the cache when checking.
+  if (JNIHandleAllocationCacheSize == 0 || CheckJNICalls) {
+    return NULL;
+  }
+  Thread* thread = Thread::current();
+  if (!thread->is_Java_thread()) {
+    return NULL;
+  }
+  JavaThread* jt = JavaThread::cast(thread);
+  JNIHandleAllocationCache* cache = jt->jni_handle_cache();
+  if (cache == NULL) {
+    // The cache is released on thread exit after the handle blocks. Handles
+    // destroyed after that go directly to the storage, a new cache would
+    // never be freed.
+    if (jt->is_exiting() || jt->active_handles() == NULL) {
+      return NULL;
+    }
+    cache = new JNIHandleAllocationCache();
+    jt->set_jni_handle_cache(cache);
+  }
+  return cache;
+}
+
+oop* JNIHandles::allocate_entry(OopStorage* storage, bool weak) {
+  JNIHandleAllocationCache* cache = current_allocation_cache();
+  if (cache != NULL) {
+    return cache->entries(weak)->allocate(storage, JNIHandleAllocationCacheSize);
+  }
+  return storage->allocate();
+}
+
+void JNIHandles::release_entry(OopStorage* storage, bool weak, oop* ptr) {
+  JNIHandleAllocationCache* cache = current_allocation_cache();
+  if (cache == NULL || !cache->entries(weak)->release(ptr, JNIHandleAllocationCacheSize)) {
+    storage->release(ptr);
+  }
+}
+
+void JNIHandles::release_allocation_cache(JavaThread* thread) {
+  JNIHandleAllocationCache* cache = thread->jni_handle_cache();
+  if (cache != NULL) {
+    thread->set_jni_handle_cache(NULL);
+    cache->entries(false /* weak */)->flush(global_handles());
+    cache->entries(true /* weak */)->flush(weak_global_handles());
+    delete cache;
+  }
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_gc_active(), "can't extend the root set during GC");
   assert(!current_thread_in_native(), "must not be in native");
@@ -88,7 +171,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_entry(global_handles(), false /* weak */);
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
@@ -109,7 +192,7 @@ jobject JNIHandles::make_weak_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = weak_global_handles()->allocate();
+    oop* ptr = allocate_entry(weak_global_handles(), true /* weak */);
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
@@ -148,7 +231,7 @@ void JNIHandles::destroy_global(jobject handle) {
     assert(!is_jweak(handle), "wrong method for detroying jweak");
     oop* oop_ptr = jobject_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)NULL);
-    global_handles()->release(oop_ptr);
+    release_entry(global_handles(), false /* weak */, oop_ptr);
   }
 }
 
@@ -158,7 +241,7 @@ void JNIHandles::destroy_weak_global(jobject handle) {
     assert(is_jweak(handle), "JNI handle not jweak");
     oop* oop_ptr = jweak_ptr(handle);
     NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(oop_ptr, (oop)NULL);
-    weak_global_handles()->release(oop_ptr);
+    release_entry(weak_global_handles(), true /* weak */, oop_ptr);
   }
 }
 
@@ -265,9 +348,20 @@ size_t JNIHandles::weak_global_handle_memory_usage() {
 void JNIHandles::print_on(outputStream* st) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
 
+  // Entries in the allocation caches are allocated but not in use.
+  size_t cached_global = 0;
+  size_t cached_weak = 0;
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* jt = jtiwh.next(); ) {
+    JNIHandleAllocationCache* cache = jt->jni_handle_cache();
+    if (cache != NULL) {
+      cached_global += cache->entries(false /* weak */)->count();
+      cached_weak += cache->entries(true /* weak */)->count();
+    }
+  }
+
   st->print_cr("JNI global refs: " SIZE_FORMAT ", weak refs: " SIZE_FORMAT,
-               global_handles()->allocation_count(),
-               weak_global_handles()->allocation_count());
+               global_handles()->allocation_count() - cached_global,
+               weak_global_handles()->allocation_count() - cached_weak);
   st->cr();
   st->flush();
 }
@@ -45,6 +45,9 @@ class JNIHandles : AllStatic {
   static OopStorage* global_handles();
   static OopStorage* weak_global_handles();
 
+  static oop* allocate_entry(OopStorage* storage, bool weak);
+  static void release_entry(OopStorage* storage, bool weak, oop* ptr);
+
   inline static bool is_jweak(jobject handle);
   inline static oop* jobject_ptr(jobject handle); // NOT jweak!
   inline static oop* jweak_ptr(jobject handle);
@@ -99,6 +102,9 @@ class JNIHandles : AllStatic {
   static void destroy_weak_global(jobject handle);
   static bool is_global_weak_cleared(jweak handle); // Test jweak without resolution
 
+  // Return the entries cached by the thread to the handle storages.
+  static void release_allocation_cache(JavaThread* thread);
+
   // Debugging
   static void print_on(outputStream* st);
   static void print();
@@ -123,6 +129,39 @@ class JNIHandles : AllStatic {
   static bool is_global_storage(const OopStorage* storage);
 };
 
+// Per-thread cache of global and weak global handle entries. The cached
+// entries are allocated in their storage but hold NULL, just like entries
+// that have been released. Refills use the bulk allocation of the storage,
+// so most handle creations and deletions avoid its allocation mutex.
+// Since cached entries still count as allocated, is_global_handle() and
+// is_weak_global_handle() accept a deleted handle while its entry is cached.
+// The cache is not used with -Xcheck:jni.
+class JNIHandleAllocationCache : public CHeapObj<mtInternal> {
+ public:
+  static const size_t max_entries = 32;
+
+ private:
+  class Entries {
+    oop* _entries[max_entries];
+    size_t _count;
+
+   public:
+    Entries() : _count(0) {}
+
+    size_t count() const { return _count; }
+
+    oop* allocate(OopStorage* storage, size_t cache_size);
+    bool release(oop* ptr, size_t cache_size);
+    void flush(OopStorage* storage);
+  };
+
+  Entries _global;
+  Entries _weak;
+
+ public:
+  Entries* entries(bool weak) { return weak ? &_weak : &_global; }
+};
+
 
 
 // JNI handle blocks holding local/global JNI handles
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "jvm.h"
 #include "classfile/javaClasses.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
@@ -32,37 +33,71 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/monitorDeflationThread.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/synchronizer.hpp"
+
+uint MonitorDeflationThread::_deflation_cycle = 0;
 
 void MonitorDeflationThread::initialize() {
   EXCEPTION_MARK;
 
-  const char* name = "Monitor Deflation Thread";
-  Handle thread_oop = JavaThread::create_system_thread_object(name, false /* not visible */, CHECK);
+  assert(MonitorDeflationThreads <= ObjectSynchronizer::MaxInUseLists, "must be");
+  for (uint i = 0; i < MonitorDeflationThreads; i++) {
+    char name[64];
+    if (i == 0) {
+      jio_snprintf(name, sizeof(name), "Monitor Deflation Thread");
+    } else {
+      jio_snprintf(name, sizeof(name), "Monitor Deflation Thread #%u", i);
+    }
+    Handle thread_oop = JavaThread::create_system_thread_object(name, false /* not visible */, CHECK);
 
-  MonitorDeflationThread* thread = new MonitorDeflationThread(&monitor_deflation_thread_entry);
-  JavaThread::vm_exit_on_osthread_failure(thread);
+    MonitorDeflationThread* thread = new MonitorDeflationThread(&monitor_deflation_thread_entry, i);
+    JavaThread::vm_exit_on_osthread_failure(thread);
 
-  JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NearMaxPriority);
+    JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NearMaxPriority);
+  }
 }
 
-void MonitorDeflationThread::monitor_deflation_thread_entry(JavaThread* jt, TRAPS) {
-  while (true) {
-    {
-      // Need state transition ThreadBlockInVM so that this thread
-      // will be handled by safepoint correctly when this thread is
-      // notified at a safepoint.
+void MonitorDeflationThread::wait_for_deflation_needed(JavaThread* jt) {
+  // Need state transition ThreadBlockInVM so that this thread
+  // will be handled by safepoint correctly when this thread is
+  // notified at a safepoint.
 
-      ThreadBlockInVM tbivm(jt);
+  ThreadBlockInVM tbivm(jt);
 
-      MonitorLocker ml(MonitorDeflation_lock, Mutex::_no_safepoint_check_flag);
-      while (!ObjectSynchronizer::is_async_deflation_needed()) {
-        // Wait until notified that there is some work to do.
-        // We wait for GuaranteedSafepointInterval so that
-        // is_async_deflation_needed() is checked at the same interval.
-        ml.wait(GuaranteedSafepointInterval);
-      }
+  MonitorLocker ml(MonitorDeflation_lock, Mutex::_no_safepoint_check_flag);
+  while (!ObjectSynchronizer::is_async_deflation_needed()) {
+    // Wait until notified that there is some work to do.
+    // We wait for GuaranteedSafepointInterval so that
+    // is_async_deflation_needed() is checked at the same interval.
+    ml.wait(GuaranteedSafepointInterval);
+  }
+  if (MonitorDeflationThreads > 1) {
+    // Start the cycle in the other deflation threads.
+    _deflation_cycle++;
+    ml.notify_all();
+  }
+}
+
+void MonitorDeflationThread::wait_for_deflation_cycle(JavaThread* jt, uint* last_cycle) {
+  ThreadBlockInVM tbivm(jt);
+
+  MonitorLocker ml(MonitorDeflation_lock, Mutex::_no_safepoint_check_flag);
+  while (_deflation_cycle == *last_cycle) {
+    ml.wait(GuaranteedSafepointInterval);
+  }
+  *last_cycle = _deflation_cycle;
+}
+
+void MonitorDeflationThread::monitor_deflation_thread_entry(JavaThread* jt, TRAPS) {
+  const uint list_index = static_cast<MonitorDeflationThread*>(jt)->_list_index;
+  uint last_cycle = 0;
+  while (true) {
+    if (list_index == 0) {
+      wait_for_deflation_needed(jt);
+    } else {
+      wait_for_deflation_cycle(jt, &last_cycle);
     }
 
-    (void)ObjectSynchronizer::deflate_idle_monitors(/* ObjectMonitorsHashtable is not needed here */ nullptr);
+    (void)ObjectSynchronizer::deflate_idle_monitors_in_list(list_index);
   }
 }
@@ -28,13 +28,24 @@
 #include "runtime/thread.hpp"
 
 // A hidden from external view JavaThread for deflating idle monitors.
+// With MonitorDeflationThreads > 1 there are several of these. Each one
+// deflates its own in-use list. The first one decides when to deflate and
+// starts a deflation cycle in the others.
 
 class MonitorDeflationThread : public JavaThread {
   friend class VMStructs;
  private:
+  // Number of deflation cycles started; protected by MonitorDeflation_lock.
+  static uint _deflation_cycle;
+
+  const uint _list_index;
 
   static void monitor_deflation_thread_entry(JavaThread* thread, TRAPS);
-  MonitorDeflationThread(ThreadFunction entry_point) : JavaThread(entry_point) {};
+  MonitorDeflationThread(ThreadFunction entry_point, uint list_index) :
+    JavaThread(entry_point), _list_index(list_index) {};
+
+  static void wait_for_deflation_needed(JavaThread* jt);
+  static void wait_for_deflation_cycle(JavaThread* jt, uint* last_cycle);
 
  public:
   static void initialize();
@@ -1858,6 +1858,7 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
         if (x < Knob_Poverty) x = Knob_Poverty;
         _SpinDuration = x + Knob_BonusB;
       }
+      OM_PERFDATA_OP(SpinSuccesses, inc());
       return 1;
     }
     SpinPause();
@@ -1878,11 +1879,16 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
   // hold the duration constant but vary the frequency.
 
   ctr = _SpinDuration;
-  if (ctr <= 0) return 0;
+  if (ctr <= 0) {
+    OM_PERFDATA_OP(SpinFailures, inc());
+    return 0;
+  }
 
   if (NotRunnable(current, (JavaThread*) owner_raw())) {
+    OM_PERFDATA_OP(SpinFailures, inc());
     return 0;
   }
+  const int spin_duration = ctr;
 
   // We're good to spin ... spin ingress.
   // CONSIDER: use Prefetch::write() to avoid RTS->RTO upgrades
@@ -1939,15 +1945,22 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
         // Increase _SpinDuration :
         // The spin was successful (profitable) so we tend toward
         // longer spin attempts in the future.
-        // CONSIDER: factor "ctr" into the _SpinDuration adjustment.
-        // If we acquired the lock early in the spin cycle it
-        // makes sense to increase _SpinDuration proportionally.
+        // With MonitorSpinAIMD the increase is scaled by the part of the
+        // spin duration this attempt used, between none and twice
+        // Knob_Bonus. A success early in the spin means the duration is
+        // already long enough, while a success close to the end means it
+        // barely was.
         // Note that we don't clamp SpinDuration precisely at SpinLimit.
         int x = _SpinDuration;
         if (x < Knob_SpinLimit) {
           if (x < Knob_Poverty) x = Knob_Poverty;
-          _SpinDuration = x + Knob_Bonus;
+          int bonus = Knob_Bonus;
+          if (MonitorSpinAIMD) {
+            bonus = (int)((2 * (jlong)Knob_Bonus * (spin_duration - ctr)) / spin_duration);
+          }
+          _SpinDuration = x + bonus;
         }
+        OM_PERFDATA_OP(SpinSuccesses, inc());
         return 1;
       }
 
@@ -1979,14 +1992,16 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
   }
 
   // Spin failed with prejudice -- reduce _SpinDuration.
-  // TODO: Use an AIMD-like policy to adjust _SpinDuration.
-  // AIMD is globally stable.
+  // With MonitorSpinAIMD, use an AIMD-like policy, which is globally
+  // stable: additive increase on success, multiplicative decrease here.
   {
     int x = _SpinDuration;
     if (x > 0) {
-      // Consider an AIMD scheme like: x -= (x >> 3) + 100
-      // This is globally sample and tends to damp the response.
-      x -= Knob_Penalty;
+      if (MonitorSpinAIMD) {
+        x -= (x >> 3) + Knob_Penalty;
+      } else {
+        x -= Knob_Penalty;
+      }
       if (x < 0) x = 0;
       _SpinDuration = x;
     }
@@ -2000,8 +2015,12 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
     // in the normal usage of TrySpin(), but it's safest
     // to make TrySpin() as foolproof as possible.
     OrderAccess::fence();
-    if (TryLock(current) > 0) return 1;
+    if (TryLock(current) > 0) {
+      OM_PERFDATA_OP(SpinSuccesses, inc());
+      return 1;
+    }
   }
+  OM_PERFDATA_OP(SpinFailures, inc());
   return 0;
 }
 
@@ -2147,6 +2166,8 @@ PerfCounter * ObjectMonitor::_sync_Parks                       = NULL;
 PerfCounter * ObjectMonitor::_sync_Notifications               = NULL;
 PerfCounter * ObjectMonitor::_sync_Inflations                  = NULL;
 PerfCounter * ObjectMonitor::_sync_Deflations                  = NULL;
+PerfCounter * ObjectMonitor::_sync_SpinSuccesses               = NULL;
+PerfCounter * ObjectMonitor::_sync_SpinFailures                = NULL;
 PerfLongVariable * ObjectMonitor::_sync_MonExtant              = NULL;
 
 // One-shot global initialization for the sync subsystem.
@@ -2182,6 +2203,8 @@ void ObjectMonitor::Initialize() {
     NEWPERFCOUNTER(_sync_FutileWakeups);
     NEWPERFCOUNTER(_sync_Parks);
     NEWPERFCOUNTER(_sync_Notifications);
+    NEWPERFCOUNTER(_sync_SpinSuccesses);
+    NEWPERFCOUNTER(_sync_SpinFailures);
     NEWPERFVARIABLE(_sync_MonExtant);
 #undef NEWPERFCOUNTER
 #undef NEWPERFVARIABLE
@@ -41,6 +41,7 @@
 #include "gc/shared/workerUtils.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -90,20 +91,55 @@ static void post_safepoint_cleanup_event(EventSafepointCleanup& event, uint64_t
   }
 }
 
+// The method the thread was executing when it stopped for the safepoint.
+static const Method* last_java_method(JavaThread* thread) {
+  if (!thread->has_last_Java_frame()) {
+    return NULL;
+  }
+  frame fr = thread->last_frame();
+  if (fr.is_interpreted_frame()) {
+    return fr.interpreter_frame_method();
+  }
+  CompiledMethod* cm = fr.cb() != NULL ? fr.cb()->as_compiled_method_or_null() : NULL;
+  return cm != NULL ? cm->method() : NULL;
+}
+
 static void post_safepoint_synchronize_event(EventSafepointStateSynchronization& event,
                                              uint64_t safepoint_id,
                                              int initial_number_of_threads,
                                              int threads_waiting_to_block,
-                                             uint64_t iterations) {
+                                             uint64_t iterations,
+                                             ThreadSafepointState* last_running) {
   if (event.should_commit()) {
     event.set_safepointId(safepoint_id);
     event.set_initialThreadCount(initial_number_of_threads);
     event.set_runningThreadCount(threads_waiting_to_block);
     event.set_iterations(iterations);
+    if (last_running != NULL) {
+      JavaThread* thread = last_running->thread();
+      event.set_lastThread(JFR_THREAD_ID(thread));
+      event.set_lastThreadState(_get_thread_state_name(last_running->last_running_state()));
+      event.set_lastThreadMethod(last_java_method(thread));
+    }
     event.commit();
   }
 }
 
+static void log_last_running_thread(ThreadSafepointState* last_running) {
+  LogTarget(Debug, safepoint) lt;
+  if (last_running != NULL && lt.is_enabled()) {
+    ResourceMark rm;
+    JavaThread* thread = last_running->thread();
+    const Method* method = last_java_method(thread);
+    address pc = thread->has_last_Java_frame() ? thread->last_frame().pc() : NULL;
+    lt.print("Last thread to reach safepoint: \"%s\" " INTPTR_FORMAT
+             ", was %s, stopped at " INTPTR_FORMAT " in %s",
+             thread->name(), p2i(thread),
+             _get_thread_state_name(last_running->last_running_state()),
+             p2i(pc), method != NULL ? method->external_name() : "<unknown>");
+  }
+}
+
 static void post_safepoint_cleanup_task_event(EventSafepointCleanupTask& event,
                                               uint64_t safepoint_id,
                                               const char* name) {
@@ -214,7 +250,8 @@ static void back_off(int64_t start_time) {
   }
 }
 
-int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
+int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                              ThreadSafepointState** last_running)
 {
   JavaThreadIteratorWithHandle jtiwh;
 
@@ -244,6 +281,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   DEBUG_ONLY(assert_list_is_valid(tss_head, still_running);)
 
   *initial_running = still_running;
+  *last_running = NULL;
 
   // If there is no thread still running, we are already done.
   if (still_running <= 0) {
@@ -270,6 +308,8 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
         tmp->set_next(NULL);
+        // Remember who held the safepoint back the longest.
+        *last_running = tmp;
       } else {
         *p_prev = cur_tss;
         p_prev = cur_tss->next_ptr();
@@ -381,12 +421,13 @@ void SafepointSynchronize::begin() {
 
   EventSafepointStateSynchronization sync_event;
   int initial_running = 0;
+  ThreadSafepointState* last_running = NULL;
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
   arm_safepoint();
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running, &last_running);
   assert(_waiting_to_block == 0, "No thread should be running");
 
 #ifndef PRODUCT
@@ -431,7 +472,9 @@ void SafepointSynchronize::begin() {
   post_safepoint_synchronize_event(sync_event,
                                    _safepoint_id,
                                    initial_running,
-                                   _waiting_to_block, iterations);
+                                   _waiting_to_block, iterations,
+                                   last_running);
+  log_last_running_thread(last_running);
 
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
@@ -816,7 +859,8 @@ void SafepointSynchronize::print_safepoint_timeout() {
 
 ThreadSafepointState::ThreadSafepointState(JavaThread *thread)
   : _at_poll_safepoint(false), _thread(thread), _safepoint_safe(false),
-    _safepoint_id(SafepointSynchronize::InactiveSafepointCounter), _next(NULL) {
+    _safepoint_id(SafepointSynchronize::InactiveSafepointCounter),
+    _last_running_state(_thread_uninitialized), _next(NULL) {
 }
 
 void ThreadSafepointState::create(JavaThread *thread) {
@@ -858,6 +902,8 @@ void ThreadSafepointState::examine_state_of_thread(uint64_t safepoint_count) {
     return;
   }
 
+  _last_running_state = stable_state;
+
   // All other thread states will continue to run until they
   // transition and self-block in state _blocked
   // Safepoint polling in compiled code causes the Java threads to do the same.
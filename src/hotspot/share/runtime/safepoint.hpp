@@ -115,7 +115,8 @@ class SafepointSynchronize : AllStatic {
 
   // Helper methods for safepoint procedure:
   static void arm_safepoint();
-  static int synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running);
+  static int synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                 ThreadSafepointState** last_running);
   static void disarm_safepoint();
   static void increment_jni_active_count();
   static void decrement_waiting_to_block();
@@ -209,6 +210,8 @@ class ThreadSafepointState: public CHeapObj<mtThread> {
   JavaThread*                     _thread;
   bool                            _safepoint_safe;
   volatile uint64_t               _safepoint_id;
+  // State the thread was last seen running in while synchronizing.
+  JavaThreadState                 _last_running_state;
 
   ThreadSafepointState*           _next;
 
@@ -229,6 +232,7 @@ class ThreadSafepointState: public CHeapObj<mtThread> {
   // Query
   JavaThread*  thread() const         { return _thread; }
   bool         is_running() const     { return !_safepoint_safe; }
+  JavaThreadState last_running_state() const { return _last_running_state; }
 
   uint64_t get_safepoint_id() const;
   void     reset_safepoint_id();
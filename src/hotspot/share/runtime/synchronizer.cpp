@@ -249,6 +249,49 @@ void ObjectSynchronizer::initialize() {
 }
 
 MonitorList ObjectSynchronizer::_in_use_list;
+MonitorList ObjectSynchronizer::_extra_in_use_lists[ObjectSynchronizer::MaxInUseLists - 1];
+
+uint ObjectSynchronizer::num_in_use_lists() {
+  return MonitorDeflationThreads;
+}
+
+MonitorList* ObjectSynchronizer::in_use_list(uint list_index) {
+  assert(list_index < num_in_use_lists(), "invalid list index %u", list_index);
+  return list_index == 0 ? &_in_use_list : &_extra_in_use_lists[list_index - 1];
+}
+
+MonitorList* ObjectSynchronizer::in_use_list_for(Thread* current) {
+  // Spread inflating threads over the lists so that they do not all
+  // contend on the same list head. Thread addresses are malloc-aligned
+  // (16 bytes), so the low bits carry no information; mix the rest with
+  // a golden-ratio multiplication (Fibonacci hashing).
+  uint n = num_in_use_lists();
+  if (n == 1) {
+    return &_in_use_list;
+  }
+  const uint64_t key = (uint64_t)((uintptr_t)current >> 4);
+  const uint hash = (uint)((key * CONST64(0x9E3779B97F4A7C15)) >> 32);
+  return in_use_list(hash % n);
+}
+
+size_t ObjectSynchronizer::in_use_list_count() {
+  size_t count = 0;
+  for (uint i = 0; i < num_in_use_lists(); i++) {
+    count += in_use_list(i)->count();
+  }
+  return count;
+}
+
+// The sum of the maxima of the lists. This is an upper bound of the
+// maximum of the total count.
+size_t ObjectSynchronizer::in_use_list_max() {
+  size_t max = 0;
+  for (uint i = 0; i < num_in_use_lists(); i++) {
+    max += in_use_list(i)->max();
+  }
+  return max;
+}
+
 // monitors_used_above_threshold() policy is as follows:
 //
 // The ratio of the current _in_use_list count to the ceiling is used
@@ -273,6 +316,7 @@ static size_t _in_use_list_ceiling = 0;
 bool volatile ObjectSynchronizer::_is_async_deflation_requested = false;
 bool volatile ObjectSynchronizer::_is_final_audit = false;
 jlong ObjectSynchronizer::_last_async_deflation_time_ns = 0;
+volatile uint ObjectSynchronizer::_list_deflation_count[ObjectSynchronizer::MaxInUseLists];
 static uintx _no_progress_cnt = 0;
 
 // =====================> Quick functions
@@ -911,14 +955,25 @@ intptr_t ObjectSynchronizer::FastHashCode(Thread* current, oop obj) {
       if (hash != 0) {                  // if it has a hash, just return it
         return hash;
       }
-      // WARNING:
-      // The displaced header in the BasicLock on a thread's stack
-      // is strictly immutable. It CANNOT be changed in ANY cases.
-      // So we have to inflate the stack lock into an ObjectMonitor
-      // even if the current thread owns the lock. The BasicLock on
-      // a thread's stack can be asynchronously read by other threads
-      // during an inflate() call so any change to that stack memory
-      // may not propagate to other threads correctly.
+      // The BasicLock on a thread's stack can be asynchronously read by
+      // other threads during an inflate() call, so the displaced header
+      // must not change while another thread may be inflating. inflate()
+      // only reads it after it has replaced the object's header with
+      // INFLATING, and everybody else waits for INFLATING to go away in
+      // read_stable_mark(). So the owner can claim INFLATING itself, merge
+      // the hash into the displaced header, and put the stack lock back.
+      // This avoids inflating just because a thread hashes an object it
+      // has locked.
+      if (obj->cas_set_mark(markWord::INFLATING(), mark) == mark) {
+        hash = get_next_hash(current, obj);
+        temp = temp.copy_set_hash(hash);
+        mark.locker()->set_displaced_header(temp);
+        // Publish the new displaced header before the stack lock.
+        obj->release_set_mark(mark);
+        return hash;
+      }
+      // Another thread started inflating, so fall thru and use the
+      // ObjectMonitor.
     }
 
     // Inflate the monitor to set the hash.
@@ -1032,24 +1087,26 @@ JavaThread* ObjectSynchronizer::get_lock_owner(ThreadsList * t_list, Handle h_ob
 // This version of monitors_iterate() works with the in-use monitor list.
 //
 void ObjectSynchronizer::monitors_iterate(MonitorClosure* closure, JavaThread* thread) {
-  MonitorList::Iterator iter = _in_use_list.iterator();
-  while (iter.has_next()) {
-    ObjectMonitor* mid = iter.next();
-    if (mid->owner() != thread) {
-      // Not owned by the target thread and intentionally skips when owner
-      // is set to a stack lock address in the target thread.
-      continue;
-    }
-    if (!mid->is_being_async_deflated() && mid->object_peek() != NULL) {
-      // Only process with closure if the object is set.
-
-      // monitors_iterate() is only called at a safepoint or when the
-      // target thread is suspended or when the target thread is
-      // operating on itself. The current closures in use today are
-      // only interested in an owned ObjectMonitor and ownership
-      // cannot be dropped under the calling contexts so the
-      // ObjectMonitor cannot be async deflated.
-      closure->do_monitor(mid);
+  for (uint i = 0; i < num_in_use_lists(); i++) {
+    MonitorList::Iterator iter = in_use_list(i)->iterator();
+    while (iter.has_next()) {
+      ObjectMonitor* mid = iter.next();
+      if (mid->owner() != thread) {
+        // Not owned by the target thread and intentionally skips when owner
+        // is set to a stack lock address in the target thread.
+        continue;
+      }
+      if (!mid->is_being_async_deflated() && mid->object_peek() != NULL) {
+        // Only process with closure if the object is set.
+
+        // monitors_iterate() is only called at a safepoint or when the
+        // target thread is suspended or when the target thread is
+        // operating on itself. The current closures in use today are
+        // only interested in an owned ObjectMonitor and ownership
+        // cannot be dropped under the calling contexts so the
+        // ObjectMonitor cannot be async deflated.
+        closure->do_monitor(mid);
+      }
     }
   }
 }
@@ -1079,18 +1136,19 @@ void ObjectSynchronizer::monitors_iterate(MonitorClosure* closure,
   }
 }
 
-static bool monitors_used_above_threshold(MonitorList* list) {
+static bool monitors_used_above_threshold() {
   if (MonitorUsedDeflationThreshold == 0) {  // disabled case is easy
     return false;
   }
   // Start with ceiling based on a per-thread estimate:
   size_t ceiling = ObjectSynchronizer::in_use_list_ceiling();
   size_t old_ceiling = ceiling;
-  if (ceiling < list->max()) {
+  size_t max = ObjectSynchronizer::in_use_list_max();
+  if (ceiling < max) {
     // The max used by the system has exceeded the ceiling so use that:
-    ceiling = list->max();
+    ceiling = max;
   }
-  size_t monitors_used = list->count();
+  size_t monitors_used = ObjectSynchronizer::in_use_list_count();
   if (monitors_used == 0) {  // empty list is easy
     return false;
   }
@@ -1134,7 +1192,7 @@ bool ObjectSynchronizer::is_async_deflation_needed() {
   }
   if (AsyncDeflationInterval > 0 &&
       time_since_last_async_deflation_ms() > AsyncDeflationInterval &&
-      monitors_used_above_threshold(&_in_use_list)) {
+      monitors_used_above_threshold()) {
     // It's been longer than our specified deflate interval and there
     // are too many monitors in use. We don't deflate more frequently
     // than AsyncDeflationInterval (unless is_async_deflation_requested)
@@ -1149,6 +1207,13 @@ bool ObjectSynchronizer::request_deflate_idle_monitors() {
   bool ret_code = false;
 
   jlong last_time = last_async_deflation_time_ns();
+  // The primary deflation thread updates _last_async_deflation_time_ns
+  // when it starts; also wait for every list, including the ones owned
+  // by the other MonitorDeflationThreads, to have been deflated.
+  uint last_counts[MaxInUseLists];
+  for (uint i = 0; i < num_in_use_lists(); i++) {
+    last_counts[i] = Atomic::load_acquire(&_list_deflation_count[i]);
+  }
   set_is_async_deflation_requested(true);
   {
     MonitorLocker ml(MonitorDeflation_lock, Mutex::_no_safepoint_check_flag);
@@ -1156,7 +1221,14 @@ bool ObjectSynchronizer::request_deflate_idle_monitors() {
   }
   const int N_CHECKS = 5;
   for (int i = 0; i < N_CHECKS; i++) {  // sleep for at most 5 seconds
-    if (last_async_deflation_time_ns() > last_time) {
+    bool all_lists_deflated = true;
+    for (uint j = 0; j < num_in_use_lists(); j++) {
+      if (Atomic::load_acquire(&_list_deflation_count[j]) == last_counts[j]) {
+        all_lists_deflated = false;
+        break;
+      }
+    }
+    if (last_async_deflation_time_ns() > last_time && all_lists_deflated) {
       log_info(monitorinflation)("Async Deflation happened after %d check(s).", i);
       ret_code = true;
       break;
@@ -1311,7 +1383,7 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread* current, oop object,
 
       // Once ObjectMonitor is configured and the object is associated
       // with the ObjectMonitor, it is safe to allow async deflation:
-      _in_use_list.add(m);
+      in_use_list_for(current)->add(m);
 
       // Hopefully the performance counters are allocated on distinct cache lines
       // to avoid false sharing on MP systems ...
@@ -1355,7 +1427,7 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread* current, oop object,
 
     // Once the ObjectMonitor is configured and object is associated
     // with the ObjectMonitor, it is safe to allow async deflation:
-    _in_use_list.add(m);
+    in_use_list_for(current)->add(m);
 
     // Hopefully the performance counters are allocated on distinct
     // cache lines to avoid false sharing on MP systems ...
@@ -1386,7 +1458,7 @@ void ObjectSynchronizer::chk_for_block_req(JavaThread* current, const char* op_n
     ls->print_cr("pausing %s: %s=" SIZE_FORMAT ", in_use_list stats: ceiling="
                  SIZE_FORMAT ", count=" SIZE_FORMAT ", max=" SIZE_FORMAT,
                  op_name, cnt_name, cnt, in_use_list_ceiling(),
-                 _in_use_list.count(), _in_use_list.max());
+                 in_use_list_count(), in_use_list_max());
   }
 
   {
@@ -1397,7 +1469,7 @@ void ObjectSynchronizer::chk_for_block_req(JavaThread* current, const char* op_n
   if (ls != NULL) {
     ls->print_cr("resuming %s: in_use_list stats: ceiling=" SIZE_FORMAT
                  ", count=" SIZE_FORMAT ", max=" SIZE_FORMAT, op_name,
-                 in_use_list_ceiling(), _in_use_list.count(), _in_use_list.max());
+                 in_use_list_ceiling(), in_use_list_count(), in_use_list_max());
     timer_p->start();
   }
 }
@@ -1412,10 +1484,10 @@ void ObjectSynchronizer::chk_for_block_req(JavaThread* current, const char* op_n
 // ObjectMonitorsHashtable info only care about JNI locked monitors and
 // those do not have the owner set to a stack lock address.
 //
-size_t ObjectSynchronizer::deflate_monitor_list(Thread* current, LogStream* ls,
-                                                elapsedTimer* timer_p,
+size_t ObjectSynchronizer::deflate_monitor_list(MonitorList* list, Thread* current,
+                                                LogStream* ls, elapsedTimer* timer_p,
                                                 ObjectMonitorsHashtable* table) {
-  MonitorList::Iterator iter = _in_use_list.iterator();
+  MonitorList::Iterator iter = list->iterator();
   size_t deflated_count = 0;
 
   while (iter.has_next()) {
@@ -1463,8 +1535,21 @@ class HandshakeForDeflation : public HandshakeClosure {
 // ObjectMonitors. It is also called via do_final_audit_and_print_stats()
 // and VM_ThreadDump::doit() by the VMThread.
 size_t ObjectSynchronizer::deflate_idle_monitors(ObjectMonitorsHashtable* table) {
+  return deflate_idle_monitors(table, 0, num_in_use_lists());
+}
+
+size_t ObjectSynchronizer::deflate_idle_monitors_in_list(uint list_index) {
+  return deflate_idle_monitors(nullptr, list_index, list_index + 1);
+}
+
+// Deflate the idle ObjectMonitors in the in-use lists [first_list, end_list).
+// The deflation bookkeeping is done by whoever deflates the first list, so
+// that additional MonitorDeflationThreads do not disturb it.
+size_t ObjectSynchronizer::deflate_idle_monitors(ObjectMonitorsHashtable* table,
+                                                 uint first_list, uint end_list) {
   Thread* current = Thread::current();
-  if (current->is_Java_thread()) {
+  const bool is_primary = (first_list == 0);
+  if (current->is_Java_thread() && is_primary) {
     // The async deflation request has been processed.
     _last_async_deflation_time_ns = os::javaTimeNanos();
     set_is_async_deflation_requested(false);
@@ -1482,12 +1567,15 @@ size_t ObjectSynchronizer::deflate_idle_monitors(ObjectMonitorsHashtable* table)
   elapsedTimer timer;
   if (ls != NULL) {
     ls->print_cr("begin deflating: in_use_list stats: ceiling=" SIZE_FORMAT ", count=" SIZE_FORMAT ", max=" SIZE_FORMAT,
-                 in_use_list_ceiling(), _in_use_list.count(), _in_use_list.max());
+                 in_use_list_ceiling(), in_use_list_count(), in_use_list_max());
     timer.start();
   }
 
   // Deflate some idle ObjectMonitors.
-  size_t deflated_count = deflate_monitor_list(current, ls, &timer, table);
+  size_t deflated_count = 0;
+  for (uint i = first_list; i < end_list; i++) {
+    deflated_count += deflate_monitor_list(in_use_list(i), current, ls, &timer, table);
+  }
   if (deflated_count > 0 || is_final_audit()) {
     // There are ObjectMonitors that have been deflated or this is the
     // final audit and all the remaining ObjectMonitors have been
@@ -1497,8 +1585,11 @@ size_t ObjectSynchronizer::deflate_idle_monitors(ObjectMonitorsHashtable* table)
     // Unlink deflated ObjectMonitors from the in-use list.
     ResourceMark rm;
     GrowableArray<ObjectMonitor*> delete_list((int)deflated_count);
-    size_t unlinked_count = _in_use_list.unlink_deflated(current, ls, &timer,
-                                                         &delete_list);
+    size_t unlinked_count = 0;
+    for (uint i = first_list; i < end_list; i++) {
+      unlinked_count += in_use_list(i)->unlink_deflated(current, ls, &timer,
+                                                        &delete_list);
+    }
     if (current->is_Java_thread()) {
       if (ls != NULL) {
         timer.stop();
@@ -1506,7 +1597,7 @@ size_t ObjectSynchronizer::deflate_idle_monitors(ObjectMonitorsHashtable* table)
                      ", in_use_list stats: ceiling=" SIZE_FORMAT ", count="
                      SIZE_FORMAT ", max=" SIZE_FORMAT,
                      unlinked_count, in_use_list_ceiling(),
-                     _in_use_list.count(), _in_use_list.max());
+                     in_use_list_count(), in_use_list_max());
       }
 
       // A JavaThread needs to handshake in order to safely free the
@@ -1517,7 +1608,7 @@ size_t ObjectSynchronizer::deflate_idle_monitors(ObjectMonitorsHashtable* table)
       if (ls != NULL) {
         ls->print_cr("after handshaking: in_use_list stats: ceiling="
                      SIZE_FORMAT ", count=" SIZE_FORMAT ", max=" SIZE_FORMAT,
-                     in_use_list_ceiling(), _in_use_list.count(), _in_use_list.max());
+                     in_use_list_ceiling(), in_use_list_count(), in_use_list_max());
         timer.start();
       }
     }
@@ -1544,22 +1635,28 @@ size_t ObjectSynchronizer::deflate_idle_monitors(ObjectMonitorsHashtable* table)
                    deflated_count, timer.seconds());
     }
     ls->print_cr("end deflating: in_use_list stats: ceiling=" SIZE_FORMAT ", count=" SIZE_FORMAT ", max=" SIZE_FORMAT,
-                 in_use_list_ceiling(), _in_use_list.count(), _in_use_list.max());
+                 in_use_list_ceiling(), in_use_list_count(), in_use_list_max());
     if (table != nullptr) {
       ls->print_cr("ObjectMonitorsHashtable: key_count=" SIZE_FORMAT ", om_count=" SIZE_FORMAT,
                    table->key_count(), table->om_count());
     }
   }
 
-  OM_PERFDATA_OP(MonExtant, set_value(_in_use_list.count()));
+  OM_PERFDATA_OP(MonExtant, set_value(in_use_list_count()));
   OM_PERFDATA_OP(Deflations, inc(deflated_count));
 
-  GVars.stw_random = os::random();
+  for (uint i = first_list; i < end_list; i++) {
+    Atomic::inc(&_list_deflation_count[i]);
+  }
 
-  if (deflated_count != 0) {
-    _no_progress_cnt = 0;
-  } else {
-    _no_progress_cnt++;
+  if (is_primary) {
+    GVars.stw_random = os::random();
+
+    if (deflated_count != 0) {
+      _no_progress_cnt = 0;
+    } else {
+      _no_progress_cnt++;
+    }
   }
 
   return deflated_count;
@@ -1712,17 +1809,19 @@ void ObjectSynchronizer::audit_and_print_stats(bool on_exit) {
 
 // Check the in_use_list; log the results of the checks.
 void ObjectSynchronizer::chk_in_use_list(outputStream* out, int *error_cnt_p) {
-  size_t l_in_use_count = _in_use_list.count();
-  size_t l_in_use_max = _in_use_list.max();
+  size_t l_in_use_count = in_use_list_count();
+  size_t l_in_use_max = in_use_list_max();
   out->print_cr("count=" SIZE_FORMAT ", max=" SIZE_FORMAT, l_in_use_count,
                 l_in_use_max);
 
   size_t ck_in_use_count = 0;
-  MonitorList::Iterator iter = _in_use_list.iterator();
-  while (iter.has_next()) {
-    ObjectMonitor* mid = iter.next();
-    chk_in_use_entry(mid, out, error_cnt_p);
-    ck_in_use_count++;
+  for (uint i = 0; i < num_in_use_lists(); i++) {
+    MonitorList::Iterator iter = in_use_list(i)->iterator();
+    while (iter.has_next()) {
+      ObjectMonitor* mid = iter.next();
+      chk_in_use_entry(mid, out, error_cnt_p);
+      ck_in_use_count++;
+    }
   }
 
   if (l_in_use_count == ck_in_use_count) {
@@ -1734,7 +1833,7 @@ void ObjectSynchronizer::chk_in_use_list(outputStream* out, int *error_cnt_p) {
                   ck_in_use_count);
   }
 
-  size_t ck_in_use_max = _in_use_list.max();
+  size_t ck_in_use_max = in_use_list_max();
   if (l_in_use_max == ck_in_use_max) {
     out->print_cr("in_use_max=" SIZE_FORMAT " equals ck_in_use_max="
                   SIZE_FORMAT, l_in_use_max, ck_in_use_max);
@@ -1784,26 +1883,28 @@ void ObjectSynchronizer::chk_in_use_entry(ObjectMonitor* n, outputStream* out,
 // indicate the associated object and its type.
 void ObjectSynchronizer::log_in_use_monitor_details(outputStream* out) {
   stringStream ss;
-  if (_in_use_list.count() > 0) {
+  if (in_use_list_count() > 0) {
     out->print_cr("In-use monitor info:");
     out->print_cr("(B -> is_busy, H -> has hash code, L -> lock status)");
     out->print_cr("%18s  %s  %18s  %18s",
                   "monitor", "BHL", "object", "object type");
     out->print_cr("==================  ===  ==================  ==================");
-    MonitorList::Iterator iter = _in_use_list.iterator();
-    while (iter.has_next()) {
-      ObjectMonitor* mid = iter.next();
-      const oop obj = mid->object_peek();
-      const markWord mark = mid->header();
-      ResourceMark rm;
-      out->print(INTPTR_FORMAT "  %d%d%d  " INTPTR_FORMAT "  %s", p2i(mid),
-                 mid->is_busy(), mark.hash() != 0, mid->owner() != NULL,
-                 p2i(obj), obj == NULL ? "" : obj->klass()->external_name());
-      if (mid->is_busy()) {
-        out->print(" (%s)", mid->is_busy_to_string(&ss));
-        ss.reset();
+    for (uint i = 0; i < num_in_use_lists(); i++) {
+      MonitorList::Iterator iter = in_use_list(i)->iterator();
+      while (iter.has_next()) {
+        ObjectMonitor* mid = iter.next();
+        const oop obj = mid->object_peek();
+        const markWord mark = mid->header();
+        ResourceMark rm;
+        out->print(INTPTR_FORMAT "  %d%d%d  " INTPTR_FORMAT "  %s", p2i(mid),
+                   mid->is_busy(), mark.hash() != 0, mid->owner() != NULL,
+                   p2i(obj), obj == NULL ? "" : obj->klass()->external_name());
+        if (mid->is_busy()) {
+          out->print(" (%s)", mid->is_busy_to_string(&ss));
+          ss.reset();
+        }
+        out->cr();
       }
-      out->cr();
     }
   }
 
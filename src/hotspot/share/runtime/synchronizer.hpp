@@ -125,6 +125,10 @@ class ObjectSynchronizer : AllStatic {
   friend class VMStructs;
 
  public:
+  // Upper bound of MonitorDeflationThreads; each deflation thread owns
+  // one in-use list.
+  static const uint MaxInUseLists = 16;
+
   typedef enum {
     inflate_cause_vm_internal = 0,
     inflate_cause_monitor_enter = 1,
@@ -208,13 +212,25 @@ class ObjectSynchronizer : AllStatic {
   // GC: we currently use aggressive monitor deflation policy
   // Basically we try to deflate all monitors that are not busy.
   static size_t deflate_idle_monitors(ObjectMonitorsHashtable* table);
+  // Only deflate the monitors in the given in-use list. Used by the
+  // MonitorDeflationThread that owns that list.
+  static size_t deflate_idle_monitors_in_list(uint list_index);
 
   // Deflate idle monitors:
   static void chk_for_block_req(JavaThread* current, const char* op_name,
                                 const char* cnt_name, size_t cnt, LogStream* ls,
                                 elapsedTimer* timer_p);
-  static size_t deflate_monitor_list(Thread* current, LogStream* ls, elapsedTimer* timer_p,
-                                     ObjectMonitorsHashtable* table);
+  static size_t deflate_monitor_list(MonitorList* list, Thread* current, LogStream* ls,
+                                     elapsedTimer* timer_p, ObjectMonitorsHashtable* table);
+
+  // In-use lists. There is one per MonitorDeflationThread and inflating
+  // threads are spread over them. The counts are summed over all lists.
+  static uint num_in_use_lists();
+  static MonitorList* in_use_list(uint list_index);
+  static MonitorList* in_use_list_for(Thread* current);
+  static size_t in_use_list_count();
+  static size_t in_use_list_max();
+
   static size_t in_use_list_ceiling();
   static void dec_in_use_list_ceiling();
   static void inc_in_use_list_ceiling();
@@ -239,10 +255,17 @@ class ObjectSynchronizer : AllStatic {
  private:
   friend class SynchronizerTest;
 
+  // The first in-use list is the one known to the serviceability agent.
+  // The other lists are not exported through vmStructs, so with
+  // MonitorDeflationThreads > 1 the agent only sees part of the in-use
+  // monitors.
   static MonitorList _in_use_list;
+  static MonitorList _extra_in_use_lists[MaxInUseLists - 1];
   static volatile bool _is_async_deflation_requested;
   static volatile bool _is_final_audit;
   static jlong         _last_async_deflation_time_ns;
+  // Number of completed deflation passes over each in-use list.
+  static volatile uint _list_deflation_count[MaxInUseLists];
 
   // Support for SynchronizerTest access to GVars fields:
   static u_char* get_gvars_addr();
@@ -251,6 +274,9 @@ class ObjectSynchronizer : AllStatic {
   static u_char* get_gvars_stw_random_addr();
 
   static void handle_sync_on_value_based_class(Handle obj, JavaThread* current);
+
+  static size_t deflate_idle_monitors(ObjectMonitorsHashtable* table,
+                                      uint first_list, uint end_list);
 };
 
 // ObjectLocker enforces balanced locking and can never throw an
@@ -25,8 +25,10 @@
 
 #include "precompiled.hpp"
 #include "jvm.h"
+#include "cds/archivedClassPreloader.hpp"
 #include "cds/dynamicArchive.hpp"
 #include "cds/metaspaceShared.hpp"
+#include "cds/precompileList.hpp"
 #include "classfile/classLoader.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/javaThreadStatus.hpp"
@@ -1011,6 +1013,7 @@ JavaThread::JavaThread() :
   _current_waiting_monitor(NULL),
   _active_handles(NULL),
   _free_handle_block(NULL),
+  _jni_handle_cache(NULL),
   _Stalled(0),
 
   _monitor_chunks(nullptr),
@@ -1459,6 +1462,8 @@ void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
     JNIHandleBlock::release_block(block);
   }
 
+  JNIHandles::release_allocation_cache(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -1529,6 +1534,8 @@ void JavaThread::cleanup_failed_attach_current_thread(bool is_daemon) {
     JNIHandleBlock::release_block(block);
   }
 
+  JNIHandles::release_allocation_cache(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -2538,9 +2545,21 @@ void Threads::threads_do(ThreadClosure* tc) {
   non_java_threads_do(tc);
 }
 
-void Threads::possibly_parallel_threads_do(bool is_par, ThreadClosure* tc) {
+void Threads::possibly_parallel_threads_do(bool is_par, ThreadClosure* tc,
+                                           uint worker_id, uint n_workers) {
+  assert(worker_id < n_workers, "worker id %u out of range %u", worker_id, n_workers);
   uintx claim_token = Threads::thread_claim_token();
-  ALL_JAVA_THREADS(p) {
+  // Each worker starts at its own slice of the thread list and wraps
+  // around, so that workers do not all compete for the same threads.
+  ThreadsList* list = ThreadsSMRSupport::get_java_thread_list();
+  uint length = list->length();
+  uint start = (uint)(((uint64_t)length * worker_id) / n_workers);
+  for (uint i = 0; i < length; i++) {
+    uint index = start + i;
+    if (index >= length) {
+      index -= length;
+    }
+    JavaThread* p = list->thread_at(index);
     if (p->claim_threads_do(is_par, claim_token)) {
       tc->do_thread(p);
     }
@@ -2978,6 +2997,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   if (JVMCI_ONLY(!force_JVMCI_intialization) NOT_JVMCI(true)) {
     CompileBroker::compilation_init_phase2();
   }
+  CDS_ONLY(PrecompileList::initialize(main_thread);)
 #endif
 
   // Pre-initialize some JSR292 core classes to avoid deadlock during class loading.
@@ -2990,6 +3010,9 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   // loaded until phase 2 completes
   call_initPhase2(CHECK_JNI_ERR);
 
+  // The boot classes of all modules are visible now.
+  CDS_ONLY(ArchivedClassPreloader::initialize(CHECK_JNI_ERR);)
+
   JFR_ONLY(Jfr::on_create_vm_2();)
 
   // Always call even when there are not JVMTI environments yet, since environments
@@ -3621,9 +3644,10 @@ public:
   }
 };
 
-void Threads::possibly_parallel_oops_do(bool is_par, OopClosure* f, CodeBlobClosure* cf) {
+void Threads::possibly_parallel_oops_do(bool is_par, OopClosure* f, CodeBlobClosure* cf,
+                                        uint worker_id, uint n_workers) {
   ParallelOopsDoThreadClosure tc(f, cf);
-  possibly_parallel_threads_do(is_par, &tc);
+  possibly_parallel_threads_do(is_par, &tc, worker_id, n_workers);
 }
 
 void Threads::metadata_do(MetadataClosure* f) {
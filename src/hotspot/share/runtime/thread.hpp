@@ -59,6 +59,7 @@ class ThreadSafepointState;
 class ThreadsList;
 class ThreadsSMRSupport;
 
+class JNIHandleAllocationCache;
 class JNIHandleBlock;
 class JvmtiRawMonitor;
 class JvmtiSampledObjectAllocEventCollector;
@@ -164,9 +165,9 @@ class Thread: public ThreadShadow {
 
   // JavaThread lifecycle support:
   friend class SafeThreadsListPtr;  // for _threads_list_ptr, cmpxchg_threads_hazard_ptr(), {dec_,inc_,}nested_threads_hazard_ptr_cnt(), {g,s}et_threads_hazard_ptr(), inc_nested_handle_cnt(), tag_hazard_ptr() access
-  friend class ScanHazardPtrGatherProtectedThreadsClosure;  // for cmpxchg_threads_hazard_ptr(), get_threads_hazard_ptr(), is_hazard_ptr_tagged() access
   friend class ScanHazardPtrGatherThreadsListClosure;  // for get_threads_hazard_ptr(), untag_hazard_ptr() access
   friend class ScanHazardPtrPrintMatchingThreadsClosure;  // for get_threads_hazard_ptr(), is_hazard_ptr_tagged() access
+  friend class ScanHazardPtrProtectsThreadClosure;  // for cmpxchg_threads_hazard_ptr(), get_threads_hazard_ptr(), is_hazard_ptr_tagged() access
   friend class ThreadsSMRSupport;  // for _nested_threads_hazard_ptr_cnt, _threads_hazard_ptr, _threads_list_ptr access
   friend class ThreadsListHandleTest;  // for _nested_threads_hazard_ptr_cnt, _threads_hazard_ptr, _threads_list_ptr access
   friend class ValidateHazardPtrsClosure;  // for get_threads_hazard_ptr(), untag_hazard_ptr() access
@@ -671,6 +672,9 @@ class CompilerThread;
 
 typedef void (*ThreadFunction)(JavaThread*, TRAPS);
 
+// Printable name of a JavaThreadState.
+const char* _get_thread_state_name(JavaThreadState _thread_state);
+
 class JavaThread: public Thread {
   friend class VMStructs;
   friend class JVMCIVMStructs;
@@ -741,6 +745,9 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Free global and weak global handle entries, see JNIHandleAllocationCacheSize
+  JNIHandleAllocationCache* _jni_handle_cache;
+
  public:
   volatile intptr_t _Stalled;
 
@@ -773,6 +780,8 @@ class JavaThread: public Thread {
   void set_active_handles(JNIHandleBlock* block) { _active_handles = block; }
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
+  JNIHandleAllocationCache* jni_handle_cache() const { return _jni_handle_cache; }
+  void set_jni_handle_cache(JNIHandleAllocationCache* cache) { _jni_handle_cache = cache; }
 
   void push_jni_handle_block();
   void pop_jni_handle_block();
@@ -1657,7 +1666,10 @@ class Threads: AllStatic {
   static void java_threads_do(ThreadClosure* tc);
   static void java_threads_and_vm_thread_do(ThreadClosure* tc);
   static void threads_do(ThreadClosure* tc);
-  static void possibly_parallel_threads_do(bool is_par, ThreadClosure* tc);
+  // Parallel callers may pass their worker id and the number of workers,
+  // to spread the starting points of their claiming over the thread list.
+  static void possibly_parallel_threads_do(bool is_par, ThreadClosure* tc,
+                                           uint worker_id = 0, uint n_workers = 1);
 
   // Initializes the vm and creates the vm thread
   static jint create_vm(JavaVMInitArgs* args, bool* canTryAgain);
@@ -1695,7 +1707,8 @@ class Threads: AllStatic {
   // This version may only be called by sequential code.
   static void oops_do(OopClosure* f, CodeBlobClosure* cf);
   // This version may be called by sequential or parallel code.
-  static void possibly_parallel_oops_do(bool is_par, OopClosure* f, CodeBlobClosure* cf);
+  static void possibly_parallel_oops_do(bool is_par, OopClosure* f, CodeBlobClosure* cf,
+                                        uint worker_id = 0, uint n_workers = 1);
 
   // RedefineClasses support
   static void metadata_do(MetadataClosure* f);
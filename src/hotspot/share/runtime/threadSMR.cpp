@@ -178,9 +178,8 @@ inline ThreadsList* ThreadsSMRSupport::xchg_java_thread_list(ThreadsList* new_li
 }
 
 // Hash table of pointers found by a scan. Used for collecting hazard
-// pointers (ThreadsList references). Also used for collecting JavaThreads
-// that are indirectly referenced by hazard ptrs. An instance of this
-// class only contains one type of pointer.
+// pointers (ThreadsList references), either for value comparison or to
+// remember which ThreadsLists have already been searched.
 //
 class ThreadScanHashtable : public CHeapObj<mtThread> {
  private:
@@ -214,44 +213,43 @@ class ThreadScanHashtable : public CHeapObj<mtThread> {
   }
 };
 
-// Closure to gather JavaThreads indirectly referenced by hazard ptrs
-// (ThreadsList references) into a hash table. This closure handles part 2
-// of the dance - adding all the JavaThreads referenced by the hazard
-// pointer (ThreadsList reference) to the hash table.
+// Closure to determine if a JavaThread is indirectly referenced by hazard
+// ptrs (ThreadsList references). Each distinct ThreadsList is searched at
+// most once, so many threads sharing the same hazard ptr do not each pay
+// for a walk over that ThreadsList.
 //
-class AddThreadHazardPointerThreadClosure : public ThreadClosure {
+class ScanHazardPtrProtectsThreadClosure : public ThreadClosure {
  private:
-  ThreadScanHashtable *_table;
+  JavaThread* const _target;
+  // ThreadsLists that have already been searched for _target.
+  ThreadScanHashtable* const _searched_lists;
+  bool _is_protected;
 
  public:
-  AddThreadHazardPointerThreadClosure(ThreadScanHashtable *table) : _table(table) {}
+  ScanHazardPtrProtectsThreadClosure(JavaThread* target, ThreadScanHashtable* searched_lists) :
+    _target(target), _searched_lists(searched_lists), _is_protected(false) {}
 
-  virtual void do_thread(Thread *thread) {
-    if (!_table->has_entry((void*)thread)) {
-      // The same JavaThread might be on more than one ThreadsList or
-      // more than one thread might be using the same ThreadsList. In
-      // either case, we only need a single entry for a JavaThread.
-      _table->add_entry((void*)thread);
+  bool is_protected() const { return _is_protected; }
+
+  // Searches 'list' for _target unless it has been searched before.
+  void search_list(ThreadsList* list) {
+    if (!_searched_lists->has_entry((void*)list)) {
+      _searched_lists->add_entry((void*)list);
+      if (list->includes(_target)) {
+        _is_protected = true;
+      }
     }
   }
-};
-
-// Closure to gather JavaThreads indirectly referenced by hazard ptrs
-// (ThreadsList references) into a hash table. This closure handles part 1
-// of the dance - hazard ptr chain walking and dispatch to another
-// closure.
-//
-class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
- private:
-  ThreadScanHashtable *_table;
- public:
-  ScanHazardPtrGatherProtectedThreadsClosure(ThreadScanHashtable *table) : _table(table) {}
 
   virtual void do_thread(Thread *thread) {
     assert_locked_or_safepoint(Threads_lock);
 
     if (thread == NULL) return;
 
+    // Once _target is known to be protected the caller has to wait
+    // and scan again, so the remaining hazard ptrs do not matter.
+    if (_is_protected) return;
+
     // This code races with ThreadsSMRSupport::acquire_stable_list() which
     // is lock-free so we have to handle some special situations.
     //
@@ -285,8 +283,7 @@ class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
     // ThreadsList that has been removed but not freed. In either case,
     // the hazard ptr is protecting all the JavaThreads on that
     // ThreadsList.
-    AddThreadHazardPointerThreadClosure add_cl(_table);
-    current_list->threads_do(&add_cl);
+    search_list(current_list);
   }
 };
 
@@ -933,8 +930,10 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
     log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is not freed.", os::current_thread_id(), p2i(threads));
   }
 
+#ifdef ASSERT
   ValidateHazardPtrsClosure validate_cl;
   threads_do(&validate_cl);
+#endif
 
   delete scan_table;
 }
@@ -945,10 +944,9 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
 bool ThreadsSMRSupport::is_a_protected_JavaThread(JavaThread *thread) {
   assert_locked_or_safepoint(Threads_lock);
 
-  // Gather a hash table of the JavaThreads indirectly referenced by
-  // hazard ptrs.
-  ThreadScanHashtable *scan_table = new ThreadScanHashtable();
-  ScanHazardPtrGatherProtectedThreadsClosure scan_cl(scan_table);
+  // Search the ThreadsLists referenced by hazard ptrs for the JavaThread.
+  ThreadScanHashtable *searched_lists = new ThreadScanHashtable();
+  ScanHazardPtrProtectsThreadClosure scan_cl(thread, searched_lists);
   threads_do(&scan_cl);
   OrderAccess::acquire(); // Must order reads of hazard ptr before reads of
                           // nested reference counters
@@ -957,21 +955,17 @@ bool ThreadsSMRSupport::is_a_protected_JavaThread(JavaThread *thread) {
   // and include the ones that are currently in use by a nested
   // ThreadsListHandle in the search set.
   ThreadsList* current = _to_delete_list;
-  while (current != NULL) {
+  while (current != NULL && !scan_cl.is_protected()) {
     if (current->_nested_handle_cnt != 0) {
       // 'current' is in use by a nested ThreadsListHandle so the hazard
       // ptr is protecting all the JavaThreads on that ThreadsList.
-      AddThreadHazardPointerThreadClosure add_cl(scan_table);
-      current->threads_do(&add_cl);
+      scan_cl.search_list(current);
     }
     current = current->next_list();
   }
 
-  bool thread_is_protected = false;
-  if (scan_table->has_entry((void*)thread)) {
-    thread_is_protected = true;
-  }
-  delete scan_table;
+  bool thread_is_protected = scan_cl.is_protected();
+  delete searched_lists;
   return thread_is_protected;
 }
 
@@ -43,16 +43,19 @@
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/os.hpp"
+#include "runtime/threadSMR.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/diagnosticArgument.hpp"
 #include "services/diagnosticCommand.hpp"
 #include "services/diagnosticFramework.hpp"
 #include "services/heapDumper.hpp"
+#include "services/heapDumperCompression.hpp"
 #include "services/management.hpp"
 #include "services/writeableFlags.hpp"
 #include "utilities/debug.hpp"
@@ -478,31 +481,66 @@ HeapDumpDCmd::HeapDumpDCmd(outputStream* output, bool heap) :
   _gzip("-gz", "If specified, the heap dump is written in gzipped format "
                "using the given compression level. 1 (recommended) is the fastest, "
                "9 the strongest compression.", "INT", false, "1"),
+  _compressor("-compressor", "The compression format used with -gz: gzip, zstd or lz4. "
+               "zstd accepts levels from 1 to 19, lz4 ignores the level. "
+               "zstd and lz4 need the corresponding library to be installed on the system.",
+               "STRING", false, "gzip"),
   _overwrite("-overwrite", "If specified, the dump file will be overwritten if it exists",
+           "BOOLEAN", false, "false"),
+  _parallel("-parallel",
+       "Number of parallel threads to use for heap dump. "
+       "0 means let the VM determine the number of threads to use. "
+       "1 (the default) means use one thread (disable parallelism).",
+       "INT", false, "1"),
+  _segmented("-segmented", "If specified together with -parallel, each dump thread writes "
+           "its part of the heap to a separate file <filename>.seg<n>. The files listed in "
+           "<filename>.index must be concatenated in that order to get a complete dump.",
            "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_all);
   _dcmdparser.add_dcmd_argument(&_filename);
   _dcmdparser.add_dcmd_option(&_gzip);
+  _dcmdparser.add_dcmd_option(&_compressor);
   _dcmdparser.add_dcmd_option(&_overwrite);
+  _dcmdparser.add_dcmd_option(&_parallel);
+  _dcmdparser.add_dcmd_option(&_segmented);
 }
 
 void HeapDumpDCmd::execute(DCmdSource source, TRAPS) {
   jlong level = -1; // -1 means no compression.
+  const char* compressor = _compressor.value();
+
+  if (!HeapDumpCompressors::is_supported(compressor)) {
+    output()->print_cr("Unknown compressor: %s (must be gzip, zstd or lz4)", compressor);
+    return;
+  }
 
   if (_gzip.is_set()) {
     level = _gzip.value();
+    int max_level = HeapDumpCompressors::max_level(compressor);
 
-    if (level < 1 || level > 9) {
-      output()->print_cr("Compression level out of range (1-9): " JLONG_FORMAT, level);
+    if (level < 1 || level > max_level) {
+      output()->print_cr("Compression level out of range (1-%d): " JLONG_FORMAT, max_level, level);
       return;
     }
+  } else if (_compressor.is_set()) {
+    level = 1;
   }
 
+  jlong num = _parallel.value();
+  if (num < 0) {
+    output()->print_cr("Parallel thread number out of range (>=0): " JLONG_FORMAT, num);
+    return;
+  }
+  uint parallel_thread_num = num == 0
+      ? MAX2<uint>(1, (uint)os::initial_active_processor_count() * 3 / 8)
+      : (uint)num;
+
   // Request a full GC before heap dump if _all is false
   // This helps reduces the amount of unreachable objects in the dump
   // and makes it easier to browse.
   HeapDumper dumper(!_all.value() /* request GC if _all is false*/);
-  dumper.dump(_filename.value(), output(), (int) level, _overwrite.value());
+  dumper.dump(_filename.value(), output(), (int) level, _overwrite.value(),
+              parallel_thread_num, _segmented.value(), compressor);
 }
 
 ClassHistogramDCmd::ClassHistogramDCmd(outputStream* output, bool heap) :
@@ -540,12 +578,64 @@ void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
                                DCmdWithParser(output, heap),
   _locks("-l", "print java.util.concurrent locks", "BOOLEAN", false, "false"),
-  _extended("-e", "print extended thread information", "BOOLEAN", false, "false") {
+  _extended("-e", "print extended thread information", "BOOLEAN", false, "false"),
+  _handshake("-handshake", "capture each thread in its own handshake instead of "
+             "a global safepoint; stacks are not a consistent snapshot and "
+             "deadlocks are not detected", "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_locks);
   _dcmdparser.add_dcmd_option(&_extended);
+  _dcmdparser.add_dcmd_option(&_handshake);
+}
+
+// Prints one Java thread and its stack. Runs either by the target thread
+// itself or by the requesting thread while the target is handshake-safe.
+class PrintThreadClosure : public HandshakeClosure {
+  outputStream* _out;
+  bool _print_extended_info;
+ public:
+  PrintThreadClosure(outputStream* out, bool print_extended_info) :
+    HandshakeClosure("PrintThread"),
+    _out(out),
+    _print_extended_info(print_extended_info) {}
+
+  void do_thread(Thread* thread) {
+    JavaThread* jt = JavaThread::cast(thread);
+    ResourceMark rm;
+    jt->print_on(_out, _print_extended_info);
+    jt->print_stack_on(_out);
+    _out->cr();
+  }
+};
+
+void ThreadDumpDCmd::print_threads_with_handshakes(TRAPS) {
+  char buf[32];
+  output()->print_raw_cr(os::local_time_string(buf, sizeof(buf)));
+  output()->print_cr("Full thread dump %s (%s %s), per-thread handshakes:",
+                     VM_Version::vm_name(),
+                     VM_Version::vm_release(),
+                     VM_Version::vm_info_string());
+  output()->cr();
+
+  PrintThreadClosure cl(output(), _extended.value());
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* jt = jtiwh.next(); ) {
+    if (jt == THREAD) {
+      cl.do_thread(jt);
+    } else {
+      Handshake::execute(&cl, jt);
+    }
+  }
 }
 
 void ThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
+  if (_handshake.value()) {
+    if (_locks.value()) {
+      output()->print_cr("-l requires a safepoint and cannot be combined with -handshake");
+      return;
+    }
+    print_threads_with_handshakes(THREAD);
+    return;
+  }
+
   // thread stacks and JNI global handles
   VM_PrintThreads op1(output(), _locks.value(), _extended.value(), true /* print JNI handle info */);
   VMThread::execute(&op1);
@@ -314,7 +314,10 @@ protected:
   DCmdArgument<char*> _filename;
   DCmdArgument<bool>  _all;
   DCmdArgument<jlong> _gzip;
+  DCmdArgument<char*> _compressor;
   DCmdArgument<bool> _overwrite;
+  DCmdArgument<jlong> _parallel;
+  DCmdArgument<bool> _segmented;
 public:
   HeapDumpDCmd(outputStream* output, bool heap);
   static const char* name() {
@@ -432,6 +435,8 @@ class ThreadDumpDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _locks;
   DCmdArgument<bool> _extended;
+  DCmdArgument<bool> _handshake;
+  void print_threads_with_handshakes(TRAPS);
 public:
   ThreadDumpDCmd(outputStream* output, bool heap);
   static const char* name() { return "Thread.print"; }
@@ -42,6 +42,7 @@
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
@@ -1798,6 +1799,13 @@ bool HeapObjectDumper::is_large(oop o) {
   return size > HeapDumpLargeObjectList::LargeObjectSizeThreshold;
 }
 
+// Used by a dumper whose segment file could not be created. The dumper still has to
+// take part in the parallel heap iteration, but it has nowhere to write the objects.
+class SkipObjectClosure : public ObjectClosure {
+ public:
+  void do_object(oop o) { }
+};
+
 // The dumper controller for parallel heap dump
 class DumperController : public CHeapObj<mtInternal> {
  private:
@@ -1865,6 +1873,13 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask {
   DumperController*       _dumper_controller;
   ParallelObjectIterator* _poi;
   HeapDumpLargeObjectList* _large_object_list;
+  // segmented parallel heap dump support
+  const char*             _segment_base;
+  int                     _compression;
+  const char*             _compressor_name;
+  bool                    _overwrite;
+  char const* volatile    _segment_error;
+  volatile julong         _segment_bytes;
 
   // VMDumperType is for thread that dumps both heap and non-heap data.
   static const size_t VMDumperType = 0;
@@ -1910,6 +1925,11 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask {
       // Number of dumper threads that only iterate heap.
       uint _heap_only_dumper_threads = _num_dumper_threads - 1 /* VMDumper thread */;
       _dumper_controller = new (std::nothrow) DumperController(_heap_only_dumper_threads);
+      if (is_segmented()) {
+        // Segment files are independent of the global writer, so the dumpers
+        // can iterate the heap while the VMDumper writes the non-heap data.
+        _dumper_controller->start_dump();
+      }
     }
   }
 
@@ -1961,8 +1981,23 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask {
   // large objects
   void dump_large_objects(ObjectClosure* writer);
 
+  // segmented parallel heap dump
+  bool is_segmented() const { return _segment_base != NULL && _num_dumper_threads > 1; }
+  void segment_path(char* buf, size_t buf_len, uint worker_id) const;
+  void dump_heap_segment(uint worker_id);
+  void write_segment_index();
+  void set_segment_error(char const* error) {
+    if (error != NULL) {
+      Atomic::cmpxchg(&_segment_error, (char const*)NULL, error);
+    }
+  }
+
  public:
-  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, uint num_dump_threads) :
+  // If segment_base is not NULL and the dump runs in parallel, each dumper thread
+  // writes its part of the heap into a segment file named after segment_base.
+  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, uint num_dump_threads,
+                const char* segment_base = NULL, int compression = -1, bool overwrite = false,
+                const char* compressor_name = "gzip") :
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
                     GCCause::_heap_dump /* GC Cause */,
                     0 /* total full collections, dummy, ignored */,
@@ -1977,6 +2012,12 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask {
     _dumper_controller = NULL;
     _poi = NULL;
     _large_object_list = new (std::nothrow) HeapDumpLargeObjectList();
+    _segment_base = segment_base;
+    _compression = compression;
+    _compressor_name = compressor_name;
+    _overwrite = overwrite;
+    _segment_error = NULL;
+    _segment_bytes = 0;
     if (oome) {
       assert(!Thread::current()->is_VM_thread(), "Dump from OutOfMemoryError cannot be called by the VMThread");
       // get OutOfMemoryError zero-parameter constructor
@@ -2009,6 +2050,11 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask {
   VMOp_Type type() const { return VMOp_HeapDumper; }
   void doit();
   void work(uint worker_id);
+
+  // Error encountered while writing the segment files, or NULL.
+  char const* segment_error() const { return _segment_error; }
+  // Number of bytes written to the segment files.
+  julong segment_bytes_written() const { return _segment_bytes; }
 };
 
 VM_HeapDumper* VM_HeapDumper::_global_dumper = NULL;
@@ -2269,7 +2315,7 @@ void VM_HeapDumper::work(uint worker_id) {
       writer()->writer_loop();
       return;
     }
-    if (_num_dumper_threads > 1 && get_worker_type(worker_id) == DumperType) {
+    if (_num_dumper_threads > 1 && get_worker_type(worker_id) == DumperType && !is_segmented()) {
       _dumper_controller->wait_for_start_signal();
     }
   } else {
@@ -2328,6 +2374,14 @@ void VM_HeapDumper::work(uint worker_id) {
   if (_num_dumper_threads <= 1) {
     HeapObjectDumper obj_dumper(writer());
     Universe::heap()->object_iterate(&obj_dumper);
+  } else if (is_segmented()) {
+    if (get_worker_type(worker_id) == VMDumperType) {
+      writer()->finish_dump_segment(true);
+    }
+    dump_heap_segment(worker_id);
+    if (get_worker_type(worker_id) == DumperType) {
+      return;
+    }
   } else {
     assert(get_worker_type(worker_id) == DumperType
           || get_worker_type(worker_id) == VMDumperType,
@@ -2364,12 +2418,95 @@ void VM_HeapDumper::work(uint worker_id) {
   // Use writer() rather than ParDumpWriter to avoid memory consumption.
   HeapObjectDumper obj_dumper(writer());
   dump_large_objects(&obj_dumper);
-  // Writes the HPROF_HEAP_DUMP_END record.
-  DumperSupport::end_of_dump(writer());
+  if (is_segmented()) {
+    // The HPROF_HEAP_DUMP_END record has been written to the last segment.
+    writer()->finish_dump_segment();
+    write_segment_index();
+  } else {
+    // Writes the HPROF_HEAP_DUMP_END record.
+    DumperSupport::end_of_dump(writer());
+  }
   // We are done with writing. Release the worker threads.
   writer()->deactivate();
 }
 
+void VM_HeapDumper::segment_path(char* buf, size_t buf_len, uint worker_id) const {
+  jio_snprintf(buf, buf_len, "%s.seg%u", _segment_base, worker_id);
+}
+
+// Segmented parallel dump: every dumper thread writes the objects it visits into
+// its own segment file with its own compression backend, so dumping scales with
+// the number of dumper threads instead of being serialized on the global writer.
+// The segment files only contain HPROF_HEAP_DUMP_SEGMENT records. The segment of
+// the VMDumper is listed last in the index and carries the HPROF_HEAP_DUMP_END
+// record, so concatenating the files in index order yields a regular HPROF file.
+void VM_HeapDumper::dump_heap_segment(uint worker_id) {
+  char path[JVM_MAXPATHLEN];
+  segment_path(path, sizeof(path), worker_id);
+
+  AbstractCompressor* compressor = NULL;
+  if (_compression > 0) {
+    compressor = HeapDumpCompressors::create(_compressor_name, _compression);
+  }
+
+  {
+    DumpWriter segment_writer(new (std::nothrow) FileWriter(path, _overwrite), compressor);
+    if (_compression > 0 && compressor == NULL) {
+      set_segment_error("Could not allocate compressor");
+    }
+    set_segment_error(segment_writer.error());
+
+    if (segment_writer.error() == NULL) {
+      HeapObjectDumper obj_dumper(&segment_writer, _large_object_list);
+      _poi->object_iterate(&obj_dumper, worker_id);
+      segment_writer.finish_dump_segment();
+    } else {
+      SkipObjectClosure skip;
+      _poi->object_iterate(&skip, worker_id);
+    }
+
+    if (get_worker_type(worker_id) == VMDumperType) {
+      _dumper_controller->wait_all_dumpers_complete();
+      if (segment_writer.error() == NULL) {
+        DumperSupport::end_of_dump(&segment_writer);
+      }
+    }
+
+    segment_writer.deactivate();
+    set_segment_error(segment_writer.error());
+    Atomic::add(&_segment_bytes, segment_writer.bytes_written());
+  }
+
+  if (get_worker_type(worker_id) == DumperType) {
+    _dumper_controller->dumper_complete();
+  }
+}
+
+// Write the index for a segmented dump. It lists the file names, relative to the
+// directory of the dump, in the order they have to be concatenated.
+void VM_HeapDumper::write_segment_index() {
+  char path[JVM_MAXPATHLEN];
+  jio_snprintf(path, sizeof(path), "%s.index", _segment_base);
+
+  const char* base_name = strrchr(_segment_base, *os::file_separator());
+  base_name = (base_name == NULL) ? _segment_base : base_name + 1;
+
+  FileWriter index_writer(path, _overwrite);
+  char const* error = index_writer.open_writer();
+  char line[JVM_MAXPATHLEN + 2];
+  if (error == NULL) {
+    jio_snprintf(line, sizeof(line), "%s\n", base_name);
+    error = index_writer.write_buf(line, (ssize_t)strlen(line));
+  }
+  for (uint i = 1; i <= _num_dumper_threads && error == NULL; i++) {
+    // The VMDumper segment (worker id 0) comes last.
+    uint worker_id = (i == _num_dumper_threads) ? VMDumperWorkerId : i;
+    jio_snprintf(line, sizeof(line), "%s.seg%u\n", base_name, worker_id);
+    error = index_writer.write_buf(line, (ssize_t)strlen(line));
+  }
+  set_segment_error(error);
+}
+
 void VM_HeapDumper::dump_stack_traces() {
   // write a HPROF_TRACE record without any frames to be referenced as object alloc sites
   DumperSupport::write_header(writer(), HPROF_TRACE, 3*sizeof(u4));
@@ -2434,8 +2571,11 @@ void VM_HeapDumper::dump_large_objects(ObjectClosure* cl) {
 }
 
 // dump the heap to given path.
-int HeapDumper::dump(const char* path, outputStream* out, int compression, bool overwrite, uint num_dump_threads) {
+int HeapDumper::dump(const char* path, outputStream* out, int compression, bool overwrite, uint num_dump_threads,
+                     bool segmented, const char* compressor_name) {
   assert(path != NULL && strlen(path) > 0, "path missing");
+  assert(compressor_name != NULL && HeapDumpCompressors::is_supported(compressor_name),
+         "unknown compressor");
 
   // print message in interactive case
   if (out != NULL) {
@@ -2448,10 +2588,10 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   AbstractCompressor* compressor = NULL;
 
   if (compression > 0) {
-    compressor = new (std::nothrow) GZipCompressor(compression);
+    compressor = HeapDumpCompressors::create(compressor_name, compression);
 
     if (compressor == NULL) {
-      set_error("Could not allocate gzip compressor");
+      set_error("Could not allocate compressor");
       return -1;
     }
   }
@@ -2468,7 +2608,8 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   }
 
   // generate the dump
-  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads);
+  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads,
+                       segmented ? path : NULL, compression, overwrite, compressor_name);
   if (Thread::current()->is_VM_thread()) {
     assert(SafepointSynchronize::is_at_safepoint(), "Expected to be called at a safepoint");
     dumper.doit();
@@ -2478,12 +2619,16 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
 
   // record any error that the writer may have encountered
   set_error(writer.error());
+  if (error() == NULL) {
+    set_error(dumper.segment_error());
+  }
+  julong bytes_written = writer.bytes_written() + dumper.segment_bytes_written();
 
   // emit JFR event
   if (error() == NULL) {
     event.set_destination(path);
     event.set_gcBeforeDump(_gc_before_heap_dump);
-    event.set_size(writer.bytes_written());
+    event.set_size(bytes_written);
     event.set_onOutOfMemoryError(_oome);
     event.commit();
   }
@@ -2493,13 +2638,13 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
     timer()->stop();
     if (error() == NULL) {
       out->print_cr("Heap dump file created [" JULONG_FORMAT " bytes in %3.3f secs]",
-                    writer.bytes_written(), timer()->seconds());
+                    bytes_written, timer()->seconds());
     } else {
-      out->print_cr("Dump file is incomplete: %s", writer.error());
+      out->print_cr("Dump file is incomplete: %s", error());
     }
   }
 
-  return (writer.error() == NULL) ? 0 : -1;
+  return (error() == NULL) ? 0 : -1;
 }
 
 // stop timer (if still active), and free any error string we might be holding
@@ -2557,7 +2702,12 @@ void HeapDumper::dump_heap(bool oome) {
   const int max_digit_chars = 20;
 
   const char* dump_file_name = "java_pid";
-  const char* dump_file_ext  = HeapDumpGzipLevel > 0 ? ".hprof.gz" : ".hprof";
+  // HeapDumpCompressorConstraintFunc rejects unsupported values, also when the
+  // manageable flag is set at runtime.
+  const char* compressor_name = HeapDumpCompressor;
+  char dump_file_ext[16];
+  jio_snprintf(dump_file_ext, sizeof(dump_file_ext), ".hprof%s",
+               HeapDumpGzipLevel > 0 ? HeapDumpCompressors::file_extension(compressor_name) : "");
 
   // The dump file defaults to java_pid<pid>.hprof in the current working
   // directory. HeapDumpPath=<file> can be used to specify an alternative
@@ -2624,6 +2774,6 @@ void HeapDumper::dump_heap(bool oome) {
 
   HeapDumper dumper(false /* no GC before heap dump */,
                     oome  /* pass along out-of-memory-error flag */);
-  dumper.dump(my_path, tty, HeapDumpGzipLevel);
+  dumper.dump(my_path, tty, HeapDumpGzipLevel, false, 1, false, compressor_name);
   os::free(my_path);
 }
@@ -72,7 +72,12 @@ class HeapDumper : public StackObj {
   // additional info is written to out if not NULL.
   // compression >= 0 creates a gzipped file with the given compression level.
   // parallel_thread_num >= 0 indicates thread numbers of parallel object dump
-  int dump(const char* path, outputStream* out = NULL, int compression = -1, bool overwrite = false, uint parallel_thread_num = 1);
+  // segmented - when dumping with several threads, each thread writes its part of the heap
+  // into a separate file "<path>.seg<n>". The files listed in "<path>.index" have to be
+  // concatenated in that order to get a complete dump.
+  // compressor_name selects the compression format, see HeapDumpCompressors.
+  int dump(const char* path, outputStream* out = NULL, int compression = -1, bool overwrite = false,
+           uint parallel_thread_num = 1, bool segmented = false, const char* compressor_name = "gzip");
 
   // returns error message (resource allocated), or NULL if no error
   char* error_as_C_string() const;
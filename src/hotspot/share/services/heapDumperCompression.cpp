@@ -31,9 +31,21 @@
 #include "services/heapDumperCompression.hpp"
 
 
+static bool is_fifo_file(const char* path) {
+  struct stat st;
+  if (os::stat(path, &st) != 0) {
+    return false;
+  }
+  return S_ISFIFO(st.st_mode);
+}
+
 char const* FileWriter::open_writer() {
   assert(_fd < 0, "Must not already be open");
 
+  if (is_fifo_file(_path)) {
+    return open_fifo();
+  }
+
   _fd = os::create_binary_file(_path, _overwrite);
 
   if (_fd < 0) {
@@ -43,6 +55,43 @@ char const* FileWriter::open_writer() {
   return NULL;
 }
 
+// Stream into an existing named pipe, e.g. one drained by a process that
+// ships the dump elsewhere. It is neither created nor truncated.
+//
+// A blocking open() of a FIFO waits until a reader opens it, which would
+// hang the dumping thread (and, for a jcmd, the VM operation) forever if
+// nobody ever does. So the pipe is opened non-blocking, which fails with
+// ENXIO when there is no reader, and then switched back to blocking mode.
+//
+// The writes are blocking, which is the flow control between the dump and
+// the reader: the dump proceeds as fast as the reader drains the pipe. The
+// flip side is that a reader which stalls without closing the pipe blocks
+// the dump, and the safepoint it runs in, indefinitely.
+char const* FileWriter::open_fifo() {
+#ifdef _WINDOWS
+  return "Named pipes are not supported";
+#else
+  _fd = os::open(_path, O_WRONLY | O_NONBLOCK, 0);
+
+  if (_fd < 0) {
+    if (errno == ENXIO) {
+      return "No process has the named pipe open for reading";
+    }
+    return os::strerror(errno);
+  }
+
+  int flags = ::fcntl(_fd, F_GETFL);
+  if (flags == -1 || ::fcntl(_fd, F_SETFL, flags & ~O_NONBLOCK) == -1) {
+    char const* msg = os::strerror(errno);
+    os::close(_fd);
+    _fd = -1;
+    return msg;
+  }
+
+  return NULL;
+#endif
+}
+
 FileWriter::~FileWriter() {
   if (_fd >= 0) {
     os::close(_fd);
@@ -54,10 +103,16 @@ char const* FileWriter::write_buf(char* buf, ssize_t size) {
   assert(_fd >= 0, "Must be open");
   assert(size > 0, "Must write at least one byte");
 
-  ssize_t n = (ssize_t) os::write(_fd, buf, (uint) size);
+  // Pipes may accept less than the full buffer.
+  while (size > 0) {
+    ssize_t n = (ssize_t) os::write(_fd, buf, (uint) size);
 
-  if (n <= 0) {
-    return os::strerror(errno);
+    if (n <= 0) {
+      return os::strerror(errno);
+    }
+
+    buf += n;
+    size -= n;
   }
 
   return NULL;
@@ -136,6 +191,230 @@ char const* GZipCompressor::compress(char* in, size_t in_size, char* out, size_t
   return msg;
 }
 
+
+// Used to write the block size as a comment into the first frame. The zstd and
+// lz4 formats both skip frames with a magic number in this range.
+static const u4 SkippableFrameMagic = 0x184D2A50;
+
+static size_t write_block_size_frame(char* out, size_t out_size, size_t block_size) {
+  char buf[128];
+  jio_snprintf(buf, sizeof(buf), "HPROF BLOCKSIZE=" SIZE_FORMAT, block_size);
+  u4 len = (u4) strlen(buf);
+
+  if (out_size < len + 8) {
+    return 0;
+  }
+
+  // Frame header fields are little-endian.
+  u1* p = (u1*) out;
+  for (int i = 0; i < 4; i++) {
+    p[i] = (u1) (SkippableFrameMagic >> (8 * i));
+    p[4 + i] = (u1) (len >> (8 * i));
+  }
+  memcpy(out + 8, buf, len);
+
+  return len + 8;
+}
+
+// Loads a compression library installed on the system. Tries the unversioned
+// library name first and then the name with the major version, which is the
+// only one available if the development package is not installed.
+static void* load_system_lib(char const* lib_name, char const* major_version) {
+  char name[JVM_MAXPATHLEN];
+  char versioned_name[JVM_MAXPATHLEN];
+  char ebuf[1024];
+
+  if (!os::dll_build_name(name, sizeof(name), lib_name)) {
+    return NULL;
+  }
+
+  void* handle = os::dll_load(name, ebuf, sizeof ebuf);
+
+  if (handle == NULL) {
+#ifdef __APPLE__
+    // libfoo.1.dylib
+    jio_snprintf(versioned_name, sizeof(versioned_name), "%s.%s", lib_name, major_version);
+    if (!os::dll_build_name(versioned_name, sizeof(versioned_name), versioned_name)) {
+      return NULL;
+    }
+#else
+    // libfoo.so.1
+    jio_snprintf(versioned_name, sizeof(versioned_name), "%s.%s", name, major_version);
+#endif
+    handle = os::dll_load(versioned_name, ebuf, sizeof ebuf);
+  }
+
+  return handle;
+}
+
+
+typedef size_t (*ZstdCompressBoundFunc)(size_t);
+typedef size_t (*ZstdCompressFunc)(void*, size_t, const void*, size_t, int);
+typedef unsigned (*ZstdIsErrorFunc)(size_t);
+
+static ZstdCompressBoundFunc zstd_compress_bound_func;
+static ZstdCompressFunc zstd_compress_func;
+static ZstdIsErrorFunc zstd_is_error_func;
+
+char const* ZstdCompressor::init(size_t block_size, size_t* needed_out_size,
+                                 size_t* needed_tmp_size) {
+  _block_size = block_size;
+  _is_first = true;
+
+  {
+    // Parallel dump writers may initialize their compressors concurrently.
+    // Once published, the function pointers never change.
+    MutexLocker locker(Zip_lock, Monitor::_no_safepoint_check_flag);
+
+    if (zstd_compress_func == NULL) {
+      void* lib = load_system_lib("zstd", "1");
+
+      if (lib == NULL) {
+        return "Cannot load the zstd library";
+      }
+
+      ZstdCompressBoundFunc bound_func = (ZstdCompressBoundFunc) os::dll_lookup(lib, "ZSTD_compressBound");
+      ZstdIsErrorFunc is_error_func = (ZstdIsErrorFunc) os::dll_lookup(lib, "ZSTD_isError");
+      ZstdCompressFunc compress_func = (ZstdCompressFunc) os::dll_lookup(lib, "ZSTD_compress");
+
+      if (bound_func == NULL || is_error_func == NULL || compress_func == NULL) {
+        return "Cannot load the zstd library";
+      }
+
+      zstd_compress_bound_func = bound_func;
+      zstd_is_error_func = is_error_func;
+      zstd_compress_func = compress_func;
+    }
+  }
+
+  *needed_out_size = zstd_compress_bound_func(block_size) + 1024; // Extra space for the block size frame.
+  *needed_tmp_size = 0;
+
+  return NULL;
+}
+
+char const* ZstdCompressor::compress(char* in, size_t in_size, char* out, size_t out_size,
+                                     char* tmp, size_t tmp_size, size_t* compressed_size) {
+  size_t header_size = 0;
+
+  if (_is_first) {
+    header_size = write_block_size_frame(out, out_size, _block_size);
+    _is_first = false;
+  }
+
+  size_t result = zstd_compress_func(out + header_size, out_size - header_size, in, in_size, _level);
+
+  if (zstd_is_error_func(result)) {
+    *compressed_size = 0;
+    return "zstd compression failed";
+  }
+
+  *compressed_size = header_size + result;
+
+  return NULL;
+}
+
+
+typedef size_t (*LZ4FCompressFrameBoundFunc)(size_t, const void*);
+typedef size_t (*LZ4FCompressFrameFunc)(void*, size_t, const void*, size_t, const void*);
+typedef unsigned (*LZ4FIsErrorFunc)(size_t);
+
+static LZ4FCompressFrameBoundFunc lz4f_compress_frame_bound_func;
+static LZ4FCompressFrameFunc lz4f_compress_frame_func;
+static LZ4FIsErrorFunc lz4f_is_error_func;
+
+char const* LZ4Compressor::init(size_t block_size, size_t* needed_out_size,
+                                size_t* needed_tmp_size) {
+  _block_size = block_size;
+  _is_first = true;
+
+  {
+    // See ZstdCompressor::init().
+    MutexLocker locker(Zip_lock, Monitor::_no_safepoint_check_flag);
+
+    if (lz4f_compress_frame_func == NULL) {
+      void* lib = load_system_lib("lz4", "1");
+
+      if (lib == NULL) {
+        return "Cannot load the lz4 library";
+      }
+
+      LZ4FCompressFrameBoundFunc bound_func = (LZ4FCompressFrameBoundFunc) os::dll_lookup(lib, "LZ4F_compressFrameBound");
+      LZ4FIsErrorFunc is_error_func = (LZ4FIsErrorFunc) os::dll_lookup(lib, "LZ4F_isError");
+      LZ4FCompressFrameFunc compress_func = (LZ4FCompressFrameFunc) os::dll_lookup(lib, "LZ4F_compressFrame");
+
+      if (bound_func == NULL || is_error_func == NULL || compress_func == NULL) {
+        return "Cannot load the lz4 library";
+      }
+
+      lz4f_compress_frame_bound_func = bound_func;
+      lz4f_is_error_func = is_error_func;
+      lz4f_compress_frame_func = compress_func;
+    }
+  }
+
+  // NULL preferences select the default frame parameters and compression level.
+  *needed_out_size = lz4f_compress_frame_bound_func(block_size, NULL) + 1024; // Extra space for the block size frame.
+  *needed_tmp_size = 0;
+
+  return NULL;
+}
+
+char const* LZ4Compressor::compress(char* in, size_t in_size, char* out, size_t out_size,
+                                    char* tmp, size_t tmp_size, size_t* compressed_size) {
+  size_t header_size = 0;
+
+  if (_is_first) {
+    header_size = write_block_size_frame(out, out_size, _block_size);
+    _is_first = false;
+  }
+
+  size_t result = lz4f_compress_frame_func(out + header_size, out_size - header_size, in, in_size, NULL);
+
+  if (lz4f_is_error_func(result)) {
+    *compressed_size = 0;
+    return "lz4 compression failed";
+  }
+
+  *compressed_size = header_size + result;
+
+  return NULL;
+}
+
+
+bool HeapDumpCompressors::is_supported(const char* name) {
+  return strcmp(name, "gzip") == 0 || strcmp(name, "zstd") == 0 || strcmp(name, "lz4") == 0;
+}
+
+int HeapDumpCompressors::max_level(const char* name) {
+  assert(is_supported(name), "unknown compressor %s", name);
+  if (strcmp(name, "zstd") == 0) {
+    return 19;
+  }
+  // The level is ignored for lz4, so accept the same range as for gzip.
+  return 9;
+}
+
+const char* HeapDumpCompressors::file_extension(const char* name) {
+  assert(is_supported(name), "unknown compressor %s", name);
+  if (strcmp(name, "zstd") == 0) {
+    return ".zst";
+  } else if (strcmp(name, "lz4") == 0) {
+    return ".lz4";
+  }
+  return ".gz";
+}
+
+AbstractCompressor* HeapDumpCompressors::create(const char* name, int level) {
+  assert(is_supported(name), "unknown compressor %s", name);
+  if (strcmp(name, "zstd") == 0) {
+    return new (std::nothrow) ZstdCompressor(level);
+  } else if (strcmp(name, "lz4") == 0) {
+    return new (std::nothrow) LZ4Compressor();
+  }
+  return new (std::nothrow) GZipCompressor(level);
+}
+
 WorkList::WorkList() {
   _head._next = &_head;
   _head._prev = &_head;
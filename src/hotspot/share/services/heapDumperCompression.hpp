@@ -64,6 +64,8 @@ private:
   bool _overwrite;
   int _fd;
 
+  char const* open_fifo();
+
 public:
   FileWriter(char const* path, bool overwrite) : _path(path), _overwrite(overwrite), _fd(-1) { }
 
@@ -97,6 +99,62 @@ public:
                                char* tmp, size_t tmp_size, size_t* compressed_size);
 };
 
+// A compressor using the zstd format. Uses the zstd library installed on the system.
+// Every block is written as an independent zstd frame, so the dump can be
+// decompressed in parallel by splitting it at the frame boundaries.
+class ZstdCompressor : public AbstractCompressor {
+private:
+  int _level;
+  size_t _block_size;
+  bool _is_first;
+
+public:
+  ZstdCompressor(int level) : _level(level), _block_size(0), _is_first(false) {
+  }
+
+  virtual char const* init(size_t block_size, size_t* needed_out_size,
+                           size_t* needed_tmp_size);
+
+  virtual char const* compress(char* in, size_t in_size, char* out, size_t out_size,
+                               char* tmp, size_t tmp_size, size_t* compressed_size);
+};
+
+// A compressor using the lz4 frame format. Uses the lz4 library installed on the
+// system. Like for zstd, every block is written as an independent frame. The lz4
+// library is always used with its default (fastest) compression level.
+class LZ4Compressor : public AbstractCompressor {
+private:
+  size_t _block_size;
+  bool _is_first;
+
+public:
+  LZ4Compressor() : _block_size(0), _is_first(false) {
+  }
+
+  virtual char const* init(size_t block_size, size_t* needed_out_size,
+                           size_t* needed_tmp_size);
+
+  virtual char const* compress(char* in, size_t in_size, char* out, size_t out_size,
+                               char* tmp, size_t tmp_size, size_t* compressed_size);
+};
+
+// Maps the compressor names accepted by GC.heap_dump and -XX:HeapDumpCompressor
+// to the compressor implementations.
+class HeapDumpCompressors : AllStatic {
+public:
+  // Returns true if name is "gzip", "zstd" or "lz4".
+  static bool is_supported(const char* name);
+
+  // The highest compression level the named compressor accepts.
+  static int max_level(const char* name);
+
+  // The file extension conventionally used for files written by the named compressor.
+  static const char* file_extension(const char* name);
+
+  // Creates the named compressor for the given level. Returns NULL if out of memory.
+  static AbstractCompressor* create(const char* name, int level);
+};
+
 
 // The data needed to write a single buffer (and compress it optionally).
 struct WriteWork {
@@ -29,9 +29,11 @@
 #include "memory/allocation.inline.hpp"
 #include "utilities/elfFuncDescTable.hpp"
 #include "utilities/elfSymbolTable.hpp"
+#include "utilities/quickSort.hpp"
 
 ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
-  _next(NULL), _fd(file), _section(file, shdr) {
+  _next(NULL), _fd(file), _section(file, shdr),
+  _func_index(NULL), _func_index_length(0), _func_index_max_size(0), _func_index_built(false) {
   assert(file != NULL, "null file handle");
   _status = _section.status();
 
@@ -44,6 +46,88 @@ ElfSymbolTable::~ElfSymbolTable() {
   if (_next != NULL) {
     delete _next;
   }
+  if (_func_index != NULL) {
+    FREE_C_HEAP_ARRAY(const Elf_Sym*, _func_index);
+  }
+}
+
+static int compare_func_sym(const Elf_Sym* a, const Elf_Sym* b) {
+  if (a->st_value != b->st_value) {
+    return a->st_value < b->st_value ? -1 : 1;
+  }
+  // Keep symbols with the same address in section order.
+  return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+void ElfSymbolTable::build_func_index() {
+  assert(!_func_index_built, "index already built");
+  _func_index_built = true;
+
+  const Elf_Sym* symbols = (const Elf_Sym*)_section.section_data();
+  assert(symbols != NULL, "section must be cached");
+  int count = _section.section_header()->sh_size / sizeof(Elf_Sym);
+
+  int length = 0;
+  for (int index = 0; index < count; index ++) {
+    if (STT_FUNC == ELF_ST_TYPE(symbols[index].st_info) && symbols[index].st_size > 0) {
+      length ++;
+    }
+  }
+  if (length == 0) {
+    return;
+  }
+
+  // Not enough memory for the index is okay, lookups walk the section instead.
+  const Elf_Sym** func_index = NEW_C_HEAP_ARRAY_RETURN_NULL(const Elf_Sym*, length, mtInternal);
+  if (func_index == NULL) {
+    return;
+  }
+  int pos = 0;
+  Elf_Word max_size = 0;
+  for (int index = 0; index < count; index ++) {
+    if (STT_FUNC == ELF_ST_TYPE(symbols[index].st_info) && symbols[index].st_size > 0) {
+      func_index[pos ++] = &symbols[index];
+      max_size = MAX2(max_size, (Elf_Word)symbols[index].st_size);
+    }
+  }
+  QuickSort::sort(func_index, length, compare_func_sym, true);
+  _func_index = func_index;
+  _func_index_length = length;
+  _func_index_max_size = max_size;
+}
+
+bool ElfSymbolTable::lookup_func_index(address addr, int* stringtableIndex, int* posIndex, int* offset) {
+  assert(_func_index != NULL, "no index");
+  // Find the last symbol starting at or below addr.
+  int low = 0;
+  int high = _func_index_length;
+  while (low < high) {
+    int mid = low + (high - low) / 2;
+    if ((address)_func_index[mid]->st_value <= addr) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low == 0) {
+    return false;
+  }
+  // Symbols may nest or overlap, and the linear walk returns the first
+  // covering symbol in section order. Any symbol covering addr starts less
+  // than _func_index_max_size bytes below it, so scan back that far and
+  // pick the covering symbol with the lowest section position.
+  const Elf_Sym* found = NULL;
+  for (int index = low - 1; index >= 0; index --) {
+    const Elf_Sym* sym = _func_index[index];
+    size_t distance = (size_t)(addr - (address)sym->st_value);
+    if (distance >= _func_index_max_size) {
+      break;
+    }
+    if (distance < (Elf_Word)sym->st_size && (found == NULL || sym < found)) {
+      found = sym;
+    }
+  }
+  return found != NULL && compare(found, addr, stringtableIndex, posIndex, offset, NULL);
 }
 
 bool ElfSymbolTable::compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
@@ -81,6 +165,17 @@ bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex,
   Elf_Sym* symbols = (Elf_Sym*)_section.section_data();
 
   if (symbols != NULL) {
+    // Function descriptors (PPC64) make the symbol value differ from the
+    // code address, so the sorted index is only used without them.
+    if (funcDescTable == NULL) {
+      if (!_func_index_built) {
+        build_func_index();
+      }
+      if (_func_index != NULL &&
+          lookup_func_index(addr, stringtableIndex, posIndex, offset)) {
+        return true;
+      }
+    }
     for (int index = 0; index < count; index ++) {
       if (compare(&symbols[index], addr, stringtableIndex, posIndex, offset, funcDescTable)) {
         return true;
@@ -50,6 +50,14 @@ private:
   ElfSection      _section;
 
   NullDecoder::decoder_status _status;
+
+  // Function symbols of the cached section, sorted by start address. Built
+  // lazily on the first lookup that can use it; NULL if unavailable.
+  const Elf_Sym**  _func_index;
+  int              _func_index_length;
+  // Largest st_size in the index, bounds the backward scan in lookups
+  Elf_Word         _func_index_max_size;
+  bool             _func_index_built;
 public:
   ElfSymbolTable(FILE* const file, Elf_Shdr& shdr);
   ~ElfSymbolTable();
@@ -63,6 +71,9 @@ private:
   void set_next(ElfSymbolTable* next) { _next = next; }
 
   bool compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable);
+
+  void build_func_index();
+  bool lookup_func_index(address addr, int* stringtableIndex, int* posIndex, int* offset);
 };
 
 #endif // !_WINDOWS and !__APPLE__
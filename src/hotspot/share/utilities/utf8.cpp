@@ -102,6 +102,20 @@ int UTF8::unicode_length(const char* str, int len, bool& is_latin1, bool& has_mu
   is_latin1 = true;
   unsigned char prev = 0;
   for (int i = 0; i < len; i++) {
+    // Skip eight ASCII bytes at a time; they are neither continuation
+    // bytes nor lead bytes of non-Latin1 characters.
+    while (prev < 0x80 && i + (int)sizeof(uint64_t) <= len) {
+      uint64_t word;
+      memcpy(&word, str + i, sizeof(word));
+      if ((word & UCONST64(0x8080808080808080)) != 0) {
+        break;
+      }
+      i += sizeof(uint64_t);
+      prev = 0;
+    }
+    if (i == len) {
+      break;
+    }
     unsigned char c = str[i];
     if ((c & 0xC0) == 0x80) {
       // Multibyte, check if valid latin1 character.
@@ -328,21 +342,19 @@ jint UTF8::get_supplementary_character(const unsigned char* str) {
 bool UTF8::is_legal_utf8(const unsigned char* buffer, int length,
                          bool version_leq_47) {
   int i = 0;
-  int count = length >> 2;
-  for (int k=0; k<count; k++) {
-    unsigned char b0 = buffer[i];
-    unsigned char b1 = buffer[i+1];
-    unsigned char b2 = buffer[i+2];
-    unsigned char b3 = buffer[i+3];
-    // For an unsigned char v,
-    // (v | v - 1) is < 128 (highest bit 0) for 0 < v < 128;
-    // (v | v - 1) is >= 128 (highest bit 1) for v == 0 or v >= 128.
-    unsigned char res = b0 | b0 - 1 |
-                        b1 | b1 - 1 |
-                        b2 | b2 - 1 |
-                        b3 | b3 - 1;
-    if (res >= 128) break;
-    i += 4;
+  // Check eight bytes at a time. For an unsigned char v,
+  // (v | v - 1) is < 128 (highest bit 0) for 0 < v < 128;
+  // (v | v - 1) is >= 128 (highest bit 1) for v == 0 or v >= 128.
+  // Done on a whole word, a borrow can only cross into a byte from a
+  // zero byte below it, which fails the test anyway.
+  const uint64_t ones = UCONST64(0x0101010101010101);
+  const uint64_t highs = UCONST64(0x8080808080808080);
+  for (; i + (int)sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, buffer + i, sizeof(word));
+    if (((word | (word - ones)) & highs) != 0) {
+      break;
+    }
   }
   for(; i < length; i++) {
     unsigned short c;
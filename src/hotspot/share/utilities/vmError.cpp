@@ -1844,10 +1844,14 @@ bool VMError::check_timeout() {
 
   const jlong step_start_time_l = get_step_start_time();
   if (step_start_time_l > 0) {
-    // A step times out after a quarter of the total timeout. Steps are mostly fast unless they
-    // hang for some reason, so this simple rule allows for three hanging step and still
-    // hopefully leaves time enough for the rest of the steps to finish.
-    const jlong end = step_start_time_l + (jlong)ErrorLogTimeout * TIMESTAMP_TO_SECONDS_FACTOR / 4;
+    // By default a step times out after a quarter of the total timeout. Steps are mostly fast
+    // unless they hang for some reason, so this simple rule allows for three hanging step and
+    // still hopefully leaves time enough for the rest of the steps to finish. ErrorLogStepTimeout
+    // allows a tighter per-step budget, so that more of the later steps get to run.
+    const jlong step_timeout = (ErrorLogStepTimeout > 0)
+      ? (jlong)ErrorLogStepTimeout * TIMESTAMP_TO_SECONDS_FACTOR
+      : (jlong)ErrorLogTimeout * TIMESTAMP_TO_SECONDS_FACTOR / 4;
+    const jlong end = step_start_time_l + step_timeout;
     if (end <= now && !_step_did_timeout) {
       // The step timed out and we haven't interrupted the reporting
       // thread yet.
@@ -57,6 +57,13 @@ readSingle(JNIEnv *env, jobject this, jfieldID fid) {
  */
 #define BUF_SIZE 8192
 
+/* The maximum size of a malloc'ed buffer used to write a large array in
+ * chunks. It is kept below the default glibc mmap threshold (128 KB) so
+ * that large writes do not map and unmap a fresh buffer on every call.
+ * Writes in append mode are not split, see writeBytes.
+ */
+#define MAX_MALLOC_SIZE 65536
+
 /*
  * Returns true if the array slice defined by the given offset and length
  * is out of bounds.
@@ -149,6 +156,7 @@ writeBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     jint n;
     char stackBuf[BUF_SIZE];
     char *buf = NULL;
+    jint bufSize;
     FD fd;
 
     if (IS_NULL(bytes)) {
@@ -164,37 +172,55 @@ writeBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     if (len == 0) {
         return;
     } else if (len > BUF_SIZE) {
-        buf = malloc(len);
+        /* In append mode each write(2) is appended atomically, so other
+         * appenders cannot interleave with it. Keep that for the whole
+         * slice by copying it into one buffer and writing it in one call.
+         */
+        if (append == JNI_TRUE || len <= MAX_MALLOC_SIZE) {
+            bufSize = len;
+        } else {
+            bufSize = MAX_MALLOC_SIZE;
+        }
+        buf = malloc(bufSize);
         if (buf == NULL) {
             JNU_ThrowOutOfMemoryError(env, NULL);
             return;
         }
     } else {
+        bufSize = BUF_SIZE;
         buf = stackBuf;
     }
 
-    (*env)->GetByteArrayRegion(env, bytes, off, len, (jbyte *)buf);
-
-    if (!(*env)->ExceptionOccurred(env)) {
-        off = 0;
-        while (len > 0) {
+    /* Copy and write the array slice one buffer at a time */
+    while (len > 0) {
+        jint chunk = (len > bufSize) ? bufSize : len;
+        jint pos = 0;
+        (*env)->GetByteArrayRegion(env, bytes, off, chunk, (jbyte *)buf);
+        if ((*env)->ExceptionOccurred(env)) {
+            break;
+        }
+        while (pos < chunk) {
             fd = getFD(env, this, fid);
             if (fd == -1) {
                 JNU_ThrowIOException(env, "Stream Closed");
                 break;
             }
             if (append == JNI_TRUE) {
-                n = IO_Append(fd, buf+off, len);
+                n = IO_Append(fd, buf+pos, chunk-pos);
             } else {
-                n = IO_Write(fd, buf+off, len);
+                n = IO_Write(fd, buf+pos, chunk-pos);
             }
             if (n == -1) {
                 JNU_ThrowIOExceptionWithLastError(env, "Write error");
                 break;
             }
-            off += n;
-            len -= n;
+            pos += n;
+        }
+        if (pos < chunk) {
+            break;
         }
+        off += chunk;
+        len -= chunk;
     }
     if (buf != stackBuf) {
         free(buf);
@@ -569,10 +569,9 @@ if (1) { zip->msg = message; goto Catch; } else ((void)0)
  * Reads zip file central directory. Returns the file position of first
  * CEN header, otherwise returns -1 if an error occurred. If zip->msg != NULL
  * then the error was a zip format error and zip->msg has the error text.
- * Always pass in -1 for knownTotal; it's used for a recursive call.
  */
 static jlong
-readCEN(jzfile *zip, jint knownTotal)
+readCEN(jzfile *zip)
 {
     /* Following are unsigned 32-bit */
     jlong endpos, end64pos, cenpos, cenlen, cenoff;
@@ -584,6 +583,7 @@ readCEN(jzfile *zip, jint knownTotal)
 #ifdef USE_MMAP
     static jlong pagesize;
     jlong offset;
+    void* mappedAddr;
 #endif
     unsigned char endbuf[ENDHDR];
     jint endhdrlen = ENDHDR;
@@ -647,23 +647,19 @@ readCEN(jzfile *zip, jint knownTotal)
         } else {
             offset = 0;
         }
-        /* When we are not calling recursively, knownTotal is -1. */
-        if (knownTotal == -1) {
-            void* mappedAddr;
-            /* Mmap the CEN and END part only. We have to figure
-               out the page size in order to make offset to be multiples of
-               page size.
-            */
-            zip->mlen = cenpos - offset + cenlen + endhdrlen;
-            zip->offset = offset;
-            mappedAddr = mmap64(0, zip->mlen, PROT_READ, MAP_SHARED, zip->zfd, (off64_t) offset);
-            zip->maddr = (mappedAddr == (void*) MAP_FAILED) ? NULL :
-                (unsigned char*)mappedAddr;
-
-            if (zip->maddr == NULL) {
-                jio_fprintf(stderr, "mmap failed for CEN and END part of zip file\n");
-                goto Catch;
-            }
+        /* Mmap the CEN and END part only. We have to figure
+           out the page size in order to make offset to be multiples of
+           page size.
+        */
+        zip->mlen = cenpos - offset + cenlen + endhdrlen;
+        zip->offset = offset;
+        mappedAddr = mmap64(0, zip->mlen, PROT_READ, MAP_SHARED, zip->zfd, (off64_t) offset);
+        zip->maddr = (mappedAddr == (void*) MAP_FAILED) ? NULL :
+            (unsigned char*)mappedAddr;
+
+        if (zip->maddr == NULL) {
+            jio_fprintf(stderr, "mmap failed for CEN and END part of zip file\n");
+            goto Catch;
         }
         cenbuf = zip->maddr + cenpos - offset;
     } else
@@ -680,14 +676,15 @@ readCEN(jzfile *zip, jint knownTotal)
      * of central directory entries as stored in ENDTOT.  Since this
      * is a 2-byte field, but we (and other zip implementations)
      * support approx. 2**31 entries, we do not trust ENDTOT, but
-     * treat it only as a strong hint.  When we call ourselves
-     * recursively, knownTotal will have the "true" value.
+     * treat it only as a strong hint.  When the hint turns out to be
+     * too small we count the headers and parse the CEN again from the
+     * buffer we already have, rather than reading it a second time.
      *
      * Keep this path alive even with the Zip64 END support added, just
      * for zip files that have more than 0xffff entries but don't have
      * the Zip64 enabled.
      */
-    total = (knownTotal != -1) ? knownTotal : total;
+ Index:
     entries  = zip->entries  = calloc(total, sizeof(entries[0]));
     tablelen = zip->tablelen = ((total/2) | 1); // Odd -> fewer collisions
     table    = zip->table    = malloc(tablelen * sizeof(table[0]));
@@ -708,8 +705,9 @@ readCEN(jzfile *zip, jint knownTotal)
             /* This will only happen if the zip file has an incorrect
              * ENDTOT field, which usually means it contains more than
              * 65535 entries. */
-            cenpos = readCEN(zip, countCENHeaders(cenbuf, cenend));
-            goto Finally;
+            freeCEN(zip);
+            total = countCENHeaders(cenbuf, cenend);
+            goto Index;
         }
 
         method = CENHOW(cp);
@@ -890,7 +888,7 @@ ZIP_Put_In_Cache0(const char *name, ZFILE zfd, char **pmsg, jlong lastModified,
     }
 
     zip->zfd = zfd;
-    if (readCEN(zip, -1) < 0) {
+    if (readCEN(zip) < 0) {
         /* An error occurred while trying to read the zip file */
         if (pmsg != 0) {
             /* Set the zip error message */
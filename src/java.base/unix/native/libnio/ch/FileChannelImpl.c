@@ -30,6 +30,7 @@
 #include <unistd.h>
 
 #if defined(__linux__)
+#include <dlfcn.h>
 #include <sys/sendfile.h>
 #elif defined(_AIX)
 #include <string.h>
@@ -52,11 +53,22 @@
 
 static jfieldID chan_fd;        /* jobject 'fd' in sun.nio.ch.FileChannelImpl */
 
+#if defined(__linux__)
+typedef ssize_t copy_file_range_func(int, loff_t*, int, loff_t*, size_t,
+                                     unsigned int);
+static copy_file_range_func* my_copy_file_range_func = NULL;
+#endif
+
 JNIEXPORT jlong JNICALL
 Java_sun_nio_ch_FileChannelImpl_initIDs(JNIEnv *env, jclass clazz)
 {
     jlong pageSize = sysconf(_SC_PAGESIZE);
     chan_fd = (*env)->GetFieldID(env, clazz, "fd", "Ljava/io/FileDescriptor;");
+#if defined(__linux__)
+    // copy_file_range is only exported by glibc 2.27 and later
+    my_copy_file_range_func =
+        (copy_file_range_func*) dlsym(RTLD_DEFAULT, "copy_file_range");
+#endif
     return pageSize;
 }
 
@@ -169,7 +181,45 @@ Java_sun_nio_ch_FileChannelImpl_transferTo0(JNIEnv *env, jobject this,
 
 #if defined(__linux__)
     off64_t offset = (off64_t)position;
-    jlong n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
+    jlong n;
+    struct stat64 dstStat;
+    // copy_file_range only works between regular files. Check the target
+    // first, so that transfers to sockets and pipes go straight to sendfile.
+    if (my_copy_file_range_func != NULL &&
+        fstat64(dstFD, &dstStat) == 0 && S_ISREG(dstStat.st_mode)) {
+        // File-to-file copies stay in the kernel and may be offloaded to
+        // the file system (reflink, server-side copy). The target position
+        // is taken from, and advanced in, the target file descriptor.
+        loff_t srcOffset = (loff_t)position;
+        n = my_copy_file_range_func(srcFD, &srcOffset, dstFD, NULL,
+                                    (size_t)count, 0);
+        if (n > 0)
+            return n;
+        // Some file systems (e.g. procfs, sysfs) report 0 rather than an
+        // error when they cannot copy, so retry with sendfile in that case.
+        if (n == 0)
+            errno = ENOSYS;
+        switch (errno) {
+            case EINTR:
+                return IOS_INTERRUPTED;
+            case ENOSYS:
+                // not implemented by the kernel, do not try again
+                if (n < 0)
+                    my_copy_file_range_func = NULL;
+                break;
+            case EINVAL:
+            case EXDEV:
+            case EOPNOTSUPP:
+            case EBADF:
+                // the file systems differ on an older kernel, or the call
+                // is unsupported for these files: use sendfile
+                break;
+            default:
+                JNU_ThrowIOExceptionWithLastError(env, "Copy failed");
+                return IOS_THROWN;
+        }
+    }
+    n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
     if (n < 0) {
         if (errno == EAGAIN)
             return IOS_UNAVAILABLE;
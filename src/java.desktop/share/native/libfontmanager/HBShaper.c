@@ -225,6 +225,13 @@ JDKFontInfo*
 #define TYPO_LIGA 0x00000002
 #define TYPO_RTL  0x80000000
 
+/*
+ * Number of UTF-16 units of context copied on each side of the run.
+ * HarfBuzz keeps at most 5 code points of pre- and post-context, so the
+ * rest of the text array never affects the shaping of the run.
+ */
+#define CONTEXT_MARGIN 16
+
 JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
     (JNIEnv *env, jclass cls,
      jobject font2D,
@@ -251,8 +258,9 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      hb_glyph_info_t *glyphInfo;
      hb_glyph_position_t *glyphPos;
      hb_direction_t direction = HB_DIRECTION_LTR;
-     hb_feature_t *features = NULL;
+     hb_feature_t features[2];
      int featureCount = 0;
+     jint ctxStart, ctxLimit;
      char* kern = (flags & TYPO_KERN) ? "kern" : "-kern";
      char* liga = (flags & TYPO_LIGA) ? "liga" : "-liga";
      jboolean ret;
@@ -281,37 +289,51 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      hb_buffer_set_cluster_level(buffer,
                                  HB_BUFFER_CLUSTER_LEVEL_MONOTONE_CHARACTERS);
 
-     chars = (*env)->GetCharArrayElements(env, text, NULL);
+     /*
+      * The text array usually holds the whole paragraph, while only
+      * [offset, limit) is shaped. Copy just the run plus its context
+      * rather than the entire array on every call.
+      */
+     len = (*env)->GetArrayLength(env, text);
+     ctxStart = (offset > CONTEXT_MARGIN) ? offset - CONTEXT_MARGIN : 0;
+     ctxLimit = (len - limit > CONTEXT_MARGIN) ? limit + CONTEXT_MARGIN : len;
+     chars = (jchar*)malloc((ctxLimit - ctxStart) * sizeof(jchar));
+     if (chars == NULL && ctxLimit > ctxStart) {
+         JNU_ThrowOutOfMemoryError(env, NULL);
+         hb_buffer_destroy(buffer);
+         hb_font_destroy(hbfont);
+         free((void*)jdkFontInfo);
+         return JNI_FALSE;
+     }
+     (*env)->GetCharArrayRegion(env, text, ctxStart, ctxLimit - ctxStart, chars);
      if ((*env)->ExceptionCheck(env)) {
+         free(chars);
          hb_buffer_destroy(buffer);
          hb_font_destroy(hbfont);
          free((void*)jdkFontInfo);
          return JNI_FALSE;
      }
-     len = (*env)->GetArrayLength(env, text);
 
-     hb_buffer_add_utf16(buffer, chars, len, offset, limit-offset);
+     hb_buffer_add_utf16(buffer, chars, ctxLimit - ctxStart,
+                         offset - ctxStart, limit - offset);
 
-     features = calloc(2, sizeof(hb_feature_t));
-     if (features) {
-         hb_feature_from_string(kern, -1, &features[featureCount++]);
-         hb_feature_from_string(liga, -1, &features[featureCount++]);
-     }
+     hb_feature_from_string(kern, -1, &features[featureCount++]);
+     hb_feature_from_string(liga, -1, &features[featureCount++]);
 
      hb_shape_full(hbfont, buffer, features, featureCount, 0);
      glyphCount = hb_buffer_get_length(buffer);
      glyphInfo = hb_buffer_get_glyph_infos(buffer, 0);
      glyphPos = hb_buffer_get_glyph_positions(buffer, &buflen);
 
-     ret = storeGVData(env, gvdata, slot, baseIndex, offset, startPt,
+     /* clusters are relative to the copied window */
+     ret = storeGVData(env, gvdata, slot, baseIndex, offset - ctxStart, startPt,
                        limit - offset, glyphCount, glyphInfo, glyphPos,
                        jdkFontInfo->devScale);
 
      hb_buffer_destroy (buffer);
      hb_font_destroy(hbfont);
      free((void*)jdkFontInfo);
-     if (features != NULL) free(features);
-     (*env)->ReleaseCharArrayElements(env, text, chars, JNI_ABORT);
+     free(chars);
      return ret;
 }
 
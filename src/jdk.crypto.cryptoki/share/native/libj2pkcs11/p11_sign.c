@@ -98,6 +98,31 @@ JNIEXPORT void JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1SignInit
 }
 #endif
 
+#if defined(P11_ENABLE_C_SIGN) || defined(P11_ENABLE_C_VERIFY)
+/*
+ * Copies a Java byte array into the given buffer if it fits, so that the
+ * single-part operations need no heap copy for the common short inputs.
+ * Larger arrays are copied with jByteArrayToCKByteArray; the result must
+ * then be freed if it is not the given buffer.
+ */
+static void jByteArrayToCKByteArrayBuffered(JNIEnv *env, const jbyteArray jArray,
+        CK_BYTE_PTR buf, CK_ULONG bufLen, CK_BYTE_PTR *ckpArray, CK_ULONG_PTR ckpLength)
+{
+    jsize len;
+
+    if (jArray != NULL) {
+        len = (*env)->GetArrayLength(env, jArray);
+        if ((CK_ULONG)len <= bufLen) {
+            (*env)->GetByteArrayRegion(env, jArray, 0, len, (jbyte *)buf);
+            *ckpArray = buf;
+            *ckpLength = len;
+            return;
+        }
+    }
+    jByteArrayToCKByteArray(env, jArray, ckpArray, ckpLength);
+}
+#endif
+
 #ifdef P11_ENABLE_C_SIGN
 /*
  * Class:     sun_security_pkcs11_wrapper_PKCS11
@@ -119,6 +144,7 @@ JNIEXPORT jbyteArray JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Sign
     CK_BYTE_PTR bufP;
     CK_ULONG ckSignatureLength;
     CK_BYTE BUF[MAX_STACK_BUFFER_LEN];
+    CK_BYTE DATABUF[MAX_STACK_BUFFER_LEN];
     jbyteArray jSignature = NULL;
     CK_RV rv;
 
@@ -128,7 +154,8 @@ JNIEXPORT jbyteArray JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Sign
     TRACE0("DEBUG: C_Sign\n");
 
     ckSessionHandle = jLongToCKULong(jSessionHandle);
-    jByteArrayToCKByteArray(env, jData, &ckpData, &ckDataLength);
+    jByteArrayToCKByteArrayBuffered(env, jData, DATABUF, MAX_STACK_BUFFER_LEN,
+            &ckpData, &ckDataLength);
     if ((*env)->ExceptionCheck(env)) {
         return NULL;
     }
@@ -149,7 +176,7 @@ JNIEXPORT jbyteArray JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Sign
         TRACE1("DEBUG C_Sign: signature length = %lu\n", ckSignatureLength);
     }
 
-    free(ckpData);
+    if (ckpData != DATABUF) { free(ckpData); }
     if (bufP != BUF) { free(bufP); }
 
     TRACE0("FINISHED\n");
@@ -440,6 +467,8 @@ JNIEXPORT void JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Verify
     CK_BYTE_PTR ckpSignature = NULL_PTR;
     CK_ULONG ckDataLength;
     CK_ULONG ckSignatureLength;
+    CK_BYTE DATABUF[MAX_STACK_BUFFER_LEN];
+    CK_BYTE SIGBUF[MAX_STACK_BUFFER_LEN];
     CK_RV rv = 0;
 
     CK_FUNCTION_LIST_PTR ckpFunctions = getFunctionList(env, obj);
@@ -447,12 +476,14 @@ JNIEXPORT void JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Verify
 
     ckSessionHandle = jLongToCKULong(jSessionHandle);
 
-    jByteArrayToCKByteArray(env, jData, &ckpData, &ckDataLength);
+    jByteArrayToCKByteArrayBuffered(env, jData, DATABUF, MAX_STACK_BUFFER_LEN,
+            &ckpData, &ckDataLength);
     if ((*env)->ExceptionCheck(env)) {
-        return;
+        goto cleanup;
     }
 
-    jByteArrayToCKByteArray(env, jSignature, &ckpSignature, &ckSignatureLength);
+    jByteArrayToCKByteArrayBuffered(env, jSignature, SIGBUF, MAX_STACK_BUFFER_LEN,
+            &ckpSignature, &ckSignatureLength);
     if ((*env)->ExceptionCheck(env)) {
         goto cleanup;
     }
@@ -461,8 +492,8 @@ JNIEXPORT void JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Verify
     rv = (*ckpFunctions->C_Verify)(ckSessionHandle, ckpData, ckDataLength, ckpSignature, ckSignatureLength);
 
 cleanup:
-    free(ckpData);
-    free(ckpSignature);
+    if (ckpData != DATABUF) { free(ckpData); }
+    if (ckpSignature != SIGBUF) { free(ckpSignature); }
 
     ckAssertReturnValueOK(env, rv);
 }
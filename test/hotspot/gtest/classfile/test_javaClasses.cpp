@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+#include "precompiled.hpp"
+#include "classfile/javaClasses.hpp"
+#include "unittest.hpp"
+
+// The unrolled hash must match the plain String.hashCode() recurrence
+// for every length, including the tail that is not a multiple of four.
+TEST(java_lang_String, hash_code) {
+  jchar chars[40];
+  jbyte bytes[40];
+  for (int i = 0; i < 40; i++) {
+    chars[i] = (jchar)(0xFFF7 - i * 1031);
+    bytes[i] = (jbyte)(0x80 + i * 7);
+  }
+  for (int len = 0; len <= 40; len++) {
+    unsigned int char_hash = 0;
+    unsigned int byte_hash = 0;
+    for (int i = 0; i < len; i++) {
+      char_hash = 31 * char_hash + (unsigned int)chars[i];
+      byte_hash = 31 * byte_hash + (((unsigned int)bytes[i]) & 0xFF);
+    }
+    EXPECT_EQ(char_hash, java_lang_String::hash_code(chars, len)) << "len = " << len;
+    EXPECT_EQ(byte_hash, java_lang_String::hash_code(bytes, len)) << "len = " << len;
+  }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/cardTable.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
+#include "utilities/ticks.hpp"
+#include "unittest.hpp"
+
+typedef CardTable::CardValue CardValue;
+
+static const CardValue clean = CardTable::clean_card_val();
+static const CardValue dirty = CardTable::dirty_card_val();
+
+static CardValue* naive_first_non_clean(CardValue* start, CardValue* end) {
+  while (start < end && *start == clean) start++;
+  return start;
+}
+
+static CardValue* naive_first_clean(CardValue* start, CardValue* end) {
+  while (start < end && *start != clean) start++;
+  return start;
+}
+
+static CardValue* naive_clean_run_start(CardValue* start, CardValue* end) {
+  while (end > start && end[-1] == clean) end--;
+  return end;
+}
+
+class CardTableSearchTest : public ::testing::Test {
+ protected:
+  static const size_t NumCards = 1024;
+  CardValue* _cards;
+
+  CardTableSearchTest() {
+    // Word aligned, so that the offsets below cover every alignment.
+    _cards = NEW_C_HEAP_ARRAY(CardValue, NumCards, mtGC);
+  }
+  ~CardTableSearchTest() {
+    FREE_C_HEAP_ARRAY(CardValue, _cards);
+  }
+
+  void fill(CardValue value) {
+    memset(_cards, value, NumCards);
+  }
+
+  void check_all_ranges() {
+    for (size_t from = 0; from < 40; from++) {
+      for (size_t to = from; to < NumCards; to += 7) {
+        CardValue* s = _cards + from;
+        CardValue* e = _cards + to;
+        ASSERT_EQ(naive_first_non_clean(s, e), CardTable::find_first_non_clean_card(s, e))
+          << "from " << from << " to " << to;
+        ASSERT_EQ(naive_first_clean(s, e), CardTable::find_first_clean_card(s, e))
+          << "from " << from << " to " << to;
+        ASSERT_EQ(naive_clean_run_start(s, e), CardTable::find_clean_run_start(s, e))
+          << "from " << from << " to " << to;
+      }
+    }
+  }
+};
+
+TEST_VM_F(CardTableSearchTest, uniform) {
+  fill(clean);
+  check_all_ranges();
+  fill(dirty);
+  check_all_ranges();
+}
+
+TEST_VM_F(CardTableSearchTest, single_card) {
+  const size_t positions[] = { 0, 1, 7, 8, 31, 32, 33, 500, NumCards - 1 };
+  for (size_t i = 0; i < ARRAY_SIZE(positions); i++) {
+    fill(clean);
+    _cards[positions[i]] = dirty;
+    check_all_ranges();
+    fill(dirty);
+    _cards[positions[i]] = clean;
+    check_all_ranges();
+  }
+}
+
+TEST_VM_F(CardTableSearchTest, random) {
+  // Sparse and dense patterns, including card values other than clean and dirty.
+  const int densities[] = { 2, 16, 256 };
+  for (size_t d = 0; d < ARRAY_SIZE(densities); d++) {
+    for (size_t i = 0; i < NumCards; i++) {
+      int r = os::random();
+      _cards[i] = (r % densities[d] == 0) ? (CardValue)(r >> 8) : clean;
+    }
+    check_all_ranges();
+  }
+}
+
+// This "test" doesn't verify anything; it logs the throughput of the card
+// range searches over a large, mostly clean card table with -Xlog:gc.
+TEST_VM(CardTableSearch, scan_throughput) {
+  const size_t num_cards = 64 * M;
+  CardValue* cards = NEW_C_HEAP_ARRAY(CardValue, num_cards, mtGC);
+  memset(cards, clean, num_cards);
+  for (size_t i = 0; i < num_cards; i += 64 * K) {
+    cards[i] = dirty;
+  }
+
+  size_t runs = 0;
+  Ticks start = Ticks::now();
+  CardValue* const end = cards + num_cards;
+  for (CardValue* cur = cards; cur < end; ) {
+    cur = CardTable::find_first_non_clean_card(cur, end);
+    if (cur < end) {
+      runs++;
+      cur = CardTable::find_first_clean_card(cur, end);
+    }
+  }
+  Tickspan elapsed = Ticks::now() - start;
+  EXPECT_EQ(num_cards / (64 * K), runs);
+
+  double secs = MAX2(elapsed.seconds(), 1e-9);
+  log_info(gc)("Scanned " SIZE_FORMAT "M cards, " SIZE_FORMAT " dirty runs, in %.3fms (%.1f GB/s)",
+               num_cards / M, runs, elapsed.seconds() * 1000.0, num_cards / secs / G);
+  FREE_C_HEAP_ARRAY(CardValue, cards);
+}
@@ -25,6 +25,7 @@
 #include "jvm.h"
 #include "logging/log.hpp"
 #include "logging/logAsyncWriter.hpp"
+#include "logging/logFileStreamOutput.hpp"
 #include "logging/logMessage.hpp"
 #include "logTestFixture.hpp"
 #include "logTestUtils.inline.hpp"
@@ -75,9 +76,9 @@ LOG_LEVEL_LIST
       AutoModifyRestore<size_t> saver(AsyncLogBufferSize, sz * 1024 /*in byte*/);
       LogMessage(logging) lm;
 
-      // write 100x more messages than its capacity in burst
+      // write messages taking several times the capacity of the buffer in burst
       for (size_t i = 0; i < sz * 100; ++i) {
-        lm.debug("a lot of log...");
+        lm.debug("a lot of log... %0256d", 0);
       }
       lm.flush();
     }
@@ -101,75 +102,74 @@ LOG_LEVEL_LIST
 };
 
 TEST_VM(AsyncLogBufferTest, fifo) {
-  LinkedListDeque<int, mtLogging> fifo;
-  LinkedListImpl<int, ResourceObj::C_HEAP, mtLogging> result;
-
-  fifo.push_back(1);
-  EXPECT_EQ((size_t)1, fifo.size());
-  EXPECT_EQ(1, *(fifo.back()));
-
-  fifo.pop_all(&result);
-  EXPECT_EQ((size_t)0, fifo.size());
-  EXPECT_EQ(NULL, fifo.back());
-  EXPECT_EQ((size_t)1, result.size());
-  EXPECT_EQ(1, *(result.head()->data()));
-  result.clear();
-
-  fifo.push_back(2);
-  fifo.push_back(1);
-  fifo.pop_all(&result);
-  EXPECT_EQ((size_t)2, result.size());
-  EXPECT_EQ(2, *(result.head()->data()));
-  EXPECT_EQ(1, *(result.head()->next()->data()));
-  result.clear();
-  const int N = 1000;
-  for (int i=0; i<N; ++i) {
-    fifo.push_back(i);
-  }
-  fifo.pop_all(&result);
-
-  EXPECT_EQ((size_t)N, result.size());
-  LinkedListIterator<int> it(result.head());
-  for (int i=0; i<N; ++i) {
-    int* e = it.next();
-    EXPECT_EQ(i, *e);
-  }
+  using tagset = LogTagSetMapping<LogTag::_logging>;
+  LogDecorations decorations(LogLevel::Info, tagset::tagset(), LogDecorators::All);
+  AsyncLogBuffer buffer(4 * K);
+  const AsyncLogMessage* m;
+
+  EXPECT_EQ(nullptr, buffer.front());
+  EXPECT_TRUE(buffer.push_back(&StdoutLog, decorations, "first"));
+  EXPECT_TRUE(buffer.push_back(&StderrLog, decorations, "second"));
+
+  m = buffer.front();
+  ASSERT_NE(nullptr, m);
+  EXPECT_EQ(&StdoutLog, m->output());
+  EXPECT_STREQ("first", m->message());
+  buffer.pop_front();
+
+  m = buffer.front();
+  ASSERT_NE(nullptr, m);
+  EXPECT_EQ(&StderrLog, m->output());
+  EXPECT_STREQ("second", m->message());
+  buffer.pop_front();
+
+  EXPECT_EQ(nullptr, buffer.front());
 }
 
-TEST_VM(AsyncLogBufferTest, deque) {
-  LinkedListDeque<int, mtLogging> deque;
-  const int N = 10;
+TEST_VM(AsyncLogBufferTest, wraparound) {
+  using tagset = LogTagSetMapping<LogTag::_logging>;
+  LogDecorations decorations(LogLevel::Info, tagset::tagset(), LogDecorators::All);
+  AsyncLogBuffer buffer(1 * K);
+  const int N = 1000;
 
-  EXPECT_EQ(NULL, deque.front());
-  EXPECT_EQ(NULL, deque.back());
+  // Messages of different lengths end at different offsets, so records
+  // wrap around the end of the buffer in many different ways.
   for (int i = 0; i < N; ++i) {
-    deque.push_back(i);
+    char msg[64];
+    jio_snprintf(msg, sizeof(msg), "message-%d-%*s", i, i % 32, "");
+    EXPECT_TRUE(buffer.push_back(&StdoutLog, decorations, msg));
+
+    const AsyncLogMessage* m = buffer.front();
+    ASSERT_NE(nullptr, m);
+    EXPECT_STREQ(msg, m->message());
+    buffer.pop_front();
+    EXPECT_EQ(nullptr, buffer.front());
   }
+}
 
-  EXPECT_EQ(0, *(deque.front()));
-  EXPECT_EQ(N-1, *(deque.back()));
-  EXPECT_EQ((size_t)N, deque.size());
-
-  deque.pop_front();
-  EXPECT_EQ((size_t)(N - 1), deque.size());
-  EXPECT_EQ(1, *(deque.front()));
-  EXPECT_EQ(N - 1, *(deque.back()));
-
-  deque.pop_front();
-  EXPECT_EQ((size_t)(N - 2), deque.size());
-  EXPECT_EQ(2, *(deque.front()));
-  EXPECT_EQ(N - 1, *(deque.back()));
-
+TEST_VM(AsyncLogBufferTest, full) {
+  using tagset = LogTagSetMapping<LogTag::_logging>;
+  LogDecorations decorations(LogLevel::Info, tagset::tagset(), LogDecorators::All);
+  AsyncLogBuffer buffer(1 * K);
 
-  for (int i=2; i < N-1; ++i) {
-    deque.pop_front();
+  int n = 0;
+  while (buffer.push_back(&StdoutLog, decorations, "a message")) {
+    n++;
   }
-  EXPECT_EQ((size_t)1, deque.size());
-  EXPECT_EQ(N - 1, *(deque.back()));
-  EXPECT_EQ(deque.back(), deque.front());
-
-  deque.pop_front();
-  EXPECT_EQ((size_t)0, deque.size());
+  EXPECT_GT(n, 0);
+
+  // Consuming one message makes space for exactly one more.
+  buffer.pop_front();
+  EXPECT_TRUE(buffer.push_back(&StdoutLog, decorations, "a message"));
+  EXPECT_FALSE(buffer.push_back(&StdoutLog, decorations, "a message"));
+
+  for (int i = 0; i < n; ++i) {
+    const AsyncLogMessage* m = buffer.front();
+    ASSERT_NE(nullptr, m);
+    EXPECT_STREQ("a message", m->message());
+    buffer.pop_front();
+  }
+  EXPECT_EQ(nullptr, buffer.front());
 }
 
 TEST_VM_F(AsyncLogTest, asynclog) {
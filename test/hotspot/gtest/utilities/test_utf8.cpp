@@ -103,3 +103,46 @@ TEST_VM(utf8, jbyte_length) {
   }
 
 }
+
+TEST_VM(utf8, unicode_length) {
+  // 20 ASCII bytes, then U+00E9 (Latin1, 2 bytes), 9 ASCII bytes and
+  // U+0800 (not Latin1, 3 bytes), so both the word-at-a-time skip and
+  // the byte loop are exercised.
+  const char* str = "abcdefghijklmnopqrst" "\xC3\xA9" "uvwxyzABC" "\xE0\xA0\x80";
+  int len = (int)strlen(str);
+  bool is_latin1;
+  bool has_multibyte;
+
+  ASSERT_EQ(UTF8::unicode_length(str, 20, is_latin1, has_multibyte), 20);
+  ASSERT_TRUE(is_latin1);
+  ASSERT_FALSE(has_multibyte);
+
+  ASSERT_EQ(UTF8::unicode_length(str, 31, is_latin1, has_multibyte), 30);
+  ASSERT_TRUE(is_latin1);
+  ASSERT_TRUE(has_multibyte);
+
+  ASSERT_EQ(UTF8::unicode_length(str, len, is_latin1, has_multibyte), 31);
+  ASSERT_FALSE(is_latin1);
+  ASSERT_TRUE(has_multibyte);
+  ASSERT_EQ(UTF8::unicode_length(str, is_latin1, has_multibyte), 31);
+}
+
+TEST_VM(utf8, is_legal_utf8) {
+  // Long enough for the word-at-a-time check to cover the bad byte.
+  const unsigned char ascii[] = "java/lang/invoke/LambdaForm$MH";
+  const int len = (int)sizeof(ascii) - 1;
+  ASSERT_TRUE(UTF8::is_legal_utf8(ascii, len, false));
+
+  unsigned char buf[sizeof(ascii)];
+  for (int i = 0; i < len; i++) {
+    memcpy(buf, ascii, sizeof(ascii));
+    buf[i] = 0;
+    ASSERT_FALSE(UTF8::is_legal_utf8(buf, len, false)) << "embedded zero at " << i;
+    buf[i] = 0x80;
+    ASSERT_FALSE(UTF8::is_legal_utf8(buf, len, false)) << "stray continuation byte at " << i;
+  }
+
+  // A legal two-byte sequence after a full word of ASCII.
+  const unsigned char mixed[] = "abcdefghij" "\xC3\xA9" "klm";
+  ASSERT_TRUE(UTF8::is_legal_utf8(mixed, (int)sizeof(mixed) - 1, false));
+}
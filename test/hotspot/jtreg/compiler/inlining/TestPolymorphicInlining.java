@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that UsePolymorphicInlining inlines all profiled receivers
+ *          of a megamorphic call site, and that an unexpected receiver
+ *          takes the virtual call.
+ * @requires vm.compiler2.enabled & vm.flavor == "server" & !vm.graal.enabled
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run driver compiler.inlining.TestPolymorphicInlining
+ */
+
+package compiler.inlining;
+
+import java.lang.reflect.Method;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+
+public class TestPolymorphicInlining {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = run(true);
+        for (String k : new String[] { "A", "B", "C" }) {
+            output.shouldMatch("TestPolymorphicInlining\\$" + k + "::value .*inline \\(hot\\)");
+        }
+        output.shouldNotContain("TestPolymorphicInlining$D::value");
+
+        // Without the flag the call site stays a virtual call.
+        output = run(false);
+        output.shouldNotMatch("TestPolymorphicInlining\\$[ABC]::value .*inline \\(hot\\)");
+    }
+
+    private static OutputAnalyzer run(boolean polymorphic) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:" + (polymorphic ? "+" : "-") + "UsePolymorphicInlining",
+            "-XX:TypeProfileWidth=4",
+            "-XX:-TieredCompilation",
+            "-XX:-BackgroundCompilation",
+            "-XX:+PrintInlining",
+            "-XX:CompileCommand=quiet",
+            "-XX:CompileCommand=compileonly," + Workload.class.getName() + "::test",
+            Workload.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.reportDiagnosticSummary();
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    interface I {
+        int value();
+    }
+
+    static class A implements I { public int value() { return 1; } }
+    static class B implements I { public int value() { return 2; } }
+    static class C implements I { public int value() { return 3; } }
+    static class D implements I { public int value() { return 4; } }
+
+    static class Workload {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        static int test(I i) {
+            return i.value();
+        }
+
+        public static void main(String[] args) throws Exception {
+            I[] receivers = { new A(), new B(), new C() };
+            // Profile three receivers, equally frequent, then compile.
+            int sum = 0;
+            for (int i = 0; i < 30_000; i++) {
+                sum += test(receivers[i % receivers.length]);
+            }
+            Method m = Workload.class.getDeclaredMethod("test", I.class);
+            if (!WB.isMethodCompiled(m)) {
+                WB.enqueueMethodForCompilation(m, 4);
+            }
+            if (!WB.isMethodCompiled(m)) {
+                throw new RuntimeException("test() is not compiled");
+            }
+
+            // A receiver that was never profiled goes through the virtual
+            // call at the end of the guard chain. It neither traps nor gives
+            // a wrong result.
+            int expected = 4;
+            for (int i = 0; i < 1000; i++) {
+                int v = test(new D());
+                if (v != expected) {
+                    throw new RuntimeException("Wrong result " + v + " for an unexpected receiver");
+                }
+            }
+            if (!WB.isMethodCompiled(m)) {
+                throw new RuntimeException("test() was deoptimized by an unexpected receiver");
+            }
+            System.out.println(sum);
+        }
+    }
+}
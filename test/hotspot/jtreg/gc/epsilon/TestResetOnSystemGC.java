@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.epsilon;
+
+/**
+ * @test TestResetOnSystemGC
+ * @summary Test that EpsilonResetOnSystemGC discards unreachable allocations,
+ *          keeps the objects below the mark, refuses to reset when the
+ *          discarded objects are still referenced, and clears weak handles.
+ * @requires vm.gc.Epsilon
+ * @library /test/lib
+ * @run driver gc.epsilon.TestResetOnSystemGC
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestResetOnSystemGC {
+
+    public static void main(String[] args) throws Exception {
+        // Interpret only, so that no compiled code refers to objects in
+        // the interval.
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UseEpsilonGC",
+            "-XX:+EpsilonResetOnSystemGC",
+            "-Xint",
+            "-Xmx64m",
+            "-Xlog:gc",
+            Workload.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.reportDiagnosticSummary();
+        output.shouldHaveExitValue(0);
+        output.stdoutShouldMatch("(?s)RESET START.*Heap reset, discarded.*RESET END");
+        output.stdoutShouldMatch("(?s)REFUSE START.*Heap reset refused.*REFUSE END");
+    }
+
+    static class Workload {
+        static final String PREFIX = "TestResetOnSystemGC-";
+        static final int COUNT = 100;
+
+        static long[] kept;
+        static Object leaked;
+
+        // Allocates garbage, including interned strings that only the
+        // StringTable, a weak OopStorage, refers to.
+        static void garbage(int base) {
+            for (int i = 0; i < 10_000; i++) {
+                byte[] b = new byte[1024];
+                b[0] = 1;
+            }
+            for (int i = 0; i < COUNT; i++) {
+                new StringBuilder(PREFIX).append(base + i).toString().intern();
+            }
+        }
+
+        static long checksum(long[] a) {
+            long sum = 0;
+            for (long v : a) {
+                sum = sum * 31 + v;
+            }
+            return sum;
+        }
+
+        public static void main(String[] args) {
+            kept = new long[1000];
+            for (int i = 0; i < kept.length; i++) {
+                kept[i] = (long) i * i;
+            }
+            long expected = checksum(kept);
+
+            // Load and link everything the interval uses before the mark.
+            garbage(0);
+            System.out.println("WARMUP END");
+            System.gc();
+
+            System.out.println("RESET START");
+            garbage(COUNT);
+            System.gc();
+            System.out.println("RESET END");
+
+            // Objects below the mark survive the reset.
+            if (checksum(kept) != expected) {
+                throw new RuntimeException("Object below the mark was changed by the reset");
+            }
+
+            // Overwrite the discarded memory, then check that the StringTable
+            // no longer refers to the discarded strings.
+            garbage(0);
+            for (int i = 0; i < COUNT; i++) {
+                String s = new StringBuilder(PREFIX).append(COUNT + i).toString();
+                if (s.intern() != s) {
+                    throw new RuntimeException("Discarded interned string " + s + " still in the StringTable");
+                }
+            }
+
+            // A reference from below the mark keeps the interval.
+            System.gc();
+            System.out.println("REFUSE START");
+            leaked = new byte[1024];
+            System.gc();
+            System.out.println("REFUSE END");
+            if (((byte[]) leaked).length != 1024) {
+                throw new RuntimeException("Referenced object was discarded");
+            }
+        }
+    }
+}
@@ -150,6 +150,8 @@ public class TestGCLogMessages {
         new LogMessageWithLevel("Copied Bytes", Level.DEBUG),
         new LogMessageWithLevel("LAB Waste", Level.DEBUG),
         new LogMessageWithLevel("LAB Undo Waste", Level.DEBUG),
+        new LogMessageWithLevel("PLAB Fills", Level.DEBUG),
+        new LogMessageWithLevel("Direct Allocated", Level.DEBUG),
         // Termination
         new LogMessageWithLevel("Termination", Level.DEBUG),
         new LogMessageWithLevel("Termination Attempts", Level.DEBUG),
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestParallelReferencePrecleaning
+ * @summary Test that G1ParallelReferencePrecleaning precleans all reference
+ *          types with the marking workers, logs each phase, and keeps the
+ *          reference processing results intact.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run driver gc.g1.TestParallelReferencePrecleaning
+ */
+
+import java.lang.ref.PhantomReference;
+import java.lang.ref.Reference;
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.SoftReference;
+import java.lang.ref.WeakReference;
+import java.util.ArrayList;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+
+public class TestParallelReferencePrecleaning {
+
+    private static final String[] PHASES = {
+        "Preclean SoftReferences",
+        "Preclean WeakReferences",
+        "Preclean FinalReferences",
+        "Preclean PhantomReferences"
+    };
+
+    public static void main(String[] args) throws Exception {
+        run(true);
+        run(false);
+    }
+
+    private static void run(boolean parallel) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UseG1GC",
+            "-XX:+G1UseReferencePrecleaning",
+            "-XX:" + (parallel ? "+" : "-") + "G1ParallelReferencePrecleaning",
+            "-XX:ConcGCThreads=4",
+            "-XX:ParallelGCThreads=8",
+            "-Xmx128m",
+            "-Xlog:gc+ref=debug",
+            Workload.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.reportDiagnosticSummary();
+        output.shouldHaveExitValue(0);
+        for (String phase : PHASES) {
+            output.shouldContain(phase);
+        }
+    }
+
+    static class Workload {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+        private static final int COUNT = 20_000;
+        private static final int CYCLES = 3;
+
+        public static void main(String[] args) throws Exception {
+            for (int cycle = 0; cycle < CYCLES; cycle++) {
+                runCycle();
+            }
+        }
+
+        private static void runCycle() throws Exception {
+            ReferenceQueue<Object> queue = new ReferenceQueue<>();
+            List<Object> live = new ArrayList<>();
+            List<Object> dead = new ArrayList<>();
+            List<Reference<Object>> liveRefs = new ArrayList<>();
+            List<Reference<Object>> deadRefs = new ArrayList<>();
+
+            for (int i = 0; i < COUNT; i++) {
+                Object o = new Object();
+                Reference<Object> ref = newReference(i, o, queue);
+                if (i % 2 == 0) {
+                    live.add(o);
+                    liveRefs.add(ref);
+                } else {
+                    dead.add(o);
+                    deadRefs.add(ref);
+                }
+            }
+
+            // Promote everything so that concurrent marking discovers the
+            // references, then make half of the referents unreachable.
+            WB.fullGC();
+            dead.clear();
+
+            WB.g1StartConcMarkCycle();
+            while (WB.g1InConcurrentMark()) {
+                Thread.sleep(10);
+            }
+
+            for (Reference<Object> ref : liveRefs) {
+                if (ref.refersTo(null)) {
+                    throw new RuntimeException("Reference to a live object was cleared: " + ref);
+                }
+            }
+            for (Reference<Object> ref : deadRefs) {
+                // Soft references may legitimately be kept.
+                if (!(ref instanceof SoftReference) && !ref.refersTo(null)) {
+                    throw new RuntimeException("Reference to an unreachable object was not cleared: " + ref);
+                }
+            }
+            Reference.reachabilityFence(live);
+        }
+
+        private static Reference<Object> newReference(int i, Object o, ReferenceQueue<Object> queue) {
+            switch (i % 6 / 2) {
+                case 0:  return new SoftReference<>(o, queue);
+                case 1:  return new WeakReference<>(o, queue);
+                default: return new PhantomReference<>(o, queue);
+            }
+        }
+    }
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test
+ * @summary Arrays held in JNI critical sections stay in place across young,
+ *          mixed and full collections when G1PinRegionsForCriticalNatives is enabled.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm/native -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *      -XX:+UnlockExperimentalVMOptions -XX:+UseG1GC -XX:+G1PinRegionsForCriticalNatives
+ *      -Xms64m -Xmx64m -XX:G1HeapRegionSize=1m -XX:+VerifyAfterGC -Xlog:gc
+ *      gc.g1.TestPinRegionsForCriticalNatives young
+ * @run main/othervm/native -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *      -XX:+UnlockExperimentalVMOptions -XX:+UseG1GC -XX:+G1PinRegionsForCriticalNatives
+ *      -XX:G1MixedGCLiveThresholdPercent=100 -XX:G1HeapWastePercent=0
+ *      -Xms64m -Xmx64m -XX:G1HeapRegionSize=1m -XX:+VerifyAfterGC -Xlog:gc
+ *      gc.g1.TestPinRegionsForCriticalNatives mixed
+ * @run main/othervm/native -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *      -XX:+UnlockExperimentalVMOptions -XX:+UseG1GC -XX:+G1PinRegionsForCriticalNatives
+ *      -Xms64m -Xmx64m -XX:G1HeapRegionSize=1m -XX:+VerifyAfterGC -Xlog:gc
+ *      gc.g1.TestPinRegionsForCriticalNatives full
+ * @run main/othervm/native -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *      -XX:+UnlockExperimentalVMOptions -XX:+UseG1GC -XX:+G1PinRegionsForCriticalNatives
+ *      -Xms64m -Xmx64m -XX:G1HeapRegionSize=1m -XX:+VerifyAfterGC -Xlog:gc
+ *      gc.g1.TestPinRegionsForCriticalNatives humongous
+ */
+
+import jdk.test.lib.Asserts;
+import sun.hotspot.WhiteBox;
+
+public class TestPinRegionsForCriticalNatives {
+    static { System.loadLibrary("TestPinRegionsForCriticalNatives"); }
+
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    private static final int SMALL_ARRAY_LENGTH = 1024;
+    private static final int NUM_FILLERS = 2048;
+
+    private static native boolean pin(int[] array);
+    private static native void writePinned(int index, int value);
+    private static native void unpin(int[] array);
+
+    // Keeps the fillers around the pinned array reachable.
+    private static Object[] fillers;
+
+    public static void main(String[] args) throws Exception {
+        switch (args[0]) {
+            case "young":     testYoung(); break;
+            case "mixed":     testMixed(); break;
+            case "full":      testFull(); break;
+            case "humongous": testHumongous(); break;
+            default: throw new IllegalArgumentException("Unknown test " + args[0]);
+        }
+    }
+
+    // Allocates an array in the middle of other small arrays, so that the
+    // region containing it also contains live objects and garbage.
+    private static int[] allocateAmongFillers() {
+        fillers = new Object[NUM_FILLERS];
+        for (int i = 0; i < NUM_FILLERS; i++) {
+            fillers[i] = new int[SMALL_ARRAY_LENGTH];
+        }
+        int[] target = new int[SMALL_ARRAY_LENGTH];
+        fillers[NUM_FILLERS / 2] = target;
+        return target;
+    }
+
+    private static void dropEveryOtherFiller() {
+        for (int i = 0; i < NUM_FILLERS; i += 2) {
+            if (i != NUM_FILLERS / 2) {
+                fillers[i] = null;
+            }
+        }
+    }
+
+    private static void pinAndRunGCs(int[] target, Runnable gcs) {
+        if (!pin(target)) {
+            throw new RuntimeException("Could not get critical array");
+        }
+        long address = WB.getObjectAddress(target);
+        try {
+            gcs.run();
+            Asserts.assertEquals(WB.getObjectAddress(target), address, "pinned array moved");
+            // The critical pointer must still refer to the array contents.
+            writePinned(SMALL_ARRAY_LENGTH - 1, 42);
+            Asserts.assertEquals(target[SMALL_ARRAY_LENGTH - 1], 42, "write through critical pointer lost");
+        } finally {
+            unpin(target);
+        }
+        // Once released, collections may move the array again.
+        gcs.run();
+        Asserts.assertEquals(target[SMALL_ARRAY_LENGTH - 1], 42, "array contents changed");
+    }
+
+    private static void testYoung() {
+        int[] target = allocateAmongFillers();
+        dropEveryOtherFiller();
+        Asserts.assertFalse(WB.isObjectInOldGen(target), "array should be young");
+        pinAndRunGCs(target, () -> {
+            WB.youngGC();
+            WB.youngGC();
+        });
+    }
+
+    private static void testMixed() throws Exception {
+        int[] target = allocateAmongFillers();
+        // Move everything into old regions, then create garbage in them so
+        // that they become candidates for mixed collections.
+        WB.fullGC();
+        Asserts.assertTrue(WB.isObjectInOldGen(target), "array should be old");
+        dropEveryOtherFiller();
+        pinAndRunGCs(target, () -> {
+            WB.g1StartConcMarkCycle();
+            while (WB.g1InConcurrentMark()) {
+                try {
+                    Thread.sleep(100);
+                } catch (InterruptedException e) {
+                    throw new RuntimeException(e);
+                }
+            }
+            // The first young collection prepares the mixed phase, the
+            // following ones are mixed.
+            for (int i = 0; i < 4; i++) {
+                WB.youngGC();
+            }
+        });
+    }
+
+    private static void testFull() {
+        int[] target = allocateAmongFillers();
+        dropEveryOtherFiller();
+        pinAndRunGCs(target, () -> {
+            WB.fullGC();
+            WB.fullGC();
+        });
+    }
+
+    private static void testHumongous() {
+        int[] target = new int[WB.g1RegionSize()];
+        Asserts.assertTrue(WB.g1IsHumongous(target), "array should be humongous");
+        fillers = new Object[] { target };
+        pinAndRunGCs(target, () -> {
+            WB.youngGC();
+            WB.fullGC();
+        });
+        Asserts.assertTrue(WB.g1IsHumongous(target), "array should still be humongous");
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Native support for TestPinRegionsForCriticalNatives test.
+ */
+
+#include "jni.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static jint* pinned_elements = NULL;
+
+JNIEXPORT jboolean JNICALL
+Java_gc_g1_TestPinRegionsForCriticalNatives_pin(JNIEnv* env, jclass clazz, jintArray array) {
+    pinned_elements = (jint*)(*env)->GetPrimitiveArrayCritical(env, array, NULL);
+    return pinned_elements != NULL ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT void JNICALL
+Java_gc_g1_TestPinRegionsForCriticalNatives_writePinned(JNIEnv* env, jclass clazz, jint index, jint value) {
+    pinned_elements[index] = value;
+}
+
+JNIEXPORT void JNICALL
+Java_gc_g1_TestPinRegionsForCriticalNatives_unpin(JNIEnv* env, jclass clazz, jintArray array) {
+    (*env)->ReleasePrimitiveArrayCritical(env, array, pinned_elements, 0);
+    pinned_elements = NULL;
+}
+
+#ifdef __cplusplus
+}
+#endif
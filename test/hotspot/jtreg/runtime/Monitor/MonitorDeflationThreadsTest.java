@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test id=1
+ * @summary Stress monitor inflation and deflation with one or more
+ *          MonitorDeflationThreads.
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *      -XX:+UnlockExperimentalVMOptions -XX:MonitorDeflationThreads=1
+ *      -XX:AsyncDeflationInterval=10 -XX:MonitorUsedDeflationThreshold=1
+ *      -XX:AvgMonitorsPerThreadEstimate=1 -Xlog:monitorinflation=info
+ *      MonitorDeflationThreadsTest
+ */
+
+/*
+ * @test id=4
+ * @summary Stress monitor inflation and deflation with one or more
+ *          MonitorDeflationThreads.
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *      -XX:+UnlockExperimentalVMOptions -XX:MonitorDeflationThreads=4
+ *      -XX:AsyncDeflationInterval=10 -XX:MonitorUsedDeflationThreshold=1
+ *      -XX:AvgMonitorsPerThreadEstimate=1 -Xlog:monitorinflation=info
+ *      MonitorDeflationThreadsTest
+ */
+
+/*
+ * @test id=16
+ * @summary Stress monitor inflation and deflation with one or more
+ *          MonitorDeflationThreads.
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *      -XX:+UnlockExperimentalVMOptions -XX:MonitorDeflationThreads=16
+ *      -XX:AsyncDeflationInterval=10 -XX:MonitorUsedDeflationThreshold=1
+ *      -XX:AvgMonitorsPerThreadEstimate=1 -Xlog:monitorinflation=info
+ *      MonitorDeflationThreadsTest
+ */
+
+import java.util.concurrent.ThreadLocalRandom;
+import java.util.concurrent.atomic.AtomicBoolean;
+
+import jdk.test.lib.Asserts;
+import sun.hotspot.WhiteBox;
+
+public class MonitorDeflationThreadsTest {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    private static final int NUM_WORKERS = 32;
+    private static final int NUM_SHARED_LOCKS = 64;
+    private static final int NUM_DEFLATION_REQUESTS = 20;
+
+    private static final Object[] sharedLocks = new Object[NUM_SHARED_LOCKS];
+    private static final int[] sharedHashes = new int[NUM_SHARED_LOCKS];
+    private static final AtomicBoolean done = new AtomicBoolean();
+    private static volatile Throwable failure;
+
+    public static void main(String[] args) throws Exception {
+        for (int i = 0; i < NUM_SHARED_LOCKS; i++) {
+            sharedLocks[i] = new Object();
+            sharedHashes[i] = System.identityHashCode(sharedLocks[i]);
+        }
+
+        Thread[] workers = new Thread[NUM_WORKERS];
+        for (int i = 0; i < NUM_WORKERS; i++) {
+            workers[i] = new Thread(MonitorDeflationThreadsTest::work, "Worker " + i);
+            workers[i].start();
+        }
+
+        // Explicit requests wait for a pass over every in-use list.
+        for (int i = 0; i < NUM_DEFLATION_REQUESTS; i++) {
+            Asserts.assertTrue(WB.deflateIdleMonitors(), "deflation did not happen");
+        }
+
+        done.set(true);
+        for (Thread t : workers) {
+            t.join();
+        }
+        if (failure != null) {
+            throw new RuntimeException("Worker failed", failure);
+        }
+
+        // Nothing is locked any more, so a final request can deflate everything,
+        // and deflation must have restored the hash codes into the headers.
+        Asserts.assertTrue(WB.deflateIdleMonitors(), "final deflation did not happen");
+        for (int i = 0; i < NUM_SHARED_LOCKS; i++) {
+            Asserts.assertEquals(System.identityHashCode(sharedLocks[i]), sharedHashes[i],
+                                 "identity hash code changed");
+        }
+    }
+
+    private static void work() {
+        ThreadLocalRandom random = ThreadLocalRandom.current();
+        try {
+            while (!done.get()) {
+                // Monitors inflated by wait() and then left idle.
+                Object local = new Object();
+                synchronized (local) {
+                    local.wait(1);
+                }
+                // Contended monitors shared with the other workers, which are
+                // inflated by threads hashed to different in-use lists.
+                int index = random.nextInt(NUM_SHARED_LOCKS);
+                synchronized (sharedLocks[index]) {
+                    Asserts.assertEquals(System.identityHashCode(sharedLocks[index]), sharedHashes[index],
+                                         "identity hash code changed");
+                    Thread.yield();
+                }
+            }
+        } catch (Throwable t) {
+            failure = t;
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary A dynamic archive written with an older archive version is
+ *          rejected with a clear message instead of being mapped.
+ * @requires vm.cds
+ * @library /test/lib
+ * @build MethodProfilesApp
+ * @run driver TestArchiveVersionMismatch
+ */
+
+import java.io.File;
+import java.io.RandomAccessFile;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.util.JarUtils;
+
+public class TestArchiveVersionMismatch {
+    static final String MAIN_CLASS = "MethodProfilesApp";
+    static final String TOP_ARCHIVE = "version-mismatch-top.jsa";
+    // Offset of _version in GenericCDSFileMapHeader, after _magic and _crc.
+    static final int VERSION_OFFSET = 8;
+
+    static String appJar;
+
+    public static void main(String[] args) throws Exception {
+        Path jar = Paths.get("version-mismatch.jar");
+        JarUtils.createJarFile(jar, Paths.get(System.getProperty("test.classes")),
+                               MAIN_CLASS + ".class");
+        appJar = jar.toString();
+        new File(TOP_ARCHIVE).delete();
+
+        run("-XX:ArchiveClassesAtExit=" + TOP_ARCHIVE)
+            .shouldHaveExitValue(0);
+
+        // Turn it into an archive of the previous version.
+        int version;
+        try (RandomAccessFile f = new RandomAccessFile(TOP_ARCHIVE, "rw")) {
+            f.seek(VERSION_OFFSET);
+            version = Integer.reverseBytes(f.readInt());
+            f.seek(VERSION_OFFSET);
+            f.writeInt(Integer.reverseBytes(version - 1));
+        }
+
+        // -Xshare:auto runs without the archive and says why.
+        run("-XX:SharedArchiveFile=" + TOP_ARCHIVE, "-Xshare:auto", "-Xlog:cds")
+            .shouldHaveExitValue(0)
+            .shouldContain("_version expected: " + version)
+            .shouldContain("actual: " + (version - 1))
+            .shouldContain("The shared archive file has the wrong version");
+
+        // -Xshare:on fails cleanly.
+        run("-XX:SharedArchiveFile=" + TOP_ARCHIVE, "-Xshare:on")
+            .shouldNotHaveExitValue(0)
+            .shouldContain("The shared archive file has the wrong version")
+            .shouldNotContain("hs_err");
+    }
+
+    static OutputAnalyzer run(String... args) throws Exception {
+        String[] all = new String[args.length + 3];
+        System.arraycopy(args, 0, all, 0, args.length);
+        all[args.length] = "-cp";
+        all[args.length + 1] = appJar;
+        all[args.length + 2] = MAIN_CLASS;
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(all);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.reportDiagnosticSummary();
+        return output;
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary -XX:+ArchiveMethodProfiles stores the invocation counts of the
+ *          archived methods in the dynamic archive and seeds the counters
+ *          from them at runtime.
+ * @requires vm.cds
+ * @library /test/lib
+ * @build MethodProfilesApp
+ * @run driver TestArchivedMethodProfiles
+ */
+
+import java.io.File;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.util.JarUtils;
+
+public class TestArchivedMethodProfiles {
+    static final String MAIN_CLASS = "MethodProfilesApp";
+    static final String TOP_ARCHIVE = "method-profiles-top.jsa";
+    static final String SEEDED = "Seeded the counters of " + MAIN_CLASS + ".hot(I)I: invocations ";
+
+    static String appJar;
+
+    public static void main(String[] args) throws Exception {
+        Path jar = Paths.get("method-profiles.jar");
+        JarUtils.createJarFile(jar, Paths.get(System.getProperty("test.classes")),
+                               MAIN_CLASS + ".class");
+        appJar = jar.toString();
+        new File(TOP_ARCHIVE).delete();
+
+        // Training run.
+        run("-XX:+ArchiveMethodProfiles",
+            "-XX:ArchiveClassesAtExit=" + TOP_ARCHIVE,
+            "-Xlog:cds+dynamic")
+            .shouldHaveExitValue(0)
+            .shouldMatch("Archived the profiles of [1-9][0-9]* methods");
+
+        // The counters of the hot method start from the archived counts.
+        OutputAnalyzer out = run("-XX:+ArchiveMethodProfiles",
+                                 "-XX:SharedArchiveFile=" + TOP_ARCHIVE,
+                                 "-Xlog:cds=debug");
+        out.shouldHaveExitValue(0)
+           .shouldMatch(SEEDED.replace("(", "\\(").replace(")", "\\)") + "[1-9][0-9]*");
+
+        // Without the flag at runtime the archived counts are not used.
+        run("-XX:-ArchiveMethodProfiles",
+            "-XX:SharedArchiveFile=" + TOP_ARCHIVE,
+            "-Xlog:cds=debug")
+            .shouldHaveExitValue(0)
+            .shouldNotContain(SEEDED);
+
+        // A dynamic archive dumped without the flag has no profiles.
+        new File(TOP_ARCHIVE).delete();
+        run("-XX:ArchiveClassesAtExit=" + TOP_ARCHIVE,
+            "-Xlog:cds+dynamic")
+            .shouldHaveExitValue(0)
+            .shouldNotContain("Archived the profiles of");
+        run("-XX:+ArchiveMethodProfiles",
+            "-XX:SharedArchiveFile=" + TOP_ARCHIVE,
+            "-Xlog:cds=debug")
+            .shouldHaveExitValue(0)
+            .shouldNotContain(SEEDED);
+    }
+
+    static OutputAnalyzer run(String... args) throws Exception {
+        String[] all = new String[args.length + 4];
+        all[0] = "-XX:+UnlockExperimentalVMOptions";
+        System.arraycopy(args, 0, all, 1, args.length);
+        all[args.length + 1] = "-cp";
+        all[args.length + 2] = appJar;
+        all[args.length + 3] = MAIN_CLASS;
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(all);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.reportDiagnosticSummary();
+        return output;
+    }
+}
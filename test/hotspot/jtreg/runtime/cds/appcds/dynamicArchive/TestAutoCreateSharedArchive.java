@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary -XX:+AutoCreateSharedArchive creates the dynamic archive on the
+ *          first run, reuses it afterwards and recreates it when it is stale.
+ * @requires vm.cds
+ * @library /test/lib
+ * @build AutoCreateHello
+ * @run driver TestAutoCreateSharedArchive
+ */
+
+import java.io.File;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.nio.file.attribute.FileTime;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.util.JarUtils;
+
+public class TestAutoCreateSharedArchive {
+    static final String MAIN_CLASS = "AutoCreateHello";
+
+    static String appJar;
+    static String topArchive;
+
+    public static void main(String[] args) throws Exception {
+        Path jar = Paths.get("auto-create-hello.jar");
+        JarUtils.createJarFile(jar, Paths.get(System.getProperty("test.classes")),
+                               MAIN_CLASS + ".class");
+        appJar = jar.toString();
+        topArchive = "auto-create-top.jsa";
+        File archive = new File(topArchive);
+        archive.delete();
+
+        // 1. The archive does not exist: it is created at exit.
+        run("-Xlog:cds")
+            .shouldContain("Dynamic archive " + topArchive + " will be created at exit")
+            .shouldContain("Dumping shared data to file");
+        if (!archive.exists()) {
+            throw new RuntimeException(topArchive + " has not been created");
+        }
+        long created = archive.lastModified();
+
+        // 2. The archive is valid: it is mapped and left alone.
+        run("-Xlog:class+load")
+            .shouldMatch(MAIN_CLASS + " source: shared objects file \\(top\\)")
+            .shouldNotContain("will be recreated at exit");
+        if (archive.lastModified() != created) {
+            throw new RuntimeException(topArchive + " should not have been rewritten");
+        }
+
+        // 3. The archive is stale: the application jar has changed since the
+        //    archive was created, so it fails validation and is recreated.
+        FileTime later = FileTime.fromMillis(Files.getLastModifiedTime(jar).toMillis() + 10_000);
+        Files.setLastModifiedTime(jar, later);
+        run("-Xlog:cds")
+            .shouldContain("Dynamic archive " + topArchive + " will be recreated at exit")
+            .shouldContain("Dumping shared data to file");
+
+        // The recreated archive matches the new jar.
+        run("-Xlog:class+load")
+            .shouldMatch(MAIN_CLASS + " source: shared objects file \\(top\\)")
+            .shouldNotContain("will be recreated at exit");
+    }
+
+    static OutputAnalyzer run(String logOption) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+AutoCreateSharedArchive",
+            "-XX:SharedArchiveFile=" + topArchive,
+            logOption,
+            "-cp", appJar,
+            MAIN_CLASS);
+        OutputAnalyzer output = ProcessTools.executeProcess(pb);
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Hello World");
+        return output;
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary -XX:+AutoCreateSharedArchive rejects incompatible flags and is
+ *          ignored when it cannot be used.
+ * @requires vm.cds
+ * @library /test/lib
+ * @build AutoCreateHello
+ * @run driver TestAutoCreateSharedArchiveFlags
+ */
+
+import java.io.File;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestAutoCreateSharedArchiveFlags {
+    static final String MAIN_CLASS = "AutoCreateHello";
+    static final String TOP_ARCHIVE = "auto-create-flags-top.jsa";
+    static final String STATIC_ARCHIVE = "auto-create-flags-static.jsa";
+
+    public static void main(String[] args) throws Exception {
+        String cp = System.getProperty("test.classes");
+        new File(TOP_ARCHIVE).delete();
+
+        // Cannot be combined with an explicit dynamic dump.
+        run("-XX:+AutoCreateSharedArchive",
+            "-XX:SharedArchiveFile=" + TOP_ARCHIVE,
+            "-XX:ArchiveClassesAtExit=" + TOP_ARCHIVE,
+            "-cp", cp, MAIN_CLASS)
+            .shouldHaveExitValue(1)
+            .shouldContain("-XX:+AutoCreateSharedArchive cannot be used with -XX:ArchiveClassesAtExit");
+
+        run("-XX:+AutoCreateSharedArchive",
+            "-XX:SharedArchiveFile=" + TOP_ARCHIVE,
+            "-XX:+RecordDynamicDumpInfo",
+            "-cp", cp, MAIN_CLASS)
+            .shouldHaveExitValue(1)
+            .shouldContain("-XX:+AutoCreateSharedArchive cannot be used with -XX:ArchiveClassesAtExit "
+                           + "or -XX:+RecordDynamicDumpInfo");
+
+        // Ignored without SharedArchiveFile.
+        run("-XX:+AutoCreateSharedArchive",
+            "-cp", cp, MAIN_CLASS)
+            .shouldHaveExitValue(0)
+            .shouldContain("-XX:+AutoCreateSharedArchive is ignored without -XX:SharedArchiveFile")
+            .shouldContain("Hello World");
+
+        // Ignored with CDS disabled; nothing is written.
+        run("-XX:+AutoCreateSharedArchive",
+            "-XX:SharedArchiveFile=" + TOP_ARCHIVE,
+            "-Xshare:off",
+            "-cp", cp, MAIN_CLASS)
+            .shouldHaveExitValue(0)
+            .shouldContain("-XX:+AutoCreateSharedArchive is ignored")
+            .shouldContain("Hello World");
+        if (new File(TOP_ARCHIVE).exists()) {
+            throw new RuntimeException(TOP_ARCHIVE + " should not have been created");
+        }
+
+        // Ignored, and the archive is left alone, when SharedArchiveFile is a static archive.
+        run("-Xshare:dump",
+            "-XX:SharedArchiveFile=" + STATIC_ARCHIVE)
+            .shouldHaveExitValue(0);
+        long dumped = new File(STATIC_ARCHIVE).lastModified();
+        run("-XX:+AutoCreateSharedArchive",
+            "-XX:SharedArchiveFile=" + STATIC_ARCHIVE,
+            "-cp", cp, MAIN_CLASS)
+            .shouldHaveExitValue(0)
+            .shouldContain("-XX:+AutoCreateSharedArchive is ignored: " + STATIC_ARCHIVE + " is a static archive")
+            .shouldContain("Hello World");
+        if (new File(STATIC_ARCHIVE).lastModified() != dumped) {
+            throw new RuntimeException(STATIC_ARCHIVE + " should not have been rewritten");
+        }
+    }
+
+    static OutputAnalyzer run(String... args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(args);
+        return ProcessTools.executeProcess(pb);
+    }
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.net.URL;
+import java.net.URLClassLoader;
+
+public class PrecompileListApp {
+    public static void main(String[] args) throws Exception {
+        long sum = 0;
+        for (int i = 0; i < 200_000; i++) {
+            sum += PrecompileListHot.work(i);
+        }
+        System.out.println(sum);
+
+        if (args.length > 0 && args[0].equals("custom")) {
+            // Define another class with the same name in a custom loader.
+            URL jar = PrecompileListApp.class.getProtectionDomain().getCodeSource().getLocation();
+            try (URLClassLoader loader = new URLClassLoader(new URL[] { jar }, null)) {
+                Class<?> c = Class.forName("PrecompileListHot", true, loader);
+                System.out.println(c.getMethod("work", int.class).invoke(null, 1));
+            }
+        }
+    }
+}
+
+class PrecompileListHot {
+    static int work(int i) {
+        return i * 31 + 7;
+    }
+}
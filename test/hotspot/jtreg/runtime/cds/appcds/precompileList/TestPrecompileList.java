@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary -XX:ArchiveCompiledMethodsAtExit records the compiled archived
+ *          methods, and -XX:SharedCompiledMethodsFile compiles them again
+ *          for the classes of the same loader only.
+ * @requires vm.cds
+ * @requires vm.compiler1.enabled | vm.compiler2.enabled
+ * @library /test/lib
+ * @build PrecompileListApp
+ * @run driver TestPrecompileList
+ */
+
+import java.io.File;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.util.JarUtils;
+
+public class TestPrecompileList {
+    static final String MAIN_CLASS = "PrecompileListApp";
+    static final String HOT_CLASS = "PrecompileListHot";
+    static final String TOP_ARCHIVE = "precompile-list-top.jsa";
+    static final String LIST = "precompile-list.txt";
+    static final int APP_LOADER = 3; // ClassLoader::APP_LOADER
+
+    static String appJar;
+
+    public static void main(String[] args) throws Exception {
+        Path jar = Paths.get("precompile-list.jar");
+        JarUtils.createJarFile(jar, Paths.get(System.getProperty("test.classes")),
+                               MAIN_CLASS + ".class", HOT_CLASS + ".class");
+        appJar = jar.toString();
+        new File(TOP_ARCHIVE).delete();
+        new File(LIST).delete();
+
+        // 1. Archive the application classes.
+        run("-XX:ArchiveClassesAtExit=" + TOP_ARCHIVE, MAIN_CLASS)
+            .shouldHaveExitValue(0);
+
+        // 2. Record the archived methods compiled at exit.
+        run("-XX:SharedArchiveFile=" + TOP_ARCHIVE,
+            "-XX:ArchiveCompiledMethodsAtExit=" + LIST,
+            "-Xlog:cds",
+            MAIN_CLASS)
+            .shouldHaveExitValue(0)
+            .shouldMatch("Wrote \\d+ compiled methods to " + LIST);
+        List<String> lines = Files.readAllLines(Paths.get(LIST));
+        String expected = " " + APP_LOADER + " " + HOT_CLASS + " work (I)I";
+        if (lines.stream().noneMatch(l -> l.endsWith(expected))) {
+            throw new RuntimeException(LIST + " does not list " + HOT_CLASS + ".work");
+        }
+
+        // 3. Compile them again. The class with the same name defined by a
+        //    custom loader must not be compiled from the list.
+        OutputAnalyzer out = run("-XX:SharedArchiveFile=" + TOP_ARCHIVE,
+                                 "-XX:SharedCompiledMethodsFile=" + LIST,
+                                 "-Xlog:cds=debug",
+                                 MAIN_CLASS, "custom");
+        out.shouldHaveExitValue(0)
+           .shouldMatch("Read \\d+ compiled methods from " + LIST);
+        long precompiled = out.getStdout().lines()
+                              .filter(l -> l.contains("Precompiling " + HOT_CLASS + ".work(I)I"))
+                              .count();
+        if (precompiled != 1) {
+            throw new RuntimeException(HOT_CLASS + ".work precompiled " + precompiled + " times, expected once");
+        }
+
+        // 4. A list written with other archives is ignored.
+        run("-XX:SharedCompiledMethodsFile=" + LIST,
+            "-Xlog:cds",
+            MAIN_CLASS)
+            .shouldHaveExitValue(0)
+            .shouldMatch("(was written with different CDS archives|is ignored: the CDS archive is not in use)");
+    }
+
+    static OutputAnalyzer run(String... args) throws Exception {
+        String[] all = new String[args.length + 3];
+        all[0] = "-XX:+UnlockExperimentalVMOptions";
+        all[1] = "-cp";
+        all[2] = appJar;
+        System.arraycopy(args, 0, all, 3, args.length);
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(all);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.reportDiagnosticSummary();
+        return output;
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test the per-thread cache of JNI global handle entries enabled
+ *          with -XX:JNIHandleAllocationCacheSize.
+ * @library /test/lib
+ * @run main/othervm/native -XX:+UnlockExperimentalVMOptions -XX:JNIHandleAllocationCacheSize=32
+ *      TestJNIHandleAllocationCache
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.Utils;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestJNIHandleAllocationCache {
+    static {
+        System.loadLibrary("TestJNIHandleAllocationCache");
+    }
+
+    private static final int CACHE_SIZE = 32;
+    private static final int NUM_THREADS = 8;
+
+    private static native boolean doubleDeleteGlobal(Object o);
+    private static native boolean doubleDeleteWeakGlobal(Object o);
+    private static native void createAndDelete(Object o, int count);
+    private static native int refTypeAfterDelete(Object o);
+
+    private static final Pattern GLOBAL_REFS = Pattern.compile("JNI global refs: (\\d+), weak refs: (\\d+)");
+
+    public static void main(String[] args) throws Throwable {
+        if (args.length == 1 && args[0].equals("checked")) {
+            // Must be reported as an invalid reference by -Xcheck:jni.
+            refTypeAfterDelete(new Object());
+            return;
+        }
+
+        testDoubleDelete();
+        testCachedEntriesNotCounted();
+        testThreadExit();
+        testCheckJNI();
+    }
+
+    // A handle deleted twice must not be handed out twice.
+    private static void testDoubleDelete() {
+        Object o = new Object();
+        Asserts.assertTrue(doubleDeleteGlobal(o), "same global handle returned twice");
+        Asserts.assertTrue(doubleDeleteWeakGlobal(o), "same weak global handle returned twice");
+    }
+
+    private static long globalRefCount() {
+        OutputAnalyzer output = new PidJcmdExecutor().execute("Thread.print");
+        Matcher m = GLOBAL_REFS.matcher(output.getStdout());
+        Asserts.assertTrue(m.find(), "no JNI global refs line in Thread.print output");
+        return Long.parseLong(m.group(1));
+    }
+
+    // Free entries kept in the caches are not reported as global refs.
+    private static void testCachedEntriesNotCounted() {
+        Object o = new Object();
+        // Make sure this thread has filled its cache once.
+        createAndDelete(o, CACHE_SIZE);
+        long before = globalRefCount();
+        createAndDelete(o, CACHE_SIZE);
+        long after = globalRefCount();
+        Asserts.assertLessThanOrEqual(after, before, "cached entries counted as global refs");
+    }
+
+    // Entries cached by exited threads are returned to the storage.
+    private static void testThreadExit() throws Exception {
+        long before = globalRefCount();
+        Thread[] threads = new Thread[NUM_THREADS];
+        for (int i = 0; i < NUM_THREADS; i++) {
+            threads[i] = new Thread(() -> createAndDelete(new Object(), CACHE_SIZE));
+            threads[i].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        long after = globalRefCount();
+        Asserts.assertLessThanOrEqual(after, before, "entries of exited threads not released");
+    }
+
+    // With -Xcheck:jni the cache is bypassed, so deleted handles are detected.
+    private static void testCheckJNI() throws Throwable {
+        ProcessTools.executeTestJvm("-Xcheck:jni",
+                                    "-XX:+UnlockExperimentalVMOptions",
+                                    "-XX:JNIHandleAllocationCacheSize=" + CACHE_SIZE,
+                                    "-Djava.library.path=" + Utils.TEST_NATIVE_PATH,
+                                    "TestJNIHandleAllocationCache",
+                                    "checked")
+            .shouldNotHaveExitValue(0)
+            .shouldContain("Bad global or local ref passed to JNI");
+    }
+}
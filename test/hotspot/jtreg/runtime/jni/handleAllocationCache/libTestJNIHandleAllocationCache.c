@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <jni.h>
+
+JNIEXPORT jboolean JNICALL
+Java_TestJNIHandleAllocationCache_doubleDeleteGlobal(JNIEnv* env, jclass clazz, jobject obj) {
+  jobject ref = (*env)->NewGlobalRef(env, obj);
+  jobject first;
+  jobject second;
+  jboolean distinct;
+  (*env)->DeleteGlobalRef(env, ref);
+  (*env)->DeleteGlobalRef(env, ref);
+  first = (*env)->NewGlobalRef(env, obj);
+  second = (*env)->NewGlobalRef(env, obj);
+  distinct = first != second ? JNI_TRUE : JNI_FALSE;
+  (*env)->DeleteGlobalRef(env, first);
+  if (distinct) {
+    (*env)->DeleteGlobalRef(env, second);
+  }
+  return distinct;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_TestJNIHandleAllocationCache_doubleDeleteWeakGlobal(JNIEnv* env, jclass clazz, jobject obj) {
+  jweak ref = (*env)->NewWeakGlobalRef(env, obj);
+  jweak first;
+  jweak second;
+  jboolean distinct;
+  (*env)->DeleteWeakGlobalRef(env, ref);
+  (*env)->DeleteWeakGlobalRef(env, ref);
+  first = (*env)->NewWeakGlobalRef(env, obj);
+  second = (*env)->NewWeakGlobalRef(env, obj);
+  distinct = first != second ? JNI_TRUE : JNI_FALSE;
+  (*env)->DeleteWeakGlobalRef(env, first);
+  if (distinct) {
+    (*env)->DeleteWeakGlobalRef(env, second);
+  }
+  return distinct;
+}
+
+JNIEXPORT void JNICALL
+Java_TestJNIHandleAllocationCache_createAndDelete(JNIEnv* env, jclass clazz, jobject obj, jint count) {
+  jobject refs[64];
+  jint i;
+  if (count > 64) {
+    count = 64;
+  }
+  for (i = 0; i < count; i++) {
+    refs[i] = (*env)->NewGlobalRef(env, obj);
+  }
+  for (i = 0; i < count; i++) {
+    (*env)->DeleteGlobalRef(env, refs[i]);
+  }
+}
+
+JNIEXPORT jint JNICALL
+Java_TestJNIHandleAllocationCache_refTypeAfterDelete(JNIEnv* env, jclass clazz, jobject obj) {
+  jobject ref = (*env)->NewGlobalRef(env, obj);
+  (*env)->DeleteGlobalRef(env, ref);
+  return (jint)(*env)->GetObjectRefType(env, ref);
+}
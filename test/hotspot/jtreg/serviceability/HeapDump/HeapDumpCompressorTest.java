@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test selecting the zstd and lz4 heap dump compressors, and
+ *          rejecting unsupported compressors.
+ * @library /test/lib
+ * @modules java.management
+ * @run main/othervm HeapDumpCompressorTest
+ */
+
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.lang.management.ManagementFactory;
+
+import com.sun.management.HotSpotDiagnosticMXBean;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class HeapDumpCompressorTest {
+    // Little-endian magic numbers at the start of the dump files.
+    private static final int SKIPPABLE_FRAME_MAGIC = 0x184D2A50;
+    private static final int ZSTD_FRAME_MAGIC = 0xFD2FB528;
+    private static final int LZ4_FRAME_MAGIC = 0x184D2204;
+
+    public static void main(String[] args) throws Exception {
+        testRejectedAtStartup();
+        testRejectedAtRuntime();
+        testRejectedByDCmd();
+        testCompressor("zstd", ZSTD_FRAME_MAGIC);
+        testCompressor("lz4", LZ4_FRAME_MAGIC);
+    }
+
+    private static void testRejectedAtStartup() throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder("-XX:HeapDumpCompressor=bzip2", "-version");
+        new OutputAnalyzer(pb.start())
+            .shouldNotHaveExitValue(0)
+            .shouldContain("HeapDumpCompressor (bzip2) must be one of gzip, zstd or lz4");
+    }
+
+    private static void testRejectedAtRuntime() throws Exception {
+        HotSpotDiagnosticMXBean bean = ManagementFactory.getPlatformMXBean(HotSpotDiagnosticMXBean.class);
+        String before = bean.getVMOption("HeapDumpCompressor").getValue();
+        try {
+            bean.setVMOption("HeapDumpCompressor", "bzip2");
+            throw new RuntimeException("Unsupported HeapDumpCompressor accepted");
+        } catch (IllegalArgumentException e) {
+            System.out.println("Expected: " + e);
+        }
+        Asserts.assertEquals(bean.getVMOption("HeapDumpCompressor").getValue(), before);
+
+        bean.setVMOption("HeapDumpCompressor", "lz4");
+        Asserts.assertEquals(bean.getVMOption("HeapDumpCompressor").getValue(), "lz4");
+        bean.setVMOption("HeapDumpCompressor", before);
+    }
+
+    private static void testRejectedByDCmd() {
+        File dump = new File("bzip2.hprof");
+        new PidJcmdExecutor().execute("GC.heap_dump -compressor=bzip2 " + dump.getAbsolutePath())
+            .shouldContain("Unknown compressor: bzip2");
+        Asserts.assertFalse(dump.exists(), "dump file created for unsupported compressor");
+    }
+
+    private static void testCompressor(String name, int frameMagic) throws IOException {
+        File dump = new File(name + ".hprof");
+        OutputAnalyzer output = new PidJcmdExecutor().execute("GC.heap_dump -compressor=" + name + " " +
+                                                              dump.getAbsolutePath());
+        if (output.getOutput().contains("Cannot load the " + name + " library")) {
+            System.out.println("Skipping " + name + ": library not installed");
+            dump.delete();
+            return;
+        }
+        output.shouldContain("Heap dump file created");
+
+        try (FileInputStream in = new FileInputStream(dump)) {
+            // A skippable frame with the block size comes first ...
+            Asserts.assertEquals(readIntLE(in), SKIPPABLE_FRAME_MAGIC, "no skippable frame");
+            int len = readIntLE(in);
+            String comment = new String(in.readNBytes(len));
+            Asserts.assertTrue(comment.startsWith("HPROF BLOCKSIZE="), "unexpected comment " + comment);
+            // ... followed by a frame of the selected format.
+            Asserts.assertEquals(readIntLE(in), frameMagic, "not a " + name + " frame");
+        } finally {
+            dump.delete();
+        }
+    }
+
+    private static int readIntLE(FileInputStream in) throws IOException {
+        byte[] b = in.readNBytes(4);
+        Asserts.assertEquals(b.length, 4, "file too short");
+        return (b[0] & 0xff) | (b[1] & 0xff) << 8 | (b[2] & 0xff) << 16 | (b[3] & 0xff) << 24;
+    }
+}
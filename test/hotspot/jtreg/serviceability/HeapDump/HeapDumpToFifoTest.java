@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test streaming a heap dump into a named pipe, and that the dump
+ *          fails promptly when the pipe has no reader.
+ * @requires os.family != "windows"
+ * @library /test/lib
+ * @run main/othervm HeapDumpToFifoTest
+ */
+
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.InputStream;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.TimeUnit;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class HeapDumpToFifoTest {
+    private static final String HPROF_HEADER = "JAVA PROFILE 1.0.2";
+
+    public static void main(String[] args) throws Exception {
+        File fifo = new File("dump.fifo").getAbsoluteFile();
+        fifo.delete();
+        ProcessTools.executeProcess("mkfifo", fifo.getPath()).shouldHaveExitValue(0);
+        try {
+            testNoReader(fifo);
+            testStream(fifo, "");
+            testStream(fifo, "-gz=1 ");
+        } finally {
+            fifo.delete();
+        }
+    }
+
+    // Without a reader the dump must fail instead of waiting for one.
+    private static void testNoReader(File fifo) {
+        new PidJcmdExecutor().execute("GC.heap_dump " + fifo.getPath())
+            .shouldContain("No process has the named pipe open for reading");
+    }
+
+    private static void testStream(File fifo, String options) throws Exception {
+        // Opening the pipe for reading blocks until the dump opens it for writing.
+        CompletableFuture<byte[]> reader = CompletableFuture.supplyAsync(() -> {
+            try (InputStream in = new FileInputStream(fifo)) {
+                return in.readAllBytes();
+            } catch (Exception e) {
+                throw new RuntimeException(e);
+            }
+        });
+
+        // Retry until the reader thread has the pipe open.
+        OutputAnalyzer output;
+        long deadline = System.nanoTime() + TimeUnit.MINUTES.toNanos(1);
+        do {
+            Thread.sleep(100);
+            output = new PidJcmdExecutor().execute("GC.heap_dump " + options + fifo.getPath());
+        } while (output.getOutput().contains("No process has the named pipe open for reading") &&
+                 System.nanoTime() < deadline);
+        output.shouldContain("Heap dump file created");
+
+        byte[] dump = reader.get(1, TimeUnit.MINUTES);
+        Asserts.assertGT(dump.length, HPROF_HEADER.length(), "dump too short");
+        if (options.isEmpty()) {
+            Asserts.assertEquals(new String(dump, 0, HPROF_HEADER.length()), HPROF_HEADER);
+        } else {
+            // gzip magic
+            Asserts.assertEquals(dump[0] & 0xff, 0x1f);
+            Asserts.assertEquals(dump[1] & 0xff, 0x8b);
+        }
+        Asserts.assertTrue(fifo.exists(), "named pipe removed");
+    }
+}
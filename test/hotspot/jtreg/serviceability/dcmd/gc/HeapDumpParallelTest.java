@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test the -parallel and -segmented options of GC.heap_dump
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run main/othervm HeapDumpParallelTest
+ */
+
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.OutputStream;
+import java.nio.file.Files;
+import java.util.ArrayList;
+import java.util.List;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.hprof.HprofParser;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class HeapDumpParallelTest {
+    // Keep enough objects alive that every dump thread has work.
+    private static final List<int[]> retained = new ArrayList<>();
+
+    public static void main(String[] args) throws Exception {
+        for (int i = 0; i < 100_000; i++) {
+            retained.add(new int[i % 64]);
+        }
+
+        testDump("serial", "");
+        testDump("parallel4", "-parallel=4");
+        testDump("parallel0", "-parallel=0");
+        testSegmented();
+        testRejected();
+    }
+
+    private static OutputAnalyzer heapDump(String options, File dump) {
+        return new PidJcmdExecutor().execute("GC.heap_dump " + options + " " + dump.getAbsolutePath());
+    }
+
+    private static void testDump(String name, String options) throws Exception {
+        File dump = new File(name + ".hprof");
+        dump.delete();
+        heapDump(options, dump).shouldContain("Heap dump file created");
+        verify(dump);
+        Asserts.assertFalse(new File(dump.getPath() + ".index").exists(),
+                            "segment index written without -segmented");
+        dump.delete();
+    }
+
+    private static void testSegmented() throws Exception {
+        File dump = new File("segmented.hprof");
+        dump.delete();
+        heapDump("-parallel=4 -segmented", dump).shouldContain("Heap dump file created");
+
+        File index = new File(dump.getPath() + ".index");
+        if (!index.exists()) {
+            // The VM used a single dump thread, so there is nothing to segment.
+            verify(dump);
+            dump.delete();
+            return;
+        }
+
+        // The index lists the files in the order they have to be concatenated.
+        List<String> parts = Files.readAllLines(index.toPath());
+        Asserts.assertEquals(parts.get(0), dump.getName(), "index does not start with the dump file");
+        File joined = new File("segmented-joined.hprof");
+        try (OutputStream out = new FileOutputStream(joined)) {
+            for (String part : parts) {
+                File f = new File(dump.getAbsoluteFile().getParentFile(), part);
+                Asserts.assertTrue(f.exists(), "missing segment " + f);
+                Files.copy(f.toPath(), out);
+                f.delete();
+            }
+        }
+        verify(joined);
+        index.delete();
+        joined.delete();
+    }
+
+    private static void testRejected() {
+        File dump = new File("rejected.hprof");
+        dump.delete();
+        heapDump("-parallel=-1", dump).shouldContain("Parallel thread number out of range");
+        Asserts.assertFalse(dump.exists(), "dump file created for a negative thread number");
+    }
+
+    private static void verify(File dump) throws IOException {
+        Asserts.assertTrue(dump.exists() && dump.length() > 0, "no dump file " + dump);
+        byte[] header = "JAVA PROFILE 1.0.2".getBytes();
+        byte[] start = new byte[header.length];
+        try (var in = Files.newInputStream(dump.toPath())) {
+            Asserts.assertEquals(in.read(start), header.length, "dump file too short");
+        }
+        Asserts.assertEquals(new String(start), new String(header), "not an HPROF file");
+        try {
+            HprofParser.parse(dump);
+        } catch (Exception e) {
+            throw new RuntimeException("Could not parse " + dump, e);
+        }
+    }
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test the -handshake option of Thread.print
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run main/othervm PrintHandshakeTest
+ */
+
+import java.util.concurrent.CountDownLatch;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class PrintHandshakeTest {
+    private static final int THREADS = 4;
+    private static final Object lock = new Object();
+
+    public static void main(String[] args) throws Exception {
+        CountDownLatch started = new CountDownLatch(THREADS);
+        CountDownLatch done = new CountDownLatch(1);
+        Thread[] threads = new Thread[THREADS];
+        for (int i = 0; i < THREADS; i++) {
+            threads[i] = new Thread(() -> {
+                started.countDown();
+                waitInMarkerFrame(done);
+            }, "PrintHandshakeTest-" + i);
+            threads[i].start();
+        }
+        started.await();
+
+        try {
+            testHandshake();
+            testHandshakeExtended();
+            testLocksRejected();
+            testDefault();
+        } finally {
+            done.countDown();
+            for (Thread t : threads) {
+                t.join();
+            }
+        }
+    }
+
+    private static void waitInMarkerFrame(CountDownLatch done) {
+        try {
+            done.await();
+        } catch (InterruptedException e) {
+            throw new RuntimeException(e);
+        }
+    }
+
+    private static void shouldListThreads(OutputAnalyzer output) {
+        for (int i = 0; i < THREADS; i++) {
+            output.shouldContain("\"PrintHandshakeTest-" + i + "\"");
+        }
+        output.shouldContain("PrintHandshakeTest.waitInMarkerFrame");
+        // The thread executing the command prints itself.
+        output.shouldContain("\"main\"");
+    }
+
+    private static void testHandshake() {
+        OutputAnalyzer output = new PidJcmdExecutor().execute("Thread.print -handshake");
+        output.shouldContain("Full thread dump");
+        output.shouldContain("per-thread handshakes:");
+        shouldListThreads(output);
+        // Neither deadlock detection nor JNI handle counts in this mode.
+        output.shouldNotContain("JNI global refs:");
+        output.shouldNotContain("Java-level deadlock");
+    }
+
+    private static void testHandshakeExtended() {
+        OutputAnalyzer output = new PidJcmdExecutor().execute("Thread.print -handshake -e");
+        output.shouldContain("per-thread handshakes:");
+        shouldListThreads(output);
+    }
+
+    private static void testLocksRejected() {
+        OutputAnalyzer output = new PidJcmdExecutor().execute("Thread.print -handshake -l");
+        output.shouldContain("-l requires a safepoint and cannot be combined with -handshake");
+        output.shouldNotContain("Full thread dump");
+    }
+
+    private static void testDefault() {
+        OutputAnalyzer output = new PidJcmdExecutor().execute("Thread.print");
+        output.shouldContain("Full thread dump");
+        output.shouldNotContain("per-thread handshakes");
+        output.shouldContain("JNI global refs:");
+        shouldListThreads(output);
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that a large write to a FileOutputStream in append mode
+ *          is not interleaved with the writes of other appenders.
+ * @requires os.family == "linux"
+ * @run main AppendLargeWrite
+ */
+
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.util.Arrays;
+
+public class AppendLargeWrite {
+    private static final int THREADS = 4;
+    private static final int WRITES = 16;
+    // Well above the size of the chunks a non-append write is split into.
+    private static final int SIZE = 1024 * 1024;
+
+    public static void main(String[] args) throws Exception {
+        File file = File.createTempFile("AppendLargeWrite", null, new File("."));
+        file.deleteOnExit();
+
+        Thread[] threads = new Thread[THREADS];
+        IOException[] failures = new IOException[THREADS];
+        for (int t = 0; t < THREADS; t++) {
+            final int id = t;
+            threads[t] = new Thread(() -> {
+                byte[] block = new byte[SIZE];
+                Arrays.fill(block, (byte) ('A' + id));
+                try (FileOutputStream out = new FileOutputStream(file, true)) {
+                    for (int i = 0; i < WRITES; i++) {
+                        out.write(block);
+                    }
+                } catch (IOException e) {
+                    failures[id] = e;
+                }
+            });
+            threads[t].start();
+        }
+        for (int t = 0; t < THREADS; t++) {
+            threads[t].join();
+            if (failures[t] != null) {
+                throw failures[t];
+            }
+        }
+
+        byte[] content = Files.readAllBytes(file.toPath());
+        if (content.length != THREADS * WRITES * SIZE) {
+            throw new RuntimeException("Unexpected file size " + content.length);
+        }
+        // Every block must consist of the bytes of a single writer.
+        for (int b = 0; b < content.length; b += SIZE) {
+            byte expected = content[b];
+            for (int i = b; i < b + SIZE; i++) {
+                if (content[i] != expected) {
+                    throw new RuntimeException("Block at " + b + " interleaved at offset " + i);
+                }
+            }
+        }
+    }
+}
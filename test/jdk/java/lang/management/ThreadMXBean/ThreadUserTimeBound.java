@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that the user CPU time of a thread never exceeds its
+ *          total CPU time.
+ * @requires os.family == "linux"
+ * @modules java.management
+ * @run main/othervm ThreadUserTimeBound
+ */
+
+import java.io.File;
+import java.io.IOException;
+import java.lang.management.ManagementFactory;
+import java.lang.management.ThreadMXBean;
+import java.util.concurrent.CountDownLatch;
+
+public class ThreadUserTimeBound {
+    private static final int WORKERS = 4;
+    private static final long DURATION_NS = 5_000_000_000L;
+
+    private static final ThreadMXBean mbean = ManagementFactory.getThreadMXBean();
+    private static volatile boolean done;
+    private static volatile long sink;
+
+    public static void main(String[] args) throws Exception {
+        if (!mbean.isThreadCpuTimeSupported()) {
+            System.out.println("Thread CPU time is not supported, skipping");
+            return;
+        }
+        mbean.setThreadCpuTimeEnabled(true);
+
+        CountDownLatch started = new CountDownLatch(WORKERS);
+        Thread[] workers = new Thread[WORKERS];
+        for (int i = 0; i < WORKERS; i++) {
+            workers[i] = new Thread(() -> {
+                started.countDown();
+                while (!done) {
+                    work();
+                }
+            }, "Worker-" + i);
+            workers[i].start();
+        }
+        started.await();
+
+        long deadline = System.nanoTime() + DURATION_NS;
+        long checks = 0;
+        while (System.nanoTime() < deadline) {
+            // Query the user time first. Both times only grow, so the user
+            // time cannot legitimately exceed the CPU time read after it.
+            long user = mbean.getCurrentThreadUserTime();
+            long cpu = mbean.getCurrentThreadCpuTime();
+            check("current thread", user, cpu);
+            for (Thread t : workers) {
+                user = mbean.getThreadUserTime(t.getId());
+                cpu = mbean.getThreadCpuTime(t.getId());
+                check(t.getName(), user, cpu);
+            }
+            work();
+            checks++;
+        }
+
+        done = true;
+        for (Thread t : workers) {
+            t.join();
+        }
+        System.out.println("Passed " + checks + " rounds");
+    }
+
+    // Mix computation with system calls so that the threads accumulate
+    // both user and system time.
+    private static void work() {
+        long x = 0;
+        for (int i = 0; i < 100_000; i++) {
+            x += i * 31 ^ x;
+        }
+        sink = x;
+        try {
+            File.createTempFile("ThreadUserTimeBound", null).delete();
+        } catch (IOException e) {
+            throw new RuntimeException(e);
+        }
+    }
+
+    private static void check(String name, long user, long cpu) {
+        if (user > cpu) {
+            throw new RuntimeException(name + ": user time " + user +
+                                       " ns exceeds CPU time " + cpu + " ns");
+        }
+    }
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/* @test
+ * @summary Test FileChannel.transferTo to a file, a socket and a pipe
+ * (use -Dseed=X to set PRNG seed)
+ * @library /test/lib
+ * @build jdk.test.lib.RandomFactory
+ * @run main TransferToFileAndSocket
+ * @key randomness
+ */
+
+import java.io.IOException;
+import java.net.InetAddress;
+import java.net.InetSocketAddress;
+import java.nio.ByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.channels.Pipe;
+import java.nio.channels.ServerSocketChannel;
+import java.nio.channels.SocketChannel;
+import java.nio.channels.WritableByteChannel;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Arrays;
+import java.util.Random;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+
+import jdk.test.lib.RandomFactory;
+
+import static java.nio.file.StandardOpenOption.*;
+
+public class TransferToFileAndSocket {
+
+    private static final int SIZE = 4 * 1024 * 1024 + 17;
+    private static final Random RAND = RandomFactory.getRandom();
+
+    public static void main(String[] args) throws Exception {
+        byte[] bytes = new byte[SIZE];
+        RAND.nextBytes(bytes);
+        Path source = Files.createTempFile(Path.of("."), "source", null);
+        Files.write(source, bytes);
+
+        try (FileChannel src = FileChannel.open(source, READ)) {
+            testFileToFile(src, bytes);
+            testFileToSocket(src, bytes);
+            testFileToPipe(src, bytes);
+        } finally {
+            Files.delete(source);
+        }
+    }
+
+    // Transfers the whole file from a random start position to the target.
+    private static long transferAll(FileChannel src, long position,
+                                    WritableByteChannel target)
+        throws IOException {
+        long transferred = 0;
+        while (position + transferred < SIZE) {
+            long n = src.transferTo(position + transferred,
+                                    SIZE - position - transferred, target);
+            if (n <= 0) {
+                throw new RuntimeException("transferTo made no progress");
+            }
+            transferred += n;
+        }
+        return transferred;
+    }
+
+    private static void testFileToFile(FileChannel src, byte[] bytes) throws IOException {
+        Path target = Files.createTempFile(Path.of("."), "target", null);
+        try (FileChannel dst = FileChannel.open(target, WRITE)) {
+            // Existing content before the target position must be kept.
+            dst.write(ByteBuffer.wrap(new byte[] { 1, 2, 3 }));
+            int position = RAND.nextInt(SIZE / 2);
+            long n = transferAll(src, position, dst);
+            if (n != SIZE - position) {
+                throw new RuntimeException("Transferred " + n + " bytes, expected " + (SIZE - position));
+            }
+            if (dst.position() != 3 + n) {
+                throw new RuntimeException("Target position " + dst.position() + ", expected " + (3 + n));
+            }
+            if (src.position() != 0) {
+                throw new RuntimeException("Source position changed");
+            }
+            byte[] result = Files.readAllBytes(target);
+            byte[] expected = new byte[3 + SIZE - position];
+            expected[0] = 1;
+            expected[1] = 2;
+            expected[2] = 3;
+            System.arraycopy(bytes, position, expected, 3, SIZE - position);
+            if (!Arrays.equals(result, expected)) {
+                throw new RuntimeException("File to file transfer corrupted the data");
+            }
+        } finally {
+            Files.delete(target);
+        }
+    }
+
+    private static void testFileToSocket(FileChannel src, byte[] bytes) throws Exception {
+        ExecutorService executor = Executors.newSingleThreadExecutor();
+        try (ServerSocketChannel server = ServerSocketChannel.open()) {
+            server.bind(new InetSocketAddress(InetAddress.getLoopbackAddress(), 0));
+            int position = RAND.nextInt(SIZE / 2);
+            Future<byte[]> received = executor.submit(() -> {
+                try (SocketChannel peer = server.accept()) {
+                    return peer.socket().getInputStream().readAllBytes();
+                }
+            });
+            try (SocketChannel client = SocketChannel.open(server.getLocalAddress())) {
+                long n = transferAll(src, position, client);
+                if (n != SIZE - position) {
+                    throw new RuntimeException("Transferred " + n + " bytes, expected " + (SIZE - position));
+                }
+            }
+            if (!Arrays.equals(received.get(), Arrays.copyOfRange(bytes, position, SIZE))) {
+                throw new RuntimeException("File to socket transfer corrupted the data");
+            }
+        } finally {
+            executor.shutdown();
+        }
+    }
+
+    private static void testFileToPipe(FileChannel src, byte[] bytes) throws Exception {
+        ExecutorService executor = Executors.newSingleThreadExecutor();
+        Pipe pipe = Pipe.open();
+        try {
+            int position = RAND.nextInt(SIZE / 2);
+            Future<byte[]> received = executor.submit(() -> {
+                try (Pipe.SourceChannel source = pipe.source()) {
+                    ByteBuffer bb = ByteBuffer.allocate(SIZE - position);
+                    while (bb.hasRemaining() && source.read(bb) >= 0) { }
+                    return bb.array();
+                }
+            });
+            try (Pipe.SinkChannel sink = pipe.sink()) {
+                long n = transferAll(src, position, sink);
+                if (n != SIZE - position) {
+                    throw new RuntimeException("Transferred " + n + " bytes, expected " + (SIZE - position));
+                }
+            }
+            if (!Arrays.equals(received.get(), Arrays.copyOfRange(bytes, position, SIZE))) {
+                throw new RuntimeException("File to pipe transfer corrupted the data");
+            }
+        } finally {
+            executor.shutdown();
+        }
+    }
+}